@@ -79,7 +79,7 @@ void DimerJop::common_init(const int norbA, const int norbB) {
 
   {
     double* Adata = mo2eA->data();
-    double* modata = mo2e_->data();
+    const double* modata = mo2e_->data();
 
     for (int i = 0; i < norbA; ++i) {
       for (int j = 0; j < norbA; ++j) {
@@ -95,7 +95,7 @@ void DimerJop::common_init(const int norbA, const int norbB) {
 
   {
     double* Bdata = mo2eB->data();
-    double* modata = mo2e_->data() + norb*norb*norb*norbA;
+    const double* modata = mo2e_->data() + norb*norb*norb*norbA;
 
     for (int i = 0; i < norbB; ++i) {
       modata += norb*norb*norbA;
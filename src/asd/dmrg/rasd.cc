@@ -71,7 +71,7 @@ void RASD::read_restricted(shared_ptr<PTree> input, const int site) const {
 shared_ptr<Matrix> RASD::compute_sigma2e(shared_ptr<const RASDvec> cc, shared_ptr<const MOFile> jop) const {
   const int nstates = cc->ij();
   // Maybe batchsize should be an attribute of RASD
-  FormSigmaRAS form_2e(input_->get_child("ras")->get<int>("batchsize", 512));
+  FormSigmaRAS form_2e(input_->get_child("ras")->get<int>("batchsize", 512), input_->get_child("ras")->get<double>("dense_threshold", 0.5));
   shared_ptr<const RASDvec> sigma = form_2e(cc, nullptr, jop->mo2e(), vector<int>(nstates, static_cast<int>(false)));
 
   auto out = make_shared<Matrix>(nstates, nstates);
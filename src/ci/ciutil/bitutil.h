@@ -59,9 +59,40 @@ namespace bagel {
       return print_bit(bit, 0, max);
     }
 
+    // w-th 64-bit word of a string. Strings wider than 64 bits (see --with-nbit) are processed word by word
+    inline unsigned long long bit_word(const std::bitset<nbit__>& bit, const int w) {
+      static const std::bitset<nbit__> lowmask(~0ull);
+      return nword__ == 1 ? bit.to_ullong() : ((bit >> (w << 6)) & lowmask).to_ullong();
+    }
+
+    // number of set bits in [0, i)
+    inline int count_below(const std::bitset<nbit__>& bit, const int i) {
+      int out = 0;
+      const int w = i >> 6;
+      for (int k = 0; k != w; ++k)
+        out += __builtin_popcountll(bit_word(bit, k));
+      if (i & 63)
+        out += __builtin_popcountll(bit_word(bit, w) & ((1ull << (i & 63)) - 1ull));
+      return out;
+    }
+
+    // calls f(i) for every set bit i in [start, fence) in ascending order
+    template <typename Func>
+    inline void for_each_bit(const std::bitset<nbit__>& bit, const int start, const int fence, Func f) {
+      for (int w = start >> 6; w < ((fence + 63) >> 6); ++w) {
+        const int lo = w << 6;
+        unsigned long long word = bit_word(bit, w);
+        if (start > lo)      word &= ~0ull << (start - lo);
+        if (fence < lo + 64) word &= (1ull << (fence - lo)) - 1ull;
+        for ( ; word; word &= word - 1ull)
+          f(lo + __builtin_ctzll(word));
+      }
+    }
+
     std::vector<int> bit_to_numbers(std::bitset<nbit__> bit) {
       std::vector<int> out;
-      for (int i = 0; i != nbit__; ++i) if (bit[i]) out.push_back(i);
+      out.reserve(bit.count());
+      for_each_bit(bit, 0, nbit__, [&out](const int i) { out.push_back(i); });
       return out;
     }
 
@@ -71,18 +102,17 @@ namespace bagel {
       return out;
     }
 
-    int sign(std::bitset<nbit__> bit, int i, int j) {
-      // masking irrelevant bits
+    // parity of the number of electrons between i and j (exclusive)
+    int sign(const std::bitset<nbit__>& bit, int i, int j) {
       int min, max;
       std::tie(min,max) = std::minmax(i,j);
-      bit &= ((~std::bitset<nbit__>(0ull)) << min+1);
-      bit &= ((~std::bitset<nbit__>(0ull)) >> (nbit__ - max));
-      return 1 - ((bit.count() & 1) << 1);
+      const int n = max > min ? count_below(bit, max) - count_below(bit, min+1) : 0;
+      return 1 - ((n & 1) << 1);
     }
 
-    int sign(std::bitset<nbit__> bit, int i) {
-      bit &= ((~std::bitset<nbit__>(0ull)) >> (nbit__ - i));
-      return 1 - ((bit.count() & 1 ) << 1);
+    // parity of the number of electrons below i
+    int sign(const std::bitset<nbit__>& bit, int i) {
+      return 1 - ((count_below(bit, i) & 1) << 1);
     }
 
   }
@@ -33,6 +33,7 @@
 #include <src/util/parallel/mpi_interface.h>
 #include <src/util/serialization.h>
 #include <src/ci/ciutil/cistringmap.h>
+#include <src/ci/ciutil/bitutil.h>
 
 namespace bagel {
 
@@ -65,8 +66,7 @@ class CIGraph {
       size_t out = 0;
 
       int k = 0;
-      for (int i = start; i < fence; ++i)
-        if (abit[i]) out += weight(i-start,k++);
+      for_each_bit(abit, start, fence, [&](const int i) { out += weight(i-start,k++); });
       return out;
     }
 };
@@ -213,10 +213,10 @@ class RASString : public CIString_base_impl<3,RASString> {
 
     // helper functions
     int nholes(const std::bitset<nbit__>& bit) const {
-      return subspace_[0].second - (bit & (~std::bitset<nbit__>(0ull) >> (nbit__ - subspace_[0].second))).count();
+      return subspace_[0].second - count_below(bit, subspace_[0].second);
     }
     int nparticles(const std::bitset<nbit__>& bit) const {
-      return (bit & (~(~std::bitset<nbit__>(0ull) << subspace_[2].second) << subspace_[0].second + subspace_[1].second)).count();
+      return count_below(bit, norb_) - count_below(bit, subspace_[0].second + subspace_[1].second);
     }
 
   private:
@@ -0,0 +1,71 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: cistringcache.cc
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#include <src/ci/ciutil/cistringcache.h>
+
+using namespace std;
+using namespace bagel;
+
+mutex& FCIStringCache::mutex() {
+  static std::mutex mut;
+  return mut;
+}
+
+
+map<FCIStringCache::KeyType, weak_ptr<const CIStringSet<FCIString>>>& FCIStringCache::data() {
+  static map<KeyType, weak_ptr<const FCIStringSet>> dat;
+  return dat;
+}
+
+
+shared_ptr<const CIStringSet<FCIString>> FCIStringCache::get(const int nele, const int norb) {
+  lock_guard<std::mutex> lock(mutex());
+  weak_ptr<const FCIStringSet>& entry = data()[{nele, norb}];
+  shared_ptr<const FCIStringSet> out = entry.lock();
+  if (!out) {
+    // drop the entries that have been released
+    for (auto iter = data().begin(); iter != data().end(); ) {
+      if (iter->second.expired() && iter->first != KeyType{nele, norb})
+        iter = data().erase(iter);
+      else
+        ++iter;
+    }
+    auto string = make_shared<FCIString>(nele, norb);
+    out = make_shared<FCIStringSet>(list<shared_ptr<const FCIString>>{string});
+    entry = out;
+  }
+  return out;
+}
+
+
+void FCIStringCache::insert(shared_ptr<const CIStringSet<FCIString>> o) {
+  // only sets that consist of a single full FCI string (without offset) are interchangeable
+  if (!o || o->nspaces() != 1 || o->begin()->get()->offset() != 0)
+    return;
+  lock_guard<std::mutex> lock(mutex());
+  weak_ptr<const FCIStringSet>& entry = data()[{o->nele(), o->norb()}];
+  if (entry.expired())
+    entry = o;
+}
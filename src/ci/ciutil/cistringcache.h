@@ -0,0 +1,55 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: cistringcache.h
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#ifndef __SRC_CIUTIL_CISTRINGCACHE_H
+#define __SRC_CIUTIL_CISTRINGCACHE_H
+
+#include <mutex>
+#include <src/ci/ciutil/cistringset.h>
+
+namespace bagel {
+
+// Process-wide cache of FCI string sets (strings and single displacement lists) keyed by (nele, norb).
+// Determinant spaces are reconstructed many times (RDMs and CI derivatives in every CASSCF macroiteration,
+// finite-difference displacements, ...), while the strings only depend on the number of electrons and orbitals.
+// Only weak references are kept; a string set is released once no determinant space uses it.
+class FCIStringCache {
+  protected:
+    using FCIStringSet = CIStringSet<FCIString>;
+    using KeyType = std::pair<int, int>;
+
+    static std::mutex& mutex();
+    static std::map<KeyType, std::weak_ptr<const FCIStringSet>>& data();
+
+  public:
+    // returns a cached string set; constructed if not found
+    static std::shared_ptr<const FCIStringSet> get(const int nele, const int norb);
+    // registers string sets that are constructed elsewhere (e.g., loaded from an archive)
+    static void insert(std::shared_ptr<const FCIStringSet> o);
+};
+
+}
+
+#endif
@@ -43,24 +43,21 @@ void CIStringSet<FCIString>::construct_phi() {
   uncompressed_phi_->reserve(size());
 
   for (auto& istring : strings_) {
-    for (unsigned int i = 0; i != norb(); ++i) { // annihilation
-      // compress_ means that we store info only for i <= j
-      if (istring[i]) {
-        const unsigned int source = lexical_zero(istring);
-        bitset<nbit__> nbit = istring; nbit.reset(i); // annihilated.
-        for (unsigned int j = 0; j != norb(); ++j) { // creation
-          if (!nbit[j]) {
-            bitset<nbit__> mbit = nbit;
-            mbit.set(j);
-            int minij, maxij;
-            tie(minij, maxij) = minmax(i,j);
-            auto detmap = DetMap(lexical_zero(mbit), sign(mbit, i, j), source, i+norb()*j);
-            (*phi_)[minij+((maxij*(maxij+1))>>1)].push_back(detmap);
-            (*uncompressed_phi_)[i + j*norb()].push_back(detmap);
-          }
-        }
-      }
-    }
+    const unsigned int source = lexical_zero(istring);
+    // loop over occupied (annihilation) and then unoccupied (creation) orbitals
+    for_each_bit(istring, 0, norb(), [&](const int i) {
+      bitset<nbit__> nbit = istring; nbit.reset(i); // annihilated.
+      for_each_bit(~nbit, 0, norb(), [&](const int j) {
+        bitset<nbit__> mbit = nbit;
+        mbit.set(j);
+        int minij, maxij;
+        tie(minij, maxij) = minmax(i,j);
+        // compress_ means that we store info only for i <= j
+        auto detmap = DetMap(lexical_zero(mbit), sign(mbit, i, j), source, i+norb()*j);
+        (*phi_)[minij+((maxij*(maxij+1))>>1)].push_back(detmap);
+        (*uncompressed_phi_)[i + j*norb()].push_back(detmap);
+      });
+    });
   }
 }
 
@@ -70,24 +67,20 @@ void CIStringSet<RASString>::construct_phi() {
   phi_ = make_shared<StringMap>(size_);
   phi_->reserve(norb_*norb_);
 
-  unordered_map<bitset<nbit__>, size_t> lexmap;
-  for (size_t i = 0; i < size_; ++i)
-    lexmap[strings_[i]] = i;
-
   size_t tindex = 0;
   for (auto& istring : strings_) {
-    for (int j = 0; j < norb_; ++j) {
-      if (!istring[j]) continue;
+    for_each_bit(istring, 0, norb_, [&](const int j) {
       bitset<nbit__> intermediatebit = istring; intermediatebit.reset(j);
-      for (int i = 0; i < norb_; ++i) {
-        if (intermediatebit[i]) continue;
+      for_each_bit(~intermediatebit, 0, norb_, [&](const int i) {
         bitset<nbit__> sourcebit = intermediatebit; sourcebit.set(i);
-        if (allowed(sourcebit)) {
-          assert(lexmap.find(sourcebit) != lexmap.end());
-          (*phi_)[tindex].emplace_back(tindex, sign(istring, i, j), lexmap[sourcebit], j+i*norb_);
-        }
-      }
-    }
+        // lexical index from the graph of the subspace that contains sourcebit (no hashing of bitsets)
+        for (auto& space : stringset_)
+          if (space->contains(sourcebit)) {
+            (*phi_)[tindex].emplace_back(tindex, sign(istring, i, j), space->lexical_offset(sourcebit), j+i*norb_);
+            break;
+          }
+      });
+    });
     (*phi_)[tindex++].shrink_to_fit();
   }
 }
@@ -68,18 +68,16 @@ class CIStringSpace {
 
 
       for (auto& istring : string) {
-        for (size_t i = 0; i != norb_; ++i) {
-          if (!istring[i]) { // creation
-            const size_t source = ref->lexical_offset(istring);
-            std::bitset<nbit__> nbit = istring; nbit.set(i); // created.
-            if (plus->allowed(nbit)) {
-              const size_t target = plus->lexical_offset(nbit);
-              const int s = sign(nbit, i) * fac;
-              (*phiup)[i].emplace_back(target, s, source, 0);
-              (*phidown)[i].emplace_back(source, s, target, 0);
-            }
+        const size_t source = ref->lexical_offset(istring);
+        for_each_bit(~istring, 0, norb_, [&](const int i) { // creation
+          std::bitset<nbit__> nbit = istring; nbit.set(i); // created.
+          if (plus->allowed(nbit)) {
+            const size_t target = plus->lexical_offset(nbit);
+            const int s = sign(nbit, i) * fac;
+            (*phiup)[i].emplace_back(target, s, source, 0);
+            (*phidown)[i].emplace_back(source, s, target, 0);
           }
-        }
+        });
       }
 
       phiup->shrink_to_fit();
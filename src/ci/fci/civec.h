@@ -30,6 +30,7 @@
 #include <src/util/math/algo.h>
 #include <src/util/f77.h>
 #include <src/util/parallel/staticdist.h>
+#include <src/util/io/binarchive.h>
 #include <src/ci/fci/determinants.h>
 #include <src/ci/fci/dvector_base.h>
 
@@ -69,14 +70,24 @@ class Civector {
     void save(Archive& ar, const unsigned int) const {
       if (!cc_.get())
         throw std::logic_error("illegal call of Civector<T>::save");
-      ar << det_ << lena_ << lenb_ << make_array(cc(), size());
+      ar << det_ << lena_ << lenb_;
+      if (BinaryOArchive* binary = BinaryOArchive::attached(ar))
+        binary->put(cc(), size());
+      else
+        ar << make_array(cc(), size());
     }
     template<class Archive>
     void load(Archive& ar, const unsigned int) {
       ar >> det_ >> lena_ >> lenb_;
       cc_ = std::unique_ptr<DataType[]>(new DataType[size()]);
       cc_ptr_ = cc_.get();
-      ar >> make_array(cc(), size());
+      if (BinaryIArchive* binary = BinaryIArchive::attached(ar)) {
+        auto in = binary->get<DataType>();
+        assert(in.second == size());
+        std::copy_n(in.first, size(), cc());
+      } else {
+        ar >> make_array(cc(), size());
+      }
     }
 
   public:
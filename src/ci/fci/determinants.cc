@@ -25,6 +25,7 @@
 #include <stdexcept>
 #include <iomanip>
 #include <src/ci/fci/determinants.h>
+#include <src/ci/ciutil/cistringcache.h>
 #include <src/util/combination.hpp>
 #include <src/util/constants.h>
 #include <src/util/math/comb.h>
@@ -38,8 +39,9 @@ const static Comb comb;
 
 using FCIStringSet = CIStringSet<FCIString>;
 
+// strings and single displacement lists are shared among all the determinant spaces with the same (nele, norb)
 Determinants::Determinants(const int norb, const int nelea, const int neleb, const bool compress, const bool mute)
- : Determinants(make_shared<FCIString>(nelea, norb), make_shared<FCIString>(neleb, norb), compress, mute) {
+ : Determinants(FCIStringCache::get(nelea, norb), FCIStringCache::get(neleb, norb), compress, mute) {
 }
 
 
@@ -83,6 +85,12 @@ Determinants::Determinants(shared_ptr<const FCIStringSet> ast, shared_ptr<const
 }
 
 
+void Determinants::register_strings() const {
+  FCIStringCache::insert(alphaspaces_);
+  FCIStringCache::insert(betaspaces_);
+}
+
+
 pair<vector<tuple<int, int, int>>, double> Determinants::spin_adapt(const int spin, bitset<nbit__> alpha, bitset<nbit__> beta) const {
   if (spin < 0)
     swap(alpha, beta);
@@ -105,7 +113,7 @@ pair<vector<tuple<int, int, int>>, double> Determinants::spin_adapt(const int sp
   }
   bitset<nbit__> salpha = numbers_to_bit(salpha_array);
   bitset<nbit__> ualpha = numbers_to_bit(ualpha_array);
-  bitset<nbit__> common_plus_alpha(common.to_ulong() + ualpha.to_ulong());
+  bitset<nbit__> common_plus_alpha = common | ualpha;
 
   // number of unpaired alpha orbitals (minus Ms)
   const int nalpha = salpha.count();
@@ -53,8 +53,12 @@ class Determinants : public Determinants_base<FCIString>,
     void load(Archive& ar, const unsigned int) {
       // links will be re-initialized by the space object
       ar >> boost::serialization::base_object<Determinants_base<FCIString>>(*this);
+      // so that restarted calculations do not rebuild the strings
+      register_strings();
     }
 
+    void register_strings() const;
+
   public:
     Determinants() : Determinants(1,1,1,true,true) { }
     Determinants(const int norb, const int nelea, const int neleb, const bool compress = true, const bool mute = false);
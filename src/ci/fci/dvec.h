@@ -76,11 +76,24 @@ class Dvector : public btas::Tensor3<DataType> {
     }
     template<class Archive>
     void save(Archive& ar, const unsigned int version) const {
-      ar << boost::serialization::base_object<btas::Tensor3<DataType>>(*this) << det_ << lena_ << lenb_ << ij_;
+      if (BinaryOArchive* binary = BinaryOArchive::attached(ar)) {
+        ar << det_ << lena_ << lenb_ << ij_;
+        binary->put(data(), size());
+      } else {
+        ar << boost::serialization::base_object<btas::Tensor3<DataType>>(*this) << det_ << lena_ << lenb_ << ij_;
+      }
     }
     template<class Archive>
     void load(Archive& ar, const unsigned int version) {
-      ar >> boost::serialization::base_object<btas::Tensor3<DataType>>(*this) >> det_ >> lena_ >> lenb_ >> ij_;
+      if (BinaryIArchive* binary = BinaryIArchive::attached(ar)) {
+        ar >> det_ >> lena_ >> lenb_ >> ij_;
+        static_cast<btas::Tensor3<DataType>&>(*this) = btas::Tensor3<DataType>(lenb_, lena_, ij_);
+        auto in = binary->get<DataType>();
+        assert(in.second == size());
+        std::copy_n(in.first, size(), data());
+      } else {
+        ar >> boost::serialization::base_object<btas::Tensor3<DataType>>(*this) >> det_ >> lena_ >> lenb_ >> ij_;
+      }
       DataType* tmp = data();
       for (int i = 0; i != ij_; ++i, tmp += lenb_*lena_)
         dvec_.push_back(std::make_shared<Civector<DataType>>(det_, tmp));
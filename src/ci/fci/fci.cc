@@ -57,6 +57,8 @@ HarrisonZarrabian::HarrisonZarrabian(shared_ptr<const PTree> a, shared_ptr<const
 
 KnowlesHandy::KnowlesHandy(shared_ptr<const PTree> a, shared_ptr<const Geometry> g, shared_ptr<const Reference> b,
                            const int ncore, const int nocc, const int nstate, const bool store) : FCI(a, g, b, ncore, nocc, nstate, store) {
+  symmetry_ = idata_->get<bool>("symmetry", false);
+  irrep_ = idata_->get<int>("irrep", 0);
   update(ref_->coeff());
   if (idata_->get<bool>("only_ints", false)) {
     OArchive ar("ref");
@@ -67,7 +69,7 @@ KnowlesHandy::KnowlesHandy(shared_ptr<const PTree> a, shared_ptr<const Geometry>
 }
 
 
-KnowlesHandy::KnowlesHandy(shared_ptr<const CIWfn> ci, shared_ptr<const Reference> r) {
+KnowlesHandy::KnowlesHandy(shared_ptr<const CIWfn> ci, shared_ptr<const Reference> r) : symmetry_(false), irrep_(0) {
   print_thresh_ = 1.0e-8;
   nelea_ = ci->det()->nelea();
   neleb_ = ci->det()->neleb();
@@ -119,6 +121,7 @@ void FCI::common_init() {
 
   // calculate dipole moments if requested
   dipoles_ = idata_->get<bool>("dipoles", false);
+  ciguess_ = idata_->get<bool>("_ci_guess", false);
 
   // additional charge
   const int charge = idata_->get<int>("charge", 0);
@@ -303,11 +306,19 @@ void FCI::compute() {
     // Creating an initial CI vector
     cc_ = make_shared<Dvec>(det_, nstate_); // B runs first
 
-    // find determinants that have small diagonal energies
-    if (nguess_ <= nstate_)
+    // CI vectors at a neighbouring geometry in finite difference are used as a guess if requested and compatible
+    shared_ptr<const CIWfn> ciwfn = ref_->ciwfn();
+    const bool ciguess = ciguess_ && ciwfn && ciwfn->civectors() && ciwfn->nstates() == nstate_ && ciwfn->ncore() == ncore_ && ciwfn->nact() == norb_
+                                && ciwfn->det()->nelea() == nelea_ && ciwfn->det()->neleb() == neleb_;
+    if (ciguess) {
+      for (int i = 0; i != nstate_; ++i)
+        copy_n(ciwfn->civectors()->data(i)->data(), cc_->data(i)->size(), cc_->data(i)->data());
+    } else if (nguess_ <= nstate_) {
+      // find determinants that have small diagonal energies
       generate_guess(nelea_-neleb_, nstate_, cc_);
-    else
+    } else {
       model_guess(cc_);
+    }
     pdebug.tick_print("guess generation");
 
     // Davidson utility
@@ -390,23 +401,27 @@ void FCI::compute() {
   cc_ = make_shared<Dvec>(*cc);
   cc_->print(print_thresh_);
 
-  if (dipoles_) {
-    compute_rdm12();
-    cout << endl;
-    auto ocoeff = coeff_->slice(0, ncore_+norb_);
-    for (int i = 0; i != nstate_; ++i) {
-      stringstream ss; ss << "state " << i;
-      shared_ptr<const Matrix> mordm = rdm1(i)->rdm1_mat(ncore_);
+  if (dipoles_)
+    compute_dipoles();
+}
+
+
+void FCI::compute_dipoles() {
+  compute_rdm12();
+  cout << endl;
+  auto ocoeff = coeff_->slice(0, ncore_+norb_);
+  for (int i = 0; i != nstate_; ++i) {
+    stringstream ss; ss << "state " << i;
+    shared_ptr<const Matrix> mordm = rdm1(i)->rdm1_mat(ncore_);
+    Dipole dipole(geom_, make_shared<Matrix>(ocoeff * *mordm ^ ocoeff), ss.str());
+    dipole.compute();
+  }
+  for (int i = 0; i != nstate_; ++i)
+    for (int j = 0; j != i; ++j) {
+      stringstream ss; ss << "states " << i << " " << j;
+      compute_rdm12(i, j);
+      shared_ptr<const Matrix> mordm = rdm1(i,j)->rdm1_mat(ncore_, false);
       Dipole dipole(geom_, make_shared<Matrix>(ocoeff * *mordm ^ ocoeff), ss.str());
       dipole.compute();
     }
-    for (int i = 0; i != nstate_; ++i)
-      for (int j = 0; j != i; ++j) {
-        stringstream ss; ss << "states " << i << " " << j;
-        compute_rdm12(i, j);
-        shared_ptr<const Matrix> mordm = rdm1(i,j)->rdm1_mat(ncore_, false);
-        Dipole dipole(geom_, make_shared<Matrix>(ocoeff * *mordm ^ ocoeff), ss.str());
-        dipole.compute();
-      }
-  }
 }
@@ -37,6 +37,8 @@ class FCI : public FCI_base {
     std::shared_ptr<DavidsonDiag<Civec>> davidson_;
 
     bool dipoles_;
+    // if true, CI vectors in the reference are used as a guess (set by the finite-difference driver)
+    bool ciguess_;
 
   private:
     // serialization
@@ -79,6 +81,8 @@ class FCI : public FCI_base {
 
     // print functions
     void print_header() const override;
+    // dipole and transition dipole moments of the converged states
+    void compute_dipoles();
 
   public:
     FCI() { }
@@ -116,6 +120,8 @@ class FCI : public FCI_base {
 
     std::tuple<std::shared_ptr<RDM<1>>, std::shared_ptr<RDM<2>>>
       compute_rdm12_last_step(std::shared_ptr<const Dvec>, std::shared_ptr<const Dvec>, std::shared_ptr<const Civec>) const;
+    // sorts the 2RDM <I|E_ij|0><I|E_kl|0> obtained by dgemm and subtracts the one-electron part
+    void sort_rdm2(std::shared_ptr<const RDM<1>> rdm1, std::shared_ptr<RDM<2>> rdm2) const;
 
     // rdm ci derivatives
     std::shared_ptr<Dvec> rdm1deriv(const int istate) const override;
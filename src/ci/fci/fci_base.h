@@ -109,6 +109,8 @@ class FCI_base : public Method {
     std::shared_ptr<const Matrix> coeff() const { return coeff_; }
     virtual std::shared_ptr<const Civec> denom() const = 0;
     virtual std::shared_ptr<const Dvec> civectors() const = 0;
+    // irreps of the active orbitals if the determinant space is blocked by symmetry (empty otherwise)
+    virtual std::vector<int> orbital_irrep() const { return std::vector<int>(); }
 
     std::vector<double> energy() const { return energy_; }
     double energy(const int i) const { return energy_.at(i); }
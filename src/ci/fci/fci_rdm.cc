@@ -143,6 +143,12 @@ FCI::compute_rdm12_last_step(shared_ptr<const Dvec> dbra, shared_ptr<const Dvec>
     btas::contract(1.0, dbrav, {1,0}, dketv, {1,2}, 0.0, rdm2t, {0,2});
   }
 
+  sort_rdm2(rdm1, rdm2);
+  return tie(rdm1, rdm2);
+}
+
+
+void FCI::sort_rdm2(shared_ptr<const RDM<1>> rdm1, shared_ptr<RDM<2>> rdm2) const {
   // sorting... a bit stupid but cheap anyway
   // This is since we transpose operator pairs in dgemm - cheaper to do so after dgemm (usually Nconfig >> norb_**2).
   unique_ptr<double[]> buf(new double[norb_*norb_]);
@@ -159,8 +165,6 @@ FCI::compute_rdm12_last_step(shared_ptr<const Dvec> dbra, shared_ptr<const Dvec>
     for (int k = 0; k != norb_; ++k)
       for (int j = 0; j != norb_; ++j)
         rdm2->element(j,k,k,i) -= rdm1->element(j,i);
-
-  return tie(rdm1, rdm2);
 }
 
 
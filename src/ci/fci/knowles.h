@@ -29,15 +29,26 @@
 #ifndef __BAGEL_FCI_KNOWLESHANDY_H
 #define __BAGEL_FCI_KNOWLESHANDY_H
 
+#include <functional>
 #include <src/ci/fci/fci.h>
+#include <src/ci/fci/symcivec.h>
 
 namespace bagel {
 
 class KnowlesHandy : public FCI {
 
   protected:
+    // if true, only the determinants of the irrep irrep_ are used (abelian point groups; see SymDeterminants)
+    bool symmetry_;
+    int irrep_;
+    std::shared_ptr<const SymDeterminants> symdet_;
+    std::shared_ptr<SymCivec> symdenom_;
+    std::vector<std::shared_ptr<SymCivec>> symcc_;
+
     // denominator
     void const_denom() override;
+    // averaged diagonal element for a pair of alpha and beta strings
+    std::function<double(const std::bitset<nbit__>&, const std::bitset<nbit__>&)> denom_function() const;
 
     // virtual application of Hamiltonian
     std::shared_ptr<Dvec> form_sigma(std::shared_ptr<const Dvec> c, std::shared_ptr<const MOFile> jop, const std::vector<int>& conv) const override;
@@ -49,6 +60,17 @@ class KnowlesHandy : public FCI {
     void sigma_2c1(std::shared_ptr<Civec> sigma, std::shared_ptr<const Dvec> e) const;
     void sigma_2c2(std::shared_ptr<Civec> sigma, std::shared_ptr<const Dvec> e) const;
 
+    // the same in the symmetry-blocked space; D and E intermediates are matrices (determinants x orbital pairs) for each pair irrep
+    void init_symmetry();
+    void compute_symmetry();
+    void generate_guess_symmetry();
+    std::vector<std::shared_ptr<SymCivec>> form_sigma(const std::vector<std::shared_ptr<SymCivec>>& c, const std::vector<int>& conv) const;
+    void sigma_1(std::shared_ptr<const SymCivec> cc, std::shared_ptr<SymCivec> sigma) const;
+    void sigma_3(std::shared_ptr<const SymCivec> cc, std::shared_ptr<SymCivec> sigma) const;
+    std::vector<std::shared_ptr<Matrix>> sigma_2a(std::shared_ptr<const SymCivec> cc, const bool compressed) const;
+    std::vector<std::shared_ptr<Matrix>> sigma_2b(const std::vector<std::shared_ptr<Matrix>>& d) const;
+    void sigma_2c(std::shared_ptr<SymCivec> sigma, const std::vector<std::shared_ptr<Matrix>>& e) const;
+
   private:
     friend class boost::serialization::access;
     template<class Archive>
@@ -59,18 +81,21 @@ class KnowlesHandy : public FCI {
     void save(Archive& ar, const unsigned int) const {
       ar << boost::serialization::base_object<FCI>(*this);
       std::shared_ptr<const Matrix> coeff = jop_->coeff();
-      ar << coeff;
+      ar << coeff << symmetry_ << irrep_;
     }
     template<class Archive>
-    void load(Archive& ar, const unsigned int) {
+    void load(Archive& ar, const unsigned int version) {
       ar >> boost::serialization::base_object<FCI>(*this);
       std::shared_ptr<const Matrix> coeff;
       ar >> coeff;
+      // archives written before version 1 are without symmetry
+      if (version > 0)
+        ar >> symmetry_ >> irrep_;
       update(coeff);
     }
 
   public:
-    KnowlesHandy() { }
+    KnowlesHandy() : symmetry_(false), irrep_(0) { }
 
     KnowlesHandy(std::shared_ptr<const PTree> a, std::shared_ptr<const Geometry> g, std::shared_ptr<const Reference> b,
         const int ncore = -1, const int nocc = -1, const int nstate = -1, const bool store = false);
@@ -78,12 +103,21 @@ class KnowlesHandy : public FCI {
     KnowlesHandy(std::shared_ptr<const CIWfn> ci, std::shared_ptr<const Reference> r);
 
     void update(std::shared_ptr<const Matrix>) override;
+
+    void compute() override;
+    using FCI::compute_rdm12;
+    void compute_rdm12(const int ist, const int jst) override;
+
+    std::shared_ptr<const Civec> denom() const override;
+    std::vector<int> orbital_irrep() const override { return symdet_ ? symdet_->orbital_irrep() : std::vector<int>(); }
 };
 
 }
 
 #include <src/util/archive.h>
+#include <boost/serialization/version.hpp>
 BOOST_CLASS_EXPORT_KEY(bagel::KnowlesHandy)
+BOOST_CLASS_VERSION(bagel::KnowlesHandy, 1)
 
 #endif
 
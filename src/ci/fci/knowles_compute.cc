@@ -187,3 +187,138 @@ void KnowlesHandy::sigma_2b(shared_ptr<Dvec> d, shared_ptr<Dvec> e, shared_ptr<c
                                   0.0, e->data(), lenab);
 }
 
+
+
+// Sigma in the symmetry-blocked determinant space (see SymDeterminants). The integrals vanish unless the orbital pairs
+// are totally symmetric (one-electron part) or belong to the same irrep (two-electron part).
+vector<shared_ptr<SymCivec>> KnowlesHandy::form_sigma(const vector<shared_ptr<SymCivec>>& ccvec, const vector<int>& conv) const {
+  vector<shared_ptr<SymCivec>> sigmavec;
+  for (int istate = 0; istate != nstate_; ++istate) {
+    Timer pdebug(3);
+    shared_ptr<SymCivec> sigma = ccvec[istate]->clone();
+    sigmavec.push_back(sigma);
+    if (conv[istate]) continue;
+    shared_ptr<const SymCivec> cc = ccvec[istate];
+
+    // (task1) one-electron alpha: sigma(Psib, Psi'a) += sign h'(ij) C(Psib, Psia)
+    sigma_1(cc, sigma);
+    pdebug.tick_print("task1");
+
+    // (task2a) D(Phib, Phia, ij) += sign C(Psib, Phi'a) + sign C(Psib', Phia)
+    vector<shared_ptr<Matrix>> d = sigma_2a(cc, /*compressed=*/true);
+    pdebug.tick_print("task2a");
+
+    // (task2b) E(Phib, Phia, kl) = D(Psib, Phia, ij) (ij|kl)
+    vector<shared_ptr<Matrix>> e = sigma_2b(d);
+    pdebug.tick_print("task2b");
+
+    // (task2c) sigma(Phib, Phia') += sign E(Psib, Phia, kl) and sigma(Phib', Phia) += sign E(Psib, Phia, kl)
+    sigma_2c(sigma, e);
+    pdebug.tick_print("task2c");
+
+    // (task3) one-electron beta: sigma(Psib', Psia) += sign h'(ij) C(Psib, Psia)
+    sigma_3(cc, sigma);
+    pdebug.tick_print("task3");
+  }
+  return sigmavec;
+}
+
+void KnowlesHandy::sigma_1(shared_ptr<const SymCivec> cc, shared_ptr<SymCivec> sigma) const {
+  const int sym = cc->sym();
+  for (auto& ip : symdet_->pairs(0)) {
+    const double h = jop_->mo1e(ip);
+    for (auto& iter : symdet_->phia(ip)) {
+      const double hc = h * iter.sign;
+      blas::ax_plus_y_n(hc, cc->column(iter.source), symdet_->lenb(sym, iter.source), sigma->column(iter.target));
+    }
+  }
+}
+
+void KnowlesHandy::sigma_3(shared_ptr<const SymCivec> cc, shared_ptr<SymCivec> sigma) const {
+  const int sym = cc->sym();
+  for (size_t i = 0; i != det_->lena(); ++i) {
+    double* const target_array0 = sigma->column(i);
+    const double* const source_array0 = cc->column(i);
+    const int irrepb = symdet_->product(symdet_->irrep_a(i), sym);
+    for (auto& ip : symdet_->pairs(0)) {
+      const double h = jop_->mo1e(ip);
+      for (auto& iter : symdet_->phib(ip, irrepb)) {
+        const double hc = h * iter.sign;
+        target_array0[iter.target] += hc * source_array0[iter.source];
+      }
+    }
+  }
+}
+
+// D intermediates (determinants x pairs) for the pairs in each irrep; the uncompressed pairs are used for RDMs
+vector<shared_ptr<Matrix>> KnowlesHandy::sigma_2a(shared_ptr<const SymCivec> cc, const bool compressed) const {
+  const int sym = cc->sym();
+  vector<shared_ptr<Matrix>> d;
+  for (int g = 0; g != symdet_->nirrep(); ++g) {
+    const vector<int>& pairs = compressed ? symdet_->pairs(g) : symdet_->pairs_uncompressed(g);
+    const int dsym = symdet_->product(g, sym);
+    auto dg = make_shared<Matrix>(symdet_->size(dsym), pairs.size(), /*localized=*/true);
+    for (size_t n = 0; n != pairs.size(); ++n) {
+      const int ip = pairs[n];
+      double* const target_base = dg->element_ptr(0, n);
+      for (auto& iter : compressed ? symdet_->phia(ip) : symdet_->phia(ip%norb_, ip/norb_)) {
+        const double sign = static_cast<double>(iter.sign);
+        blas::ax_plus_y_n(sign, cc->column(iter.target), symdet_->lenb(sym, iter.target), target_base + symdet_->column(dsym, iter.source));
+      }
+      for (size_t i = 0; i != det_->lena(); ++i) {
+        const double* const source_array0 = cc->column(i);
+        double* const target_array0 = target_base + symdet_->column(dsym, i);
+        const int irrepb = symdet_->product(symdet_->irrep_a(i), sym);
+        for (auto& iter : compressed ? symdet_->phib(ip, irrepb) : symdet_->phib(ip%norb_, ip/norb_, irrepb)) {
+          const double sign = static_cast<double>(iter.sign);
+          target_array0[iter.source] += sign * source_array0[iter.target];
+        }
+      }
+    }
+    d.push_back(dg);
+  }
+  return d;
+}
+
+vector<shared_ptr<Matrix>> KnowlesHandy::sigma_2b(const vector<shared_ptr<Matrix>>& d) const {
+  vector<shared_ptr<Matrix>> e;
+  for (int g = 0; g != symdet_->nirrep(); ++g) {
+    const vector<int>& pairs = symdet_->pairs(g);
+    const int np = pairs.size();
+    auto eg = d[g]->clone();
+    if (eg->size()) {
+      Matrix mo2e(np, np, /*localized=*/true);
+      for (int k = 0; k != np; ++k)
+        for (int i = 0; i != np; ++i)
+          mo2e(i, k) = jop_->mo2e(pairs[i], pairs[k]);
+      dgemm_("n", "n", eg->ndim(), np, np, 0.5, d[g]->data(), d[g]->ndim(), mo2e.data(), np,
+                                           0.0, eg->data(), eg->ndim());
+    }
+    e.push_back(eg);
+  }
+  return e;
+}
+
+void KnowlesHandy::sigma_2c(shared_ptr<SymCivec> sigma, const vector<shared_ptr<Matrix>>& e) const {
+  const int sym = sigma->sym();
+  for (int g = 0; g != symdet_->nirrep(); ++g) {
+    const vector<int>& pairs = symdet_->pairs(g);
+    const int esym = symdet_->product(g, sym);
+    for (size_t n = 0; n != pairs.size(); ++n) {
+      const int ip = pairs[n];
+      const double* const source_base = e[g]->element_ptr(0, n);
+      for (auto& iter : symdet_->phia(ip)) {
+        const double sign = static_cast<double>(iter.sign);
+        blas::ax_plus_y_n(sign, source_base + symdet_->column(esym, iter.source), symdet_->lenb(esym, iter.source), sigma->column(iter.target));
+      }
+      for (size_t i = 0; i != det_->lena(); ++i) {
+        double* const target_array0 = sigma->column(i);
+        const double* const source_array0 = source_base + symdet_->column(esym, i);
+        for (auto& iter : symdet_->phib(ip, symdet_->product(symdet_->irrep_a(i), sym))) {
+          const double sign = static_cast<double>(iter.sign);
+          target_array0[iter.target] += sign * source_array0[iter.source];
+        }
+      }
+    }
+  }
+}
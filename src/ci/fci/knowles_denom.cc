@@ -29,6 +29,7 @@
 #include <src/ci/fci/mofile.h>
 #include <src/util/combination.hpp>
 #include <iostream>
+#include <functional>
 
 using namespace std;
 using namespace bagel;
@@ -36,7 +37,7 @@ using namespace bagel;
 //
 // averaged diagonal elements as defined in Knowles & Handy (1989) Compt. Phys. Comm.
 //
-void KnowlesHandy::const_denom() {
+function<double(const bitset<nbit__>&, const bitset<nbit__>&)> KnowlesHandy::denom_function() const {
   vector<double> jop, kop, fk;
   jop.resize(norb_*norb_);
   kop.resize(norb_*norb_);
@@ -57,36 +58,69 @@ void KnowlesHandy::const_denom() {
       fk[i] += kop[i*norb_+j];
     }
   }
+  vector<double> h(norb_);
+  for (int i = 0; i != norb_; ++i)
+    h[i] = jop_->mo1e(i,i);
 
-  denom_ = make_shared<Civec>(det());
+  const int norb = norb_;
   const int nspin = det()->nspin();
   const int nspin2 = nspin*nspin;
 
-  double* iter = denom_->data();
-  for (auto& ia : det()->string_bits_a()) {
-    for (auto& ib : det()->string_bits_b()) {
-      const int nopen = (ia^ib).count();
-      const double F = (nopen >> 1) ? (static_cast<double>(nspin2 - nopen)/(nopen*(nopen-1))) : 0.0;
-      *iter = 0.0;
-      for (int i = 0; i != norb_; ++i) {
-        const int nia = ia[i];
-        const int nib = ib[i];
-        const int niab = nia + nib;
-        const int Ni = (nia ^ nib);
-        for (int j = 0; j != i; ++j) {
-          const int nja = ia[j];
-          const int njb = ib[j];
-          const int Nj = (nja ^ njb);
-          const int addj = niab * (nja + njb);
-          *iter += jop[j+norb_*i] * 2.0 * addj - kop[j+norb_*i] * (F*Ni*Nj + addj);
-        }
-        *iter += (jop_->mo1e(i,i) + fk[i]) * niab - kop[i+norb_*i] * 0.5 * (Ni - niab*niab);
+  return [=](const bitset<nbit__>& ia, const bitset<nbit__>& ib) {
+    const int nopen = (ia^ib).count();
+    const double F = (nopen >> 1) ? (static_cast<double>(nspin2 - nopen)/(nopen*(nopen-1))) : 0.0;
+    double out = 0.0;
+    for (int i = 0; i != norb; ++i) {
+      const int nia = ia[i];
+      const int nib = ib[i];
+      const int niab = nia + nib;
+      const int Ni = (nia ^ nib);
+      for (int j = 0; j != i; ++j) {
+        const int nja = ia[j];
+        const int njb = ib[j];
+        const int Nj = (nja ^ njb);
+        const int addj = niab * (nja + njb);
+        out += jop[j+norb*i] * 2.0 * addj - kop[j+norb*i] * (F*Ni*Nj + addj);
       }
-      ++iter;
+      out += (h[i] + fk[i]) * niab - kop[i+norb*i] * 0.5 * (Ni - niab*niab);
     }
+    return out;
+  };
+}
+
+
+void KnowlesHandy::const_denom() {
+  const auto diagonal = denom_function();
+  if (symdet_) {
+    symdenom_ = make_shared<SymCivec>(symdet_, irrep_);
+    for (size_t ia = 0; ia != det()->lena(); ++ia) {
+      double* iter = symdenom_->column(ia);
+      for (auto& ib : symdet_->strings_b(symdet_->product(symdet_->irrep_a(ia), irrep_)))
+        *iter++ = diagonal(det()->string_bits_a(ia), det()->string_bits_b(ib));
+    }
+  } else {
+    denom_ = make_shared<Civec>(det());
+    double* iter = denom_->data();
+    for (auto& ia : det()->string_bits_a())
+      for (auto& ib : det()->string_bits_b())
+        *iter++ = diagonal(ia, ib);
   }
 }
 
+
+shared_ptr<const Civec> KnowlesHandy::denom() const {
+  if (!symdet_)
+    return denom_;
+  // with symmetry the full diagonal is only made on request (e.g., in CP-CASSCF)
+  const auto diagonal = denom_function();
+  auto out = make_shared<Civec>(det());
+  double* iter = out->data();
+  for (auto& ia : det()->string_bits_a())
+    for (auto& ib : det()->string_bits_b())
+      *iter++ = diagonal(ia, ib);
+  return out;
+}
+
 void KnowlesHandy::update(shared_ptr<const Matrix> c) {
   // iiii file to be created (MO transformation).
   // now jop_->mo1e() and jop_->mo2e() contains one and two body part of Hamiltonian
@@ -97,5 +131,7 @@ void KnowlesHandy::update(shared_ptr<const Matrix> c) {
   // right now full basis is used.
   cout << "    * Integral transformation done. Elapsed time: " << setprecision(2) << timer.tick() << endl << endl;
 
+  if (symmetry_)
+    init_symmetry();
   const_denom();
 }
@@ -0,0 +1,272 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: knowles_sym.cc
+// Copyright (C) 2011 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <src/ci/fci/knowles.h>
+#include <src/molecule/petite.h>
+
+using namespace std;
+using namespace bagel;
+
+void KnowlesHandy::init_symmetry() {
+  shared_ptr<const Petite> plist = geom_->plist();
+  const int nirrep = plist->nirrep();
+  if (irrep_ < 0 || irrep_ >= nirrep)
+    throw runtime_error("FCI: irrep of the target states is out of range");
+
+  vector<int> orbital_irrep;
+  for (int i = ncore_; i != ncore_+norb_; ++i) {
+    const int irrep = plist->orbital_irrep(coeff_->element_ptr(0, i));
+    if (irrep < 0)
+      throw runtime_error("FCI: active orbitals are not symmetry adapted (use symmetry in the molecule and HF blocks as well)");
+    orbital_irrep.push_back(irrep);
+  }
+  // the string lists are reused as long as the active orbitals keep their irreps
+  if (symdet_ && symdet_->orbital_irrep() == orbital_irrep)
+    return;
+
+  vector<int> product(nirrep*nirrep);
+  for (int b = 0; b != nirrep; ++b)
+    for (int a = 0; a != nirrep; ++a)
+      product[a+nirrep*b] = plist->product(a, b);
+  symdet_ = make_shared<const SymDeterminants>(det_, orbital_irrep, product);
+
+  cout << "    * Determinant space of irrep " << irrep_ << " (" << plist->sym() << "): " << symdet_->size(irrep_)
+       << " of " << det_->size() << " determinants" << endl << endl;
+}
+
+
+void KnowlesHandy::generate_guess_symmetry() {
+  symcc_.clear();
+  size_t ndet = nstate_*10;
+  while (true) {
+    // allowed determinants with the lowest diagonal elements
+    multimap<double, pair<size_t, size_t>> seeds;
+    for (size_t ia = 0; ia != det_->lena(); ++ia) {
+      const double* d = symdenom_->column(ia);
+      for (auto& ib : symdet_->strings_b(symdet_->product(symdet_->irrep_a(ia), irrep_))) {
+        seeds.emplace(*d++, make_pair(ia, ib));
+        if (seeds.size() > ndet)
+          seeds.erase(prev(seeds.end()));
+      }
+    }
+
+    // Spin adapt detseeds
+    vector<bitset<nbit__>> done_open;
+    vector<bitset<nbit__>> done_closed;
+    for (auto& it : seeds) {
+      bitset<nbit__> alpha = det_->string_bits_a(it.second.first);
+      bitset<nbit__> beta = det_->string_bits_b(it.second.second);
+      bitset<nbit__> open_bit = (alpha^beta);
+      bitset<nbit__> closed_bit = (alpha&beta);
+
+      // make sure that we have enough unpaired alpha
+      const int unpairalpha = (alpha ^ (alpha & beta)).count();
+      const int unpairbeta  = (beta ^ (alpha & beta)).count();
+      if (unpairalpha-unpairbeta < nelea_-neleb_) continue;
+
+      // check if this orbital configuration is already used
+      if ((find(done_open.begin(), done_open.end(), open_bit) != done_open.end()) && (find(done_closed.begin(), done_closed.end(), closed_bit) != done_closed.end())) continue;
+      done_open.push_back(open_bit);
+      done_closed.push_back(closed_bit);
+
+      // spin flips within the open shells do not change the irrep of the determinant
+      pair<vector<tuple<int, int, int>>, double> adapt = det()->spin_adapt(nelea_-neleb_, alpha, beta);
+      const double fac = adapt.second;
+      auto cc = make_shared<SymCivec>(symdet_, irrep_);
+      for (auto& iter : adapt.first)
+        cc->column(get<1>(iter))[symdet_->index_b(get<0>(iter))] = get<2>(iter)*fac;
+      cc->spin_decontaminate();
+
+      cout << "     guess " << setw(3) << symcc_.size() << ":   closed " <<
+            setw(20) << left << print_bit(closed_bit, norb_) << " open " << setw(20) << print_bit(open_bit, norb_) << right << endl;
+
+      symcc_.push_back(cc);
+      if (symcc_.size() == static_cast<size_t>(nstate_)) break;
+    }
+    if (symcc_.size() == static_cast<size_t>(nstate_))
+      break;
+    if (seeds.size() < ndet)
+      throw runtime_error("FCI: not enough determinants of this irrep for the requested number of states");
+    symcc_.clear();
+    ndet *= 4;
+  }
+  cout << endl;
+}
+
+
+void KnowlesHandy::compute() {
+  if (symmetry_)
+    compute_symmetry();
+  else
+    FCI::compute();
+}
+
+
+// the same as FCI::compute except that the vectors only contain the determinants of irrep_
+void KnowlesHandy::compute_symmetry() {
+  Timer pdebug(3);
+
+  // CI vectors in the archive or at a neighbouring geometry in finite difference are projected onto this irrep and used as a guess
+  shared_ptr<const Dvec> guess = restarted_ ? cc_ : nullptr;
+  shared_ptr<const CIWfn> ciwfn = ref_->ciwfn();
+  if (!guess && ciguess_ && ciwfn && ciwfn->civectors() && ciwfn->nstates() == nstate_ && ciwfn->ncore() == ncore_ && ciwfn->nact() == norb_
+                         && ciwfn->det()->nelea() == nelea_ && ciwfn->det()->neleb() == neleb_)
+    guess = ciwfn->civectors();
+  symcc_.clear();
+  if (guess) {
+    for (int i = 0; i != nstate_; ++i) {
+      auto cc = make_shared<SymCivec>(symdet_, irrep_, *guess->data(i));
+      if (cc->norm() < 1.0e-8) break;
+      cc->normalize();
+      symcc_.push_back(cc);
+    }
+  }
+  if (symcc_.size() != static_cast<size_t>(nstate_))
+    generate_guess_symmetry();
+  pdebug.tick_print("guess generation");
+
+  // Davidson utility
+  DavidsonDiag<SymCivec> davidson(nstate_, davidson_subspace_);
+
+  // nuclear energy retrieved from geometry
+  const double nuc_core = geom_->nuclear_repulsion() + jop_->core_energy();
+
+  // main iteration starts here
+  cout << "  === FCI iteration ===" << endl << endl;
+  // 0 means not converged
+  vector<int> conv(nstate_, 0);
+
+  for (int iter = 0; iter != max_iter_; ++iter) {
+    Timer fcitime;
+
+    // form a sigma vector given cc
+    vector<shared_ptr<SymCivec>> sigma = form_sigma(symcc_, conv);
+    pdebug.tick_print("sigma vector");
+
+    vector<shared_ptr<const SymCivec>> ccn, sigman;
+    for (int i = 0; i != nstate_; ++i) {
+      ccn.push_back(conv[i] ? nullptr : symcc_[i]);
+      sigman.push_back(conv[i] ? nullptr : sigma[i]);
+    }
+    const vector<double> energies = davidson.compute(ccn, sigman);
+
+    // get residual and new vectors
+    vector<shared_ptr<SymCivec>> errvec = davidson.residual();
+    pdebug.tick_print("davidson");
+
+    // compute errors (rms over the full determinant space, in which the other irreps are zero)
+    vector<double> errors;
+    for (int i = 0; i != nstate_; ++i) {
+      errors.push_back(errvec[i]->norm() / sqrt(static_cast<double>(det_->size())));
+      conv[i] = static_cast<int>(errors[i] < thresh_);
+    }
+    pdebug.tick_print("error");
+
+    if (!*min_element(conv.begin(), conv.end())) {
+      // denominator scaling
+      for (int ist = 0; ist != nstate_; ++ist) {
+        if (conv[ist]) continue;
+        auto cc = errvec[ist]->clone();
+        const size_t size = cc->size();
+        double* target_array = cc->data();
+        const double* source_array = errvec[ist]->data();
+        const double* denom_array = symdenom_->data();
+        const double en = energies[ist];
+        for (size_t i = 0; i != size; ++i) {
+          target_array[i] = source_array[i] / min(en - denom_array[i], -0.1);
+        }
+        cc->normalize();
+        cc->spin_decontaminate();
+        cc->synchronize();
+        symcc_[ist] = cc;
+      }
+    }
+    pdebug.tick_print("denominator");
+
+    // printing out
+    if (nstate_ != 1 && iter) cout << endl;
+    for (int i = 0; i != nstate_; ++i) {
+      cout << setw(7) << iter << setw(3) << i << setw(2) << (conv[i] ? "*" : " ")
+                              << setw(17) << fixed << setprecision(8) << energies[i]+nuc_core << "   "
+                              << setw(10) << scientific << setprecision(2) << errors[i] << fixed << setw(10) << setprecision(2)
+                              << fcitime.tick() << endl;
+      energy_[i] = energies[i]+nuc_core;
+    }
+    if (*min_element(conv.begin(), conv.end())) break;
+  }
+  // main iteration ends here
+
+  symcc_ = davidson.civec();
+
+  // full CI vectors are made once for the other methods (CIWfn, 3RDM and 4RDM, derivatives)
+  cc_ = make_shared<Dvec>(det_, nstate_);
+  for (int i = 0; i != nstate_; ++i)
+    *cc_->data(i) = *symcc_[i]->expand();
+  cc_->print(print_thresh_);
+
+  if (dipoles_)
+    compute_dipoles();
+}
+
+
+void KnowlesHandy::compute_rdm12(const int ist, const int jst) {
+  if (!symmetry_) {
+    FCI::compute_rdm12(ist, jst);
+    return;
+  }
+  if (symcc_.size() != static_cast<size_t>(nstate_)) {
+    symcc_.clear();
+    for (int i = 0; i != nstate_; ++i)
+      symcc_.push_back(make_shared<SymCivec>(symdet_, irrep_, *cc_->data(i)));
+  }
+  shared_ptr<const SymCivec> cbra = symcc_[ist];
+  shared_ptr<const SymCivec> cket = symcc_[jst];
+
+  // <I|E_ij|0> for the pairs ij in each irrep
+  vector<shared_ptr<Matrix>> dbra = sigma_2a(cbra, /*compressed=*/false);
+  vector<shared_ptr<Matrix>> dket = ist == jst ? dbra : sigma_2a(cket, false);
+
+  // 1RDM c^dagger <I|\hat{E}|0> (totally symmetric pairs only)
+  // 2RDM \sum_I <0|\hat{E}|I> <I|\hat{E}|0> (pairs in the same irrep only)
+  auto rdm1 = make_shared<RDM<1>>(norb_);
+  auto rdm2 = make_shared<RDM<2>>(norb_);
+  const vector<int>& pairs0 = symdet_->pairs_uncompressed(0);
+  for (size_t n = 0; n != pairs0.size(); ++n)
+    rdm1->data()[pairs0[n]] = blas::dot_product(dket[0]->element_ptr(0, n), cbra->size(), cbra->data());
+
+  const int norb2 = norb_*norb_;
+  for (int g = 0; g != symdet_->nirrep(); ++g) {
+    if (!dbra[g]->size()) continue;
+    const Matrix block = *dbra[g] % *dket[g];
+    const vector<int>& pairs = symdet_->pairs_uncompressed(g);
+    for (size_t k = 0; k != pairs.size(); ++k)
+      for (size_t i = 0; i != pairs.size(); ++i)
+        rdm2->data()[pairs[i]+pairs[k]*norb2] = block(i, k);
+  }
+  sort_rdm2(rdm1, rdm2);
+
+  // setting to private members.
+  rdm1_->emplace(ist, jst, rdm1);
+  rdm2_->emplace(ist, jst, rdm2);
+}
@@ -182,7 +182,7 @@ namespace bagel {
 class CISpinTask : public CITask<CISpinTask> {
   protected:
     int sign(const bitset<nbit__>& bit1, const bitset<nbit__>& bit2, const int& i) const {
-      const bitset<nbit__> mask((1ull << i) - 1);
+      const bitset<nbit__> mask = ~(~bitset<nbit__>(0ull) << i);
       const int n = (mask & bit1).count() + (mask & bit2).count();
       return (1 - 2*(n%2));
     }
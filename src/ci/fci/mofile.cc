@@ -86,7 +86,7 @@ void MOFile::compress_and_set(shared_ptr<const Matrix> buf1e, shared_ptr<const M
   // mo2e is compressed in KH case, not in HZ case
   const int nocc = nocc_;
   sizeij_ = hz_ ? nocc*nocc : nocc*(nocc+1)/2;
-  mo2e_ = make_shared<Matrix>(sizeij_, sizeij_, true);
+  auto mo2e = make_shared<Matrix>(sizeij_, sizeij_, true);
 
   if (!hz_) {
     int ij = 0;
@@ -95,15 +95,17 @@ void MOFile::compress_and_set(shared_ptr<const Matrix> buf1e, shared_ptr<const M
         int kl = 0;
         for (int k = 0; k != nocc; ++k)
           for (int l = 0; l <= k; ++l, ++kl)
-            mo2e(kl, ij) = buf2e->element(l+k*nocc, j+i*nocc);
+            mo2e->element(kl, ij) = buf2e->element(l+k*nocc, j+i*nocc);
       }
     }
   } else {
     // In this case, there is no compression (this is actually necessary)
     // Is currently ordered like (ij|kl), should be ordered like (ik|jl), with the last index moving the fastest
     // Equivalent to             <ik|jl> --> <ij|kl>
-    sort_indices<0,2,1,3,0,1,1,1>(buf2e->data(), mo2e_->data(), nocc_, nocc_, nocc_, nocc_);
+    sort_indices<0,2,1,3,0,1,1,1>(buf2e->data(), mo2e->data(), nocc_, nocc_, nocc_, nocc_);
   }
+  // read-only from here on; stored once per node if there are several processes on it
+  mo2e_ = mo2e->node_copy();
 
   // h'kl = hkl - 0.5 sum_j (kj|jl)
   mo1e_ = make_shared<CSymMatrix>(nocc, true);
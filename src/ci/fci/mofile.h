@@ -48,8 +48,8 @@ class MOFile {
     std::shared_ptr<const Matrix> core_fock_;
     // mo1e is a compressed symmetric matrix
     std::shared_ptr<CSymMatrix> mo1e_;
-    // mo2e is a matrix of sizeij_*sizeij_
-    std::shared_ptr<Matrix> mo2e_;
+    // mo2e is a matrix of sizeij_*sizeij_ (read-only; may be shared by the processes on a node)
+    std::shared_ptr<const Matrix> mo2e_;
 
     std::shared_ptr<DFHalfDist> mo2e_1ext_;
 
@@ -72,7 +72,7 @@ class MOFile {
     MOFile(const std::shared_ptr<const Reference>, const std::string method = std::string("KH"));
     MOFile(const std::shared_ptr<const Reference>, const std::shared_ptr<const Matrix>, const std::string method = std::string("KH"));
     // Shortcut used in MEH
-    MOFile(const std::shared_ptr<CSymMatrix> mo1e, const std::shared_ptr<Matrix> mo2e) : nocc_(mo1e->nocc()), hz_(true), mo1e_(mo1e), mo2e_(mo2e) {}
+    MOFile(const std::shared_ptr<CSymMatrix> mo1e, const std::shared_ptr<const Matrix> mo2e) : nocc_(mo1e->nocc()), hz_(true), mo1e_(mo1e), mo2e_(mo2e) {}
 
     const std::shared_ptr<const Geometry> geom() const { return geom_; }
 
@@ -80,24 +80,19 @@ class MOFile {
     std::shared_ptr<const CSymMatrix> mo1e() const { return mo1e_; }
     std::shared_ptr<const Matrix> mo2e() const { return mo2e_; }
     double& mo1e(const size_t i) { return mo1e_->data(i); }
-    double& mo2e(const size_t i, const size_t j) { return mo2e_->element(i,j); }
     const double& mo1e(const size_t i) const { return mo1e_->data(i); }
     const double& mo2e(const size_t i, const size_t j) const { return mo2e_->element(i,j); }
     // input in (ij|kl), accesses the right way
     const double& mo2e(size_t i, size_t j, size_t k, size_t l) const { return (hz_ ? mo2e_hz(i, k, j, l) : mo2e_kh(i, j, k, l)); }
     // This is really ugly but will work until I can think of some elegant solution that keeps mo2e(i,j,k,l) inline but doesn't require more derived classes
     // strictly i <= j, k <= l
-    double& mo2e_kh(const int i, const int j, const int k, const int l) { return mo2e(address_(i,j), address_(k,l)); }
     const double& mo2e_kh(const int i, const int j, const int k, const int l) const { return mo2e(address_(i,j), address_(k,l)); }
     // This is in <ij|kl> == (ik|jl) format
-    double& mo2e_hz(const int i, const int j, const int k, const int l) { return mo2e_->element(i+nocc_*j, k+nocc_*l); }
-    double& mo2e_hz(const int ij, const int kl) { return mo2e_->element(ij, kl); }
     double& mo1e(const int i, const int j) { return mo1e_->element(i,j); }
     const double& mo2e_hz(const int i, const int j, const int k, const int l) const { return mo2e_->element(i+nocc_*j, k+nocc_*l); }
     const double& mo2e_hz(const int ij, const int kl) const { return mo2e_->element(ij, kl); }
     const double& mo1e(const int i, const int j) const { return mo1e_->element(i,j); }
     double* mo1e_ptr() { return mo1e_->data(); }
-    double* mo2e_ptr() { return mo2e_->data(); }
     const double* mo1e_ptr() const { return mo1e_->data(); }
     const double* mo2e_ptr() const { return mo2e_->data(); }
 
@@ -123,7 +118,7 @@ class Jop : public MOFile {
   public:
     Jop(const std::shared_ptr<const Reference> b, const int c, const int d, std::shared_ptr<const Matrix> e, const bool store, const std::string f = "KH")
       : MOFile(b,e,f) { init(c, d, store); }
-    Jop(const std::shared_ptr<CSymMatrix> mo1e, const std::shared_ptr<Matrix> mo2e) : MOFile(mo1e, mo2e) {}
+    Jop(const std::shared_ptr<CSymMatrix> mo1e, const std::shared_ptr<const Matrix> mo2e) : MOFile(mo1e, mo2e) {}
 };
 
 
@@ -25,6 +25,7 @@
 #include <stdexcept>
 #include <src/ci/fci/determinants.h>
 #include <src/ci/fci/space.h>
+#include <src/ci/ciutil/cistringcache.h>
 #include <src/util/math/comb.h>
 #include <src/util/combination.hpp>
 
@@ -39,17 +40,10 @@ HZSpace::HZSpace(const int norb, const int nelea, const int neleb, const bool co
                   << " alpha and " << neleb << " beta electrons." << endl << endl;
 
   assert(neleb >= 1 && nelea >= 1);
-  auto na0 = make_shared<FCIString>(nelea  , norb);
-  auto na1 = make_shared<FCIString>(nelea-1, norb);
-  auto nb0 = make_shared<FCIString>(neleb  , norb);
-  auto nb1 = make_shared<FCIString>(neleb-1, norb);
-
   using FCIStringSet = CIStringSet<FCIString>;
 
-  list<shared_ptr<const FCIStringSet>> lista = { make_shared<FCIStringSet>(list<shared_ptr<const FCIString>>{na0}),
-                                                 make_shared<FCIStringSet>(list<shared_ptr<const FCIString>>{na1}) };
-  list<shared_ptr<const FCIStringSet>> listb = { make_shared<FCIStringSet>(list<shared_ptr<const FCIString>>{nb0}),
-                                                 make_shared<FCIStringSet>(list<shared_ptr<const FCIString>>{nb1}) };
+  list<shared_ptr<const FCIStringSet>> lista = { FCIStringCache::get(nelea, norb), FCIStringCache::get(nelea-1, norb) };
+  list<shared_ptr<const FCIStringSet>> listb = { FCIStringCache::get(neleb, norb), FCIStringCache::get(neleb-1, norb) };
 
   spacea_ = make_shared<CIStringSpace<FCIStringSet>>(lista);
   spacea_->build_linkage();
@@ -0,0 +1,97 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: symcivec.cc
+// Copyright (C) 2011 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <src/ci/fci/symcivec.h>
+
+using namespace std;
+using namespace bagel;
+
+SymCivec::SymCivec(shared_ptr<const SymDeterminants> det, const int sym, const Civec& o) : SymCivec(det, sym) {
+  assert(o.lena() == det_->det()->lena() && o.lenb() == det_->det()->lenb());
+  for (size_t ia = 0; ia != o.lena(); ++ia) {
+    double* target = column(ia);
+    for (auto& ib : det_->strings_b(det_->product(det_->irrep_a(ia), sym_)))
+      *target++ = *o.element_ptr(ib, ia);
+  }
+}
+
+
+shared_ptr<Civec> SymCivec::expand() const {
+  auto out = make_shared<Civec>(det_->det());
+  for (size_t ia = 0; ia != out->lena(); ++ia) {
+    const double* source = column(ia);
+    for (auto& ib : det_->strings_b(det_->product(det_->irrep_a(ia), sym_)))
+      out->element(ib, ia) = *source++;
+  }
+  return out;
+}
+
+
+// same as Civec::spin(); the intermediate after the alpha excitation i <- j has the symmetry sym_ x (i x j)
+shared_ptr<SymCivec> SymCivec::spin() const {
+  auto out = copy();
+
+  const double sz = 0.5*static_cast<double>(det_->det()->nspin());
+  out->scale(sz*sz + sz + det_->det()->neleb());
+
+  const int norb = det_->norb();
+  const size_t lena = det_->det()->lena();
+
+  for (int i = 0; i < norb; ++i) {
+    for (int j = 0; j < norb; ++j) {
+      auto intermediate = make_shared<SymCivec>(det_, det_->product(sym_, det_->pair_irrep(i, j)));
+      for (auto& iter : det_->phia(i,j))
+        blas::ax_plus_y_n(static_cast<double>(iter.sign), column(iter.source), det_->lenb(sym_, iter.source), intermediate->column(iter.target));
+      for (size_t ia = 0; ia < lena; ++ia) {
+        double* target_base = out->column(ia);
+        const double* source_base = intermediate->column(ia);
+        for (auto& iter : det_->phib(j, i, det_->product(det_->irrep_a(ia), sym_)))
+          target_base[iter.target] -= static_cast<double>(iter.sign) * source_base[iter.source];
+      }
+    }
+  }
+  return out;
+}
+
+
+void SymCivec::spin_decontaminate(const double thresh) {
+  const int nspin = det_->det()->nspin();
+  const int max_spin = det_->det()->nelea() + det_->det()->neleb();
+  const double expectation = static_cast<double>(nspin * (nspin + 2)) * 0.25;
+
+  shared_ptr<SymCivec> S2 = spin();
+
+  int k = nspin + 2;
+  while(fabs(dot_product(*S2) - expectation) > thresh) {
+    if (k > max_spin) throw runtime_error("Spin decontamination failed.");
+    const double factor = -4.0/(static_cast<double>(k*(k+2)));
+    ax_plus_y(factor, *S2);
+    const double norm = this->norm();
+    const double rescale = (norm*norm > 1.0e-60) ? 1.0/norm : 0.0;
+    scale(rescale);
+
+    S2 = spin();
+    k += 2;
+  }
+}
@@ -0,0 +1,87 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: symcivec.h
+// Copyright (C) 2011 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#ifndef __SRC_FCI_SYMCIVEC_H
+#define __SRC_FCI_SYMCIVEC_H
+
+#include <src/ci/fci/civec.h>
+#include <src/ci/fci/symdeterminants.h>
+
+namespace bagel {
+
+// CI coefficients of the determinants of one symmetry (see SymDeterminants for the layout)
+class SymCivec {
+  protected:
+    std::shared_ptr<const SymDeterminants> det_;
+    int sym_;
+    std::unique_ptr<double[]> cc_;
+
+  public:
+    SymCivec(std::shared_ptr<const SymDeterminants> det, const int sym)
+      : det_(det), sym_(sym), cc_(new double[det->size(sym)]) { zero(); }
+    SymCivec(const SymCivec& o) : SymCivec(o.det_, o.sym_) { std::copy_n(o.data(), size(), data()); }
+    // gathers the determinants of this symmetry from a full CI vector
+    SymCivec(std::shared_ptr<const SymDeterminants> det, const int sym, const Civec& o);
+
+    std::shared_ptr<SymCivec> clone() const { return std::make_shared<SymCivec>(det_, sym_); }
+    std::shared_ptr<SymCivec> copy() const { return std::make_shared<SymCivec>(*this); }
+    // full CI vector in which the determinants of other symmetries are zero
+    std::shared_ptr<Civec> expand() const;
+
+    std::shared_ptr<const SymDeterminants> det() const { return det_; }
+    int sym() const { return sym_; }
+    size_t size() const { return det_->size(sym_); }
+
+    double* data() { return cc_.get(); }
+    const double* data() const { return cc_.get(); }
+    // coefficients of the alpha string ia (det()->lenb(sym(), ia) elements)
+    double* column(const size_t ia) { return data() + det_->column(sym_, ia); }
+    const double* column(const size_t ia) const { return data() + det_->column(sym_, ia); }
+
+    void zero() { std::fill_n(data(), size(), 0.0); }
+    void scale(const double a) { blas::scale_n(a, data(), size()); }
+    void ax_plus_y(const double a, const SymCivec& o) { assert(sym_ == o.sym_); blas::ax_plus_y_n(a, o.data(), size(), data()); }
+    void ax_plus_y(const double a, std::shared_ptr<const SymCivec> o) { ax_plus_y(a, *o); }
+    double dot_product(const SymCivec& o) const { assert(sym_ == o.sym_); return blas::dot_product(data(), size(), o.data()); }
+    double dot_product(std::shared_ptr<const SymCivec> o) const { return dot_product(*o); }
+
+    double norm() const { return std::sqrt(dot_product(*this)); }
+    double normalize() {
+      const double norm = this->norm();
+      const double scal = (norm*norm<1.0e-60 ? 0.0 : 1.0/norm);
+      scale(scal);
+      return 1.0/scal;
+    }
+
+    // S^2 applied to this vector, and removal of the other spin states
+    std::shared_ptr<SymCivec> spin() const;
+    void spin_decontaminate(const double thresh = 1.0e-12);
+
+    void synchronize(const int root = 0) { mpi__->broadcast(data(), size(), root); }
+};
+
+}
+
+#endif
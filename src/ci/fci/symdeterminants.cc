@@ -0,0 +1,88 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: symdeterminants.cc
+// Copyright (C) 2011 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <src/ci/fci/symdeterminants.h>
+
+using namespace std;
+using namespace bagel;
+
+SymDeterminants::SymDeterminants(shared_ptr<const Determinants> det, const vector<int>& orbital_irrep, const vector<int>& product_table)
+ : det_(det), nirrep_(static_cast<int>(sqrt(static_cast<double>(product_table.size()))+0.5)), product_(product_table), orbital_irrep_(orbital_irrep) {
+
+  const int norb = det_->norb();
+  assert(orbital_irrep_.size() == static_cast<size_t>(norb) && product_.size() == static_cast<size_t>(nirrep_*nirrep_));
+
+  auto string_irrep = [&](const bitset<nbit__>& bit) {
+    int out = 0;
+    for (int i = 0; i != norb; ++i)
+      if (bit[i]) out = this->product(out, orbital_irrep_[i]);
+    return out;
+  };
+
+  auto split = [&](const vector<bitset<nbit__>>& strings, vector<int>& irrep, vector<size_t>& index, vector<vector<size_t>>& list) {
+    list.resize(nirrep_);
+    for (size_t i = 0; i != strings.size(); ++i) {
+      irrep.push_back(string_irrep(strings[i]));
+      index.push_back(list[irrep.back()].size());
+      list[irrep.back()].push_back(i);
+    }
+  };
+  split(det_->string_bits_a(), irrep_a_, index_a_, strings_a_);
+  split(det_->string_bits_b(), irrep_b_, index_b_, strings_b_);
+
+  offset_.resize(nirrep_);
+  for (int sym = 0; sym != nirrep_; ++sym) {
+    size_t off = 0;
+    for (int a = 0; a != nirrep_; ++a) {
+      offset_[sym].push_back(off);
+      off += strings_a_[a].size() * strings_b_[product(a, sym)].size();
+    }
+    size_.push_back(off);
+  }
+
+  pairs_.resize(nirrep_);
+  pairs_uncompressed_.resize(nirrep_);
+  for (int j = 0; j != norb; ++j)
+    for (int i = 0; i <= j; ++i) {
+      pairs_[product(orbital_irrep_[i], orbital_irrep_[j])].push_back(pair_irrep_.size());
+      pair_irrep_.push_back(product(orbital_irrep_[i], orbital_irrep_[j]));
+    }
+  for (int j = 0; j != norb; ++j)
+    for (int i = 0; i != norb; ++i) {
+      pairs_uncompressed_[product(orbital_irrep_[i], orbital_irrep_[j])].push_back(pair_irrep_uncompressed_.size());
+      pair_irrep_uncompressed_.push_back(product(orbital_irrep_[i], orbital_irrep_[j]));
+    }
+
+  auto sort_phib = [this](const vector<DetMap>& in) {
+    vector<vector<DetMap>> out(nirrep_);
+    for (auto& i : in)
+      out[irrep_b_[i.target]].emplace_back(index_b_[i.target], i.sign, index_b_[i.source], i.ij);
+    return out;
+  };
+  const int npair = norb*(norb+1)/2;
+  for (int ip = 0; ip != npair; ++ip)
+    phib_.push_back(sort_phib(det_->phib(ip)));
+  for (int ip = 0; ip != norb*norb; ++ip)
+    phib_uncompressed_.push_back(sort_phib(det_->phib(ip%norb, ip/norb)));
+}
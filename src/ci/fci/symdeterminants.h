@@ -0,0 +1,106 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: symdeterminants.h
+// Copyright (C) 2011 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#ifndef __SRC_FCI_SYMDETERMINANTS_H
+#define __SRC_FCI_SYMDETERMINANTS_H
+
+#include <src/ci/fci/determinants.h>
+
+namespace bagel {
+
+// Determinant space split by the irreps of an abelian point group. The irrep of a string is the product of the irreps of
+// its occupied orbitals. A vector of symmetry s has one block for each alpha irrep a, in which the beta strings of irrep
+// a x s run first (as in Civec); determinants of other symmetries are not stored.
+class SymDeterminants {
+  protected:
+    std::shared_ptr<const Determinants> det_;
+
+    int nirrep_;
+    // product table of the irreps and the irreps of the active orbitals
+    std::vector<int> product_;
+    std::vector<int> orbital_irrep_;
+
+    // irrep of each string (in the lexical order of det_) and its position among the strings of that irrep
+    std::vector<int> irrep_a_;
+    std::vector<int> irrep_b_;
+    std::vector<size_t> index_a_;
+    std::vector<size_t> index_b_;
+    // strings in each irrep
+    std::vector<std::vector<size_t>> strings_a_;
+    std::vector<std::vector<size_t>> strings_b_;
+
+    // offsets of the alpha blocks (symmetry x alpha irrep) and the size of a vector of each symmetry
+    std::vector<std::vector<size_t>> offset_;
+    std::vector<size_t> size_;
+
+    // irreps of the orbital pairs i <= j (compressed index) and i + j*norb (uncompressed)
+    std::vector<int> pair_irrep_;
+    std::vector<int> pair_irrep_uncompressed_;
+    // orbital pairs in each irrep
+    std::vector<std::vector<int>> pairs_;
+    std::vector<std::vector<int>> pairs_uncompressed_;
+
+    // beta single displacement lists sorted by the irrep of the target string; indices are positions within the irreps
+    std::vector<std::vector<std::vector<DetMap>>> phib_;
+    std::vector<std::vector<std::vector<DetMap>>> phib_uncompressed_;
+
+  public:
+    SymDeterminants(std::shared_ptr<const Determinants> det, const std::vector<int>& orbital_irrep, const std::vector<int>& product_table);
+
+    std::shared_ptr<const Determinants> det() const { return det_; }
+    int norb() const { return det_->norb(); }
+    int nirrep() const { return nirrep_; }
+    int product(const int a, const int b) const { return product_[a+nirrep_*b]; }
+    const std::vector<int>& orbital_irrep() const { return orbital_irrep_; }
+
+    int irrep_a(const size_t ia) const { return irrep_a_[ia]; }
+    int irrep_b(const size_t ib) const { return irrep_b_[ib]; }
+    size_t index_b(const size_t ib) const { return index_b_[ib]; }
+    const std::vector<size_t>& strings_a(const int irrep) const { return strings_a_[irrep]; }
+    const std::vector<size_t>& strings_b(const int irrep) const { return strings_b_[irrep]; }
+
+    size_t size(const int sym) const { return size_[sym]; }
+    // number of beta strings that accompany the alpha string ia in a vector of symmetry sym
+    size_t lenb(const int sym, const size_t ia) const { return strings_b_[product(irrep_a_[ia], sym)].size(); }
+    // offset of the coefficients of the alpha string ia in a vector of symmetry sym
+    size_t column(const int sym, const size_t ia) const {
+      const int a = irrep_a_[ia];
+      return offset_[sym][a] + index_a_[ia] * strings_b_[product(a, sym)].size();
+    }
+
+    int pair_irrep(const int ip) const { return pair_irrep_[ip]; }
+    int pair_irrep(const int i, const int j) const { return pair_irrep_uncompressed_[i+j*norb()]; }
+    const std::vector<int>& pairs(const int irrep) const { return pairs_[irrep]; }
+    const std::vector<int>& pairs_uncompressed(const int irrep) const { return pairs_uncompressed_[irrep]; }
+
+    const std::vector<DetMap>& phia(const int ip) const { return det_->phia(ip); }
+    const std::vector<DetMap>& phia(const int i, const int j) const { return det_->phia(i, j); }
+    const std::vector<DetMap>& phib(const int ip, const int irrep) const { return phib_[ip][irrep]; }
+    const std::vector<DetMap>& phib(const int i, const int j, const int irrep) const { return phib_uncompressed_[i+j*norb()][irrep]; }
+};
+
+}
+
+#endif
@@ -177,11 +177,9 @@ void RASDeterminants::construct_phis_(std::shared_ptr<const CIStringSet<RASStrin
       const std::bitset<nbit__> targetbit = *istring;
       std::vector<std::vector<DetMap>> pij;
       pij.resize( nij );
-      for (int j = 0; j < norb(); ++j) {
-        if ( !targetbit[j] ) continue;
+      for_each_bit(targetbit, 0, norb(), [&](const int j) {
         std::bitset<nbit__> intermediatebit = targetbit; intermediatebit.reset(j);
-        for (int i = 0; i < norb(); ++i) {
-          if ( intermediatebit[i] ) continue;
+        for_each_bit(~intermediatebit, 0, norb(), [&](const int i) {
           std::bitset<nbit__> sourcebit = intermediatebit; sourcebit.set(i);
           if ( allowed(sourcebit) ) {
             const size_t source_lex = lexmap[sourcebit];
@@ -189,8 +187,8 @@ void RASDeterminants::construct_phis_(std::shared_ptr<const CIStringSet<RASStrin
             std::tie(minij, maxij) = std::minmax(i,j);
             pij[minij+((maxij*(maxij+1))>>1)].emplace_back(source_lex, sign(targetbit, i, j), tindex, j+i*norb());
           }
-        }
-      }
+        });
+      });
       for (int i = 0; i < nij; ++i) if (pij[i].size() > 0) {
         pij[i].shrink_to_fit();
         phi_ij[i].emplace_back(offsets[i], ispace, std::move(pij[i]));
@@ -26,6 +26,7 @@
 #include <src/util/math/sparsematrix.h>
 #include <src/ci/ras/form_sigma.h>
 #include <src/ci/ras/sparse_ij.h>
+#include <src/util/taskqueue.h>
 
 // toggle for timing print out.
 static const bool tprint = false;
@@ -33,6 +34,17 @@ static const bool tprint = false;
 using namespace std;
 using namespace bagel;
 
+namespace {
+  // function with an estimated cost so that TaskQueue processes expensive tasks first
+  struct SigmaABTask {
+    function<void(void)> func_;
+    double cost_;
+    SigmaABTask(function<void(void)> f, const double c) : func_(f), cost_(c) {}
+    void compute() { func_(); }
+    double cost() const { return cost_; }
+  };
+}
+
 /* Implementing the method as described by Olsen */
 // This is how this is accessed from RASCI
 shared_ptr<RASDvec> FormSigmaRAS::operator()(shared_ptr<const RASDvec> ccvec, shared_ptr<const MOFile> jop,
@@ -228,74 +240,146 @@ void FormSigmaRAS::sigma_ab(const RASCivecView cc, RASCivecView sigma, const dou
 
   const int norb = det->norb();
 
-  // pre-compute all sparse F matrices
-  Sparse_IJ sparseij(det->stringspaceb(), det->stringspaceb());
-
-  // figure out maximum block size
-  const size_t max_ccblock_size = (*max_element(cc.blocks().begin(), cc.blocks().end(),
-          [] (shared_ptr<const RASBlock<double>> a, shared_ptr<const RASBlock<double>> b) {
-            return ( a ? a->size() : 0) < ( b ? b->size() : 0);
-          }))->size();
-
-  // allocate some scratch space. these upperbounds may be overkill
-  unique_ptr<double[]> cprime(new double[2*max_ccblock_size]);
-  unique_ptr<double[]> V(new double[2*max_ccblock_size]);
+  // pre-compute all sparse F matrices (only once for a given set of beta strings)
+  if (!sparseij_ || sparseij_space_ != det->stringspaceb()) {
+    sparseij_ = make_shared<const Sparse_IJ>(det->stringspaceb(), det->stringspaceb());
+    sparseij_space_ = det->stringspaceb();
+  }
 
+  // sort the excitations by the alpha space of the target so that each block of sigma only sees its own
+  const int naspace = det->stringspacea()->nspaces();
+  vector<int> aspace_of(det->lena());
+  {
+    int iaspace = 0;
+    for (auto& aspace : *det->stringspacea()) {
+      fill_n(aspace_of.begin() + aspace->offset(), aspace->size(), iaspace);
+      ++iaspace;
+    }
+  }
+  // excitations are merged by (ij, source alpha space), so that F is formed once for all of them
+  vector<vector<PhiList>> phis(naspace);
   for (int i = 0, ij = 0; i < norb; ++i) {
     for (int j = 0; j <= i; ++j, ++ij) {
-      const double* mo2e_ij = mo2e + i + norb*norb*j;
-      for (auto& target_bspace : *det->stringspaceb()) {
-        const size_t tlb = target_bspace->size();
-        // looping over source_aspace
-        for (auto& phiblock : det->phia_ij(ij) ) {
-          const shared_ptr<const RASString>& source_aspace = phiblock.source_space();
-
-          // make a reduced list of only those excitations that will contribute to the sigma vector
-          vector<tuple</*source*/size_t,/*sign*/int, /*offset_of_target*/size_t>> reduced_phi;
-          for (auto& phi : phiblock) {
-            auto target_aspace = det->space<0>(det->string_bits_a(phi.target));
-            if (det->allowed(target_aspace, target_bspace)) {
-              const shared_ptr<const RASBlock<double>>& tblock = cc.block(target_bspace, target_aspace);
-              const size_t o = tblock->offset() + (phi.target - target_aspace->offset()) * tblock->lenb();
-              reduced_phi.emplace_back(phi.source, phi.sign, o);
-            }
-          }
-
-          if (reduced_phi.empty()) continue;
-
-          for (auto& source_block : cc.allowed_blocks<0>(source_aspace)) {
-            const shared_ptr<const RASString>& source_bspace = source_block->stringsb();
-            const size_t slb = source_bspace->size();
+      for (auto& phiblock : det->phia_ij(ij)) {
+        for (auto& p : phis)
+          if (p.empty() || p.back().i != i || p.back().j != j || p.back().source_aspace != phiblock.source_space())
+            p.emplace_back(i, j, phiblock.source_space());
+        for (auto& phi : phiblock)
+          phis[aspace_of[phi.target]].back().phi.emplace_back(phi.source, phi.sign, phi.target);
+      }
+    }
+  }
+  for (auto& p : phis)
+    p.erase(remove_if(p.begin(), p.end(), [](const PhiList& o) { return o.phi.empty(); }), p.end());
+
+  // one task per block of sigma so that the tasks write to disjoint memory. The cost is estimated by the size of the
+  // target block times the number of beta spaces that are coupled to it.
+  TaskQueue<SigmaABTask> tasks(sigma.blocks().size());
+  for (auto& target : sigma.blocks()) {
+    if (!target || target->size() == 0) continue;
+    int ncoupled = 0;
+    for (auto& source_bspace : *det->stringspaceb())
+      if (sparseij_->sparse_matrix(target->stringsb()->tag(), source_bspace->tag()))
+        ++ncoupled;
+    RASBlock<double>* t = target.get();
+    const vector<PhiList>* p = &phis[aspace_of[target->stringsa()->offset()]];
+    tasks.emplace_back([this, &cc, t, p, mo2e] { sigma_ab_block(cc, *t, *p, mo2e); }, static_cast<double>(target->size()) * ncoupled);
+  }
+  tasks.compute();
+}
 
-            // F matrix in sparse format
-            const shared_ptr<SparseMatrix>& sparseF = sparseij.sparse_matrix(target_bspace->tag(), source_bspace->tag());
+void FormSigmaRAS::sigma_ab_block(const RASCivecView& cc, RASBlock<double>& target, const vector<PhiList>& phis, const double* mo2e) const {
+  shared_ptr<const RASDeterminants> det = cc.det();
+  const int norb = det->norb();
 
-            // if this assert fails, max_ccblock_size is not a good enough upper bound
-            assert(max_ccblock_size >= max(slb, tlb) * reduced_phi.size());
+  const shared_ptr<const RASString>& target_bspace = target.stringsb();
+  const size_t tlb = target.lenb();
+  const size_t tastart = target.stringsa()->offset();
+
+  // scratch space local to this task
+  vector<double> cprime, V, fdata;
+  // source column of C, sign, and target column of sigma of each excitation
+  vector<tuple<const double*, double, double*>> columns;
+
+  // PhiLists with the same ij are consecutive
+  for (auto first = phis.begin(); first != phis.end(); ) {
+    auto last = find_if(first, phis.end(), [&first](const PhiList& o) { return o.i != first->i || o.j != first->j; });
+    const double* mo2e_ij = mo2e + first->i + norb*norb*first->j;
+
+    for (auto& source_bspace : *det->stringspaceb()) {
+      // F matrix in sparse format
+      const shared_ptr<SparseMatrix>& sparseF = sparseij_->sparse_matrix(target_bspace->tag(), source_bspace->tag());
+      if (!sparseF) continue;
+      const size_t slb = source_bspace->size();
+
+      // all excitations from the alpha spaces that are allowed with this beta space are the columns of one multiplication
+      columns.clear();
+      for (auto p = first; p != last; ++p) {
+        shared_ptr<const RASBlock<double>> source_block = cc.block(source_bspace, p->source_aspace);
+        if (!source_block) continue;
+        for (auto& i : p->phi)
+          columns.emplace_back(source_block->data() + slb*get<0>(i), get<1>(i), target.data() + (get<2>(i) - tastart) * tlb);
+      }
+      if (columns.empty()) continue;
+      const int ncol = columns.size();
+
+      auto& keys = sparseij_->sparse_data(target_bspace->tag(), source_bspace->tag());
+      auto& panel = sparseij_->panel(target_bspace->tag(), source_bspace->tag());
+
+      if (sparseF->size() >= dense_threshold_ * panel.size()) {
+        // F in the gathered dense format
+        const int nr = panel.rows.size();
+        const int nc = panel.cols.size();
+        fdata.assign(panel.size(), 0.0);
+        for (auto& iter : keys)
+          fdata[iter.panel] += static_cast<double>(iter.sign) * mo2e_ij[norb*(iter.i + norb*norb*iter.j)];
+
+        // gather only the rows of C that contribute
+        cprime.resize(static_cast<size_t>(nc)*ncol);
+        V.resize(static_cast<size_t>(nr)*ncol);
+        for (int icol = 0; icol != ncol; ++icol) {
+          const double* source = get<0>(columns[icol]);
+          const double sign = get<1>(columns[icol]);
+          double* c = cprime.data() + static_cast<size_t>(nc)*icol;
+          for (int k = 0; k != nc; ++k)
+            c[k] = sign * source[panel.cols[k]];
+        }
 
-            if (sparseF) {
-              // fill in sparse matrix
-              sparseF->zero();
-              for (auto& iter : sparseij.sparse_data(target_bspace->tag(), source_bspace->tag()))
-                *iter.ptr += static_cast<double>(iter.sign) * mo2e_ij[norb*(iter.i + norb*norb*iter.j)];
+        // compute V = F * C'
+        dgemm_("N", "N", nr, ncol, nc, 1.0, fdata.data(), nr, cprime.data(), nc, 0.0, V.data(), nr);
 
-              // gather to fill in C'
-              fill_n(cprime.get(), slb * reduced_phi.size(), 0.0);
-              int current = 0;
-              for (auto& i : reduced_phi)
-                blas::ax_plus_y_n(get<1>(i), source_block->data() + slb*get<0>(i), slb, cprime.get() + current++*slb);
+        // scatter to add V to sigma
+        for (int icol = 0; icol != ncol; ++icol) {
+          const double* v = V.data() + static_cast<size_t>(nr)*icol;
+          double* s = get<2>(columns[icol]);
+          for (int k = 0; k != nr; ++k)
+            s[panel.rows[k]] += v[k];
+        }
+      } else {
+        // fill in sparse matrix (the sparsity pattern is shared by the tasks, the values are not)
+        fdata.assign(sparseF->size(), 0.0);
+        for (auto& iter : keys)
+          fdata[iter.index] += static_cast<double>(iter.sign) * mo2e_ij[norb*(iter.i + norb*norb*iter.j)];
+
+        // gather to fill in C'
+        cprime.resize(slb*ncol);
+        V.resize(tlb*ncol);
+        for (int icol = 0; icol != ncol; ++icol) {
+          const double* source = get<0>(columns[icol]);
+          const double sign = get<1>(columns[icol]);
+          double* c = cprime.data() + slb*icol;
+          for (size_t k = 0; k != slb; ++k)
+            c[k] = sign * source[k];
+        }
 
-              // compute V = F * C'
-              dcsrmm_("N", tlb, reduced_phi.size(), slb, 1.0, sparseF->data(), sparseF->cols(), sparseF->rind(), cprime.get(), slb, 0.0, V.get(), tlb);
+        // compute V = F * C'
+        dcsrmm_("N", tlb, ncol, slb, 1.0, fdata.data(), sparseF->cols(), sparseF->rind(), cprime.data(), slb, 0.0, V.data(), tlb);
 
-              // scatter to add V to sigma
-              current = 0;
-              for (auto& i : reduced_phi)
-                blas::ax_plus_y_n(1.0, V.get() + tlb*current++, tlb, sigma.data() + get<2>(i));
-            }
-          }
-        }
+        // scatter to add V to sigma
+        for (int icol = 0; icol != ncol; ++icol)
+          blas::ax_plus_y_n(1.0, V.data() + tlb*icol, tlb, get<2>(columns[icol]));
       }
     }
+    first = last;
   }
 }
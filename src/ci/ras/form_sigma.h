@@ -30,12 +30,20 @@
 
 namespace bagel {
 
+class Sparse_IJ;
+
 class FormSigmaRAS {
   protected:
     int batchsize_;
+    // in sigma_ab, a block of F is multiplied as a gathered dense matrix when the fraction of nonzero elements exceeds this
+    double dense_threshold_;
+
+    // F matrices in sigma_ab depend only on the beta string spaces and are reused as long as they do not change
+    mutable std::shared_ptr<const CIStringSet<RASString>> sparseij_space_;
+    mutable std::shared_ptr<const Sparse_IJ> sparseij_;
 
   public:
-    FormSigmaRAS(const int b = 512) : batchsize_(b) {}
+    FormSigmaRAS(const int b = 512, const double d = 0.5) : batchsize_(b), dense_threshold_(d) {}
 
     /// Applies Hamiltonian to cc using the provided MOFile, skipping the vectors marked as converged
     std::shared_ptr<RASDvec> operator()(std::shared_ptr<const RASDvec> ccvec, std::shared_ptr<const MOFile> jop, const std::vector<int>& conv) const;
@@ -44,10 +52,22 @@ class FormSigmaRAS {
     void operator()(const RASCivecView cc, RASCivecView sigma, std::shared_ptr<const MOFile> jop) const;
 
   private:
+    // excitations E_ij from the strings in one alpha space into the strings in a given target alpha space
+    // (all strings of the source space are merged, so that one F matrix serves all of them)
+    struct PhiList {
+      int i;
+      int j;
+      std::shared_ptr<const RASString> source_aspace;
+      std::vector<std::tuple</*source*/size_t, /*sign*/int, /*target*/size_t>> phi;
+      PhiList(const int ii, const int jj, std::shared_ptr<const RASString> s) : i(ii), j(jj), source_aspace(s) {}
+    };
+
     // Helper functions for sigma formation
     void sigma_aa(const RASCivecView cc, RASCivecView sigma, const double* g, const double* mo2e) const;
     void sigma_bb(const RASCivecView cc, RASCivecView sigma, const double* g, const double* mo2e) const;
     void sigma_ab(const RASCivecView cc, RASCivecView sigma, const double* mo2e) const;
+    // alpha-beta contributions to one block of sigma
+    void sigma_ab_block(const RASCivecView& cc, RASBlock<double>& target, const std::vector<PhiList>& phis, const double* mo2e) const;
 };
 
 }
@@ -47,6 +47,7 @@ void RASCI::common_init() {
   print_thresh_ = idata_->get<double>("print_thresh", 0.05);
 
   batchsize_ = idata_->get<int>("batchsize", 512);
+  dense_threshold_ = idata_->get<double>("dense_threshold", 0.5);
 
   nstate_ = idata_->get<int>("nstate", 1);
   nguess_ = idata_->get<int>("nguess", nstate_);
@@ -277,7 +278,7 @@ void RASCI::compute() {
   DavidsonDiag<RASCivec> davidson(nstate_, davidson_subspace_);
 
   // Object in charge of forming sigma vector
-  FormSigmaRAS form_sigma(batchsize_);
+  FormSigmaRAS form_sigma(batchsize_, dense_threshold_);
 
   // main iteration starts here
   cout << "  === RAS-CI iteration ===" << endl << endl;
@@ -47,6 +47,7 @@ class RASCI : public Method {
 
     // algorithmic options
     int batchsize_;
+    double dense_threshold_;
 
     // numbers of electrons
     int nelea_;
@@ -23,6 +23,7 @@
 //
 
 #include <set>
+#include <map>
 #include <src/ci/ras/sparse_ij.h>
 
 using namespace std;
@@ -49,10 +50,10 @@ Sparse_IJ::Sparse_IJ(shared_ptr<const CIStringSet<RASString>> source_stringspace
       const bitset<nbit__> tbit = target_space->strings(itar);
       for (int i = 0; i < norb; ++i) {
         if (!tbit[i]) continue;
-        const bitset<nbit__> tmpbit = tbit ^ bitset<nbit__>(1 << i);
+        const bitset<nbit__> tmpbit = tbit ^ bitset<nbit__>().set(i);
         for (int j = 0; j < norb; ++j) {
           if (tmpbit[j]) continue;
-          const bitset<nbit__> sbit = tmpbit ^ bitset<nbit__>(1 << j);
+          const bitset<nbit__> sbit = tmpbit ^ bitset<nbit__>().set(j);
           int isource_space = 0;
           for (auto& source_space : *source_stringspace) {
             if (source_space->contains(sbit)) {
@@ -83,6 +84,22 @@ Sparse_IJ::Sparse_IJ(shared_ptr<const CIStringSet<RASString>> source_stringspace
           return get<0>(a) < get<0>(b);
         });
 
+        // rows and columns of the dense panel
+        DensePanel panel;
+        map<size_t, int> rowmap, colmap;
+        for (auto& i : sparse_set) {
+          rowmap.emplace(i/slen, 0);
+          colmap.emplace(i%slen, 0);
+        }
+        for (auto& i : rowmap) {
+          i.second = panel.rows.size();
+          panel.rows.push_back(i.first);
+        }
+        for (auto& i : colmap) {
+          i.second = panel.cols.size();
+          panel.cols.push_back(i.first);
+        }
+
         vector<SparseIJKey> sp;
         sp.reserve(sparse_keys.size());
         size_t last = get<0>(sparse_keys.front());
@@ -90,13 +107,16 @@ Sparse_IJ::Sparse_IJ(shared_ptr<const CIStringSet<RASString>> source_stringspace
           const SparseIJKey& d = get<1>(dd);
           if (last != get<0>(dd))
             ++data;
-          sp.emplace_back(d.i, d.j, d.sign, data);
+          const size_t pos = get<0>(dd);
+          sp.emplace_back(d.i, d.j, d.sign, data, data - sparse->data(), rowmap[pos/slen] + panel.rows.size()*colmap[pos%slen]);
           last = get<0>(dd);
         }
         data_.emplace(make_pair(target_space->tag(), source_space->tag()), make_tuple(sparse, move(sp)));
+        panel_.emplace(make_pair(target_space->tag(), source_space->tag()), move(panel));
       }
       else {
         data_.emplace(make_pair(target_space->tag(), source_space->tag()), make_tuple(nullptr, vector<SparseIJKey>()));
+        panel_.emplace(make_pair(target_space->tag(), source_space->tag()), DensePanel());
       }
       ++isource_space;
     }
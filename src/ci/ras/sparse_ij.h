@@ -39,10 +39,21 @@ class Sparse_IJ {
     int j;
     int sign;
     double* ptr;
-    SparseIJKey(int ii, int jj, int s, double* p) : i(ii), j(jj), sign(s), ptr(p) {}
+    // position of the element in the data of the sparse matrix and in the dense panel (see below)
+    int index;
+    int panel;
+    SparseIJKey(int ii, int jj, int s, double* p, int x = 0, int y = 0) : i(ii), j(jj), sign(s), ptr(p), index(x), panel(y) {}
+  };
+  /// The same matrix in a gathered dense format: only the rows (target strings) and columns (source strings) that have
+  /// nonzero elements are kept, and the element (rows[r], cols[c]) is stored at r + rows.size()*c.
+  struct DensePanel {
+    std::vector<int> rows;
+    std::vector<int> cols;
+    size_t size() const { return rows.size()*cols.size(); }
   };
   protected:
     std::map<std::pair<int, int>, std::tuple<std::shared_ptr<SparseMatrix>, std::vector<SparseIJKey>>> data_;
+    std::map<std::pair<int, int>, DensePanel> panel_;
 
   public:
     Sparse_IJ(std::shared_ptr<const CIStringSet<RASString>> source_stringspace, std::shared_ptr<const CIStringSet<RASString>> target_stringspace);
@@ -50,6 +61,7 @@ class Sparse_IJ {
     const std::tuple<std::shared_ptr<SparseMatrix>, std::vector<SparseIJKey>>& data(const int target_tag, const int source_tag) const { return data_.at({target_tag, source_tag}); }
     const std::shared_ptr<SparseMatrix>& sparse_matrix(const int target_tag, const int source_tag) const { return std::get<0>(data_.at({target_tag, source_tag})); }
     const std::vector<SparseIJKey>& sparse_data(const int target_tag, const int source_tag) const { return std::get<1>(data_.at({target_tag, source_tag})); }
+    const DensePanel& panel(const int target_tag, const int source_tag) const { return panel_.at({target_tag, source_tag}); }
 };
 
 }
@@ -48,6 +48,16 @@ class ComplexDFIntTask {
     ComplexDFIntTask(std::array<std::shared_ptr<const Shell>,4>&& a, std::array<int,3>&& b, std::array<std::shared_ptr<DFBlock>,N>& df)
      : shell_(a), offset_(b), dfblocks_(df) { };
 
+    // rough estimate of the work used by TaskQueue: number of primitive triples times the size of the Cartesian batch
+    double cost() const {
+      double out = 1.0;
+      for (int i = 1; i != 4; ++i) {
+        const int l = shell_[i]->angular_number();
+        out *= shell_[i]->num_primitive() * (l+1)*(l+2)/2;
+      }
+      return out;
+    }
+
     void compute() {
       std::shared_ptr<TBatch> p = compute_batch(shell_);
       const int Nhalf = N / 2;
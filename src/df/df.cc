@@ -35,6 +35,8 @@ using namespace btas;
 
 shared_ptr<DFDist> DFDist::copy() const {
   auto out = make_shared<DFDist>(df_);
+  if (disk_)
+    out->add_block(disk_->load());
   for (auto& i : block_)
     out->add_block(i->copy());
   return out;
@@ -43,27 +45,71 @@ shared_ptr<DFDist> DFDist::copy() const {
 
 shared_ptr<DFDist> DFDist::clone() const {
   auto out = make_shared<DFDist>(df_);
+  if (disk_)
+    out->add_block(disk_->clone());
   for (auto& i : block_)
     out->add_block(i->clone());
   return out;
 }
 
 
-tuple<int, vector<shared_ptr<const Shell>>> DFDist::get_ashell(const vector<shared_ptr<const Shell>>& all) {
+vector<double> DFDist::aux_shell_cost(const vector<shared_ptr<const Shell>>& aux, const vector<shared_ptr<const Shell>>& basis) {
+  // The cost of a primitive triple (a|b1 b2) is modeled as the product of the Cartesian batch sizes times the number of Rys roots.
+  // Pairs of basis shells are first summed up by their total angular momentum so that this is O(nshell^2).
+  auto ncart = [](const int l) { return (l+1)*(l+2)/2; };
+  int lmax = 0;
+  for (auto& b : basis)
+    lmax = max(lmax, b->angular_number());
+  vector<double> pairs(2*lmax+1, 0.0);
+  for (auto i = basis.begin(); i != basis.end(); ++i)
+    for (auto j = i; j != basis.end(); ++j)
+      pairs[(*i)->angular_number()+(*j)->angular_number()] += static_cast<double>((*i)->num_primitive() * (*j)->num_primitive())
+                                                            * ncart((*i)->angular_number()) * ncart((*j)->angular_number());
+
+  vector<double> out;
+  out.reserve(aux.size());
+  for (auto& a : aux) {
+    const int la = a->angular_number();
+    double sum = 0.0;
+    for (int l = 0; l <= 2*lmax; ++l)
+      sum += pairs[l] * ((la+l)/2+1);
+    out.push_back(sum * a->num_primitive() * ncart(la));
+  }
+  return out;
+}
+
+
+tuple<int, vector<shared_ptr<const Shell>>, double> DFDist::get_ashell(const vector<shared_ptr<const Shell>>& all, const vector<shared_ptr<const Shell>>& basis) {
   int out1;
   vector<shared_ptr<const Shell>> out2;
+  double out3 = 0.0;
   // TODO without *2, H does not work. Perhaps need to think a bit more
   if (mpi__->size()*2 < all.size()) {
-    int start, end;
-    StaticDist d(naux_, mpi__->size());
-    tie(start, end) = d.range(mpi__->rank());
+    // contiguous partition of auxiliary shells with balanced estimated cost; every process receives at least one shell
+    const vector<double> cost = aux_shell_cost(all, basis);
+    const double total = accumulate(cost.begin(), cost.end(), 0.0);
+    const int nproc = mpi__->size();
+    vector<int> first(nproc+1, all.size());
+    first[0] = 0;
+    double sum = 0.0;
+    int ishell = 0;
+    for (int r = 1; r != nproc; ++r) {
+      while (ishell < all.size() && sum + 0.5*cost[ishell] < total * r / nproc)
+        sum += cost[ishell++];
+      ishell = min(max(ishell, first[r-1]+1), static_cast<int>(all.size())-(nproc-r));
+      sum = accumulate(cost.begin(), cost.begin()+ishell, 0.0);
+      first[r] = ishell;
+    }
+
+    const int rank = mpi__->rank();
     int num = 0;
-    for (auto& s : all) {
-      if (num >= start && num < end) {
-        if (out2.empty()) out1 = num;
-        out2.push_back(s);
+    for (int i = 0; i != all.size(); ++i) {
+      if (i == first[rank]) out1 = num;
+      if (i >= first[rank] && i < first[rank+1]) {
+        out2.push_back(all[i]);
+        out3 += cost[i];
       }
-      num += s->nbasis();
+      num += all[i]->nbasis();
     }
   } else {
     cout << endl << "   *** Warning *** Since the number of auxiliary shells is too small, we do not parallelize the Fock builder." << endl << endl;
@@ -72,7 +118,26 @@ tuple<int, vector<shared_ptr<const Shell>>> DFDist::get_ashell(const vector<shar
     serial_ = true;
   }
 
-  return tie(out1, out2);
+  return make_tuple(out1, out2, out3);
+}
+
+
+void DFDist::print_balance(const double predicted, const double measured) const {
+  // diagnostics; DFDist is constructed many times (including temporaries)
+  if (serial_ || mpi__->size() == 1 || !Tracer::enabled()) return;
+  const int nproc = mpi__->size();
+  const array<double,2> send{{predicted, measured}};
+  vector<double> rec(nproc*2);
+  mpi__->allgather(send.data(), 2, rec.data(), 2);
+
+  array<double,2> maxval{{0.0, 0.0}}, sum{{0.0, 0.0}};
+  for (int i = 0; i != nproc; ++i)
+    for (int j = 0; j != 2; ++j) {
+      maxval[j] = max(maxval[j], rec[i*2+j]);
+      sum[j] += rec[i*2+j];
+    }
+  cout << "        3-index ints load balance (max/average): predicted " << fixed << setprecision(2) << maxval[0]*nproc/max(sum[0], 1.0e-100)
+       << ", measured " << maxval[1]*nproc/max(sum[1], 1.0e-100) << endl;
 }
 
 
@@ -82,7 +147,7 @@ void DFDist::compute_2index(const vector<shared_ptr<const Shell>>& ashell, const
   // generates a task of integral evaluations
   TaskQueue<DFIntTask_OLD<DFDist>> tasks(ashell.size()*ashell.size());
 
-  data2_ = make_shared<Matrix>(naux_, naux_, serial_);
+  auto data2 = make_shared<Matrix>(naux_, naux_, serial_);
   auto b3 = make_shared<const Shell>(ashell.front()->spherical());
 
   // naive static distribution
@@ -92,7 +157,7 @@ void DFDist::compute_2index(const vector<shared_ptr<const Shell>>& ashell, const
     int o1 = 0;
     for (auto& b1 : ashell) {
       if (o0 <= o1 && ((u++ % mpi__->size() == mpi__->rank()) || serial_))
-        tasks.emplace_back(array<shared_ptr<const Shell>,4>{{b1, b3, b0, b3}}, array<int,2>{{o0, o1}}, this);
+        tasks.emplace_back(array<shared_ptr<const Shell>,4>{{b1, b3, b0, b3}}, array<int,2>{{o0, o1}}, this, data2.get());
       o1 += b1->nbasis();
     }
     o0 += b0->nbasis();
@@ -102,15 +167,19 @@ void DFDist::compute_2index(const vector<shared_ptr<const Shell>>& ashell, const
   tasks.compute();
 
   if (!serial_)
-    data2_->allreduce();
+    data2->allreduce();
 
   time.tick_print("2-index ints");
 
   if (compute_inverse) {
-    data2_->inverse_half(throverlap);
+    data2->inverse_half(throverlap);
     // will use data2_ within node
-    data2_->localize();
+    data2->localize();
+    // read-only from here on; stored once per node if there are several processes on it
+    data2_ = serial_ ? data2 : data2->node_copy();
     time.tick_print("computing inverse");
+  } else {
+    data2_ = data2;
   }
 }
 
@@ -140,8 +209,20 @@ pair<const double*, shared_ptr<RysInt>> DFDist::compute_batch(array<shared_ptr<c
 shared_ptr<DFHalfDist> DFDist::compute_half_transform(const MatView c) const {
   const int nocc = c.extent(1);
   auto out = make_shared<DFHalfDist>(df_ ? df_ : shared_from_this(), nocc);
-  for (auto& i : block_)
-    out->add_block(i->transform_second(c));
+  if (!disk_) {
+    for (auto& i : block_)
+      out->add_block(i->transform_second(c));
+  } else {
+    // slabs of b2 are transformed independently and placed in the output
+    shared_ptr<DFBlock> blk;
+    disk_->stream([&](shared_ptr<const DFBlock> slab, const size_t offset) {
+      shared_ptr<const DFBlock> tmp = slab->transform_second(c);
+      if (!blk)
+        blk = make_shared<DFBlock>(slab->adist_shell(), slab->adist(), slab->asize(), nocc, disk_->b2size(), slab->astart(), 0, slab->b2start(), slab->averaged());
+      copy_n(tmp->data(), tmp->size(), blk->data()+blk->asize()*nocc*offset);
+    });
+    out->add_block(blk);
+  }
   return out;
 }
 
@@ -149,8 +230,22 @@ shared_ptr<DFHalfDist> DFDist::compute_half_transform(const MatView c) const {
 shared_ptr<DFHalfDist> DFDist::compute_half_transform_swap(const MatView c) const {
   const int nocc = c.extent(1);
   auto out = make_shared<DFHalfDist>(df_ ? df_ : shared_from_this(), nocc);
-  for (auto& i : block_)
-    out->add_block(i->transform_third(c)->swap());
+  if (!disk_) {
+    for (auto& i : block_)
+      out->add_block(i->transform_third(c)->swap());
+  } else {
+    // contributions from slabs of b2 are accumulated
+    const Matrix cmat(c);
+    shared_ptr<DFBlock> blk;
+    disk_->stream([&](shared_ptr<const DFBlock> slab, const size_t offset) {
+      shared_ptr<DFBlock> tmp = slab->transform_third(*cmat.get_submatrix(offset, 0, slab->b2size(), nocc));
+      if (!blk)
+        blk = tmp;
+      else
+        blk->ax_plus_y(1.0, tmp);
+    });
+    out->add_block(blk->swap());
+  }
   return out;
 }
 
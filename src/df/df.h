@@ -43,10 +43,15 @@ class DFDist : public ParallelDF {
     // compute 2-index integrals ERI
     void compute_2index(const std::vector<std::shared_ptr<const Shell>>&, const double thresh, const bool compute_inv);
 
-    std::tuple<int, std::vector<std::shared_ptr<const Shell>>> get_ashell(const std::vector<std::shared_ptr<const Shell>>& all);
+    // estimated cost of the 3-index integrals for each auxiliary shell
+    static std::vector<double> aux_shell_cost(const std::vector<std::shared_ptr<const Shell>>& aux, const std::vector<std::shared_ptr<const Shell>>& basis);
+    // returns the offset, auxiliary shells, and estimated cost for this process
+    std::tuple<int, std::vector<std::shared_ptr<const Shell>>, double> get_ashell(const std::vector<std::shared_ptr<const Shell>>& all, const std::vector<std::shared_ptr<const Shell>>& basis);
+    // prints out the predicted and measured load imbalance of the 3-index integral evaluation (only when tracing is on; see Tracer)
+    void print_balance(const double predicted, const double measured) const;
 
   public:
-    DFDist(const int nbas, const int naux, const std::shared_ptr<DFBlock> block = nullptr, std::shared_ptr<const ParallelDF> df = nullptr, std::shared_ptr<Matrix> data2 = nullptr,
+    DFDist(const int nbas, const int naux, const std::shared_ptr<DFBlock> block = nullptr, std::shared_ptr<const ParallelDF> df = nullptr, std::shared_ptr<const Matrix> data2 = nullptr,
            const bool serial = false) : ParallelDF(naux, nbas, nbas, df, data2, serial) {
       if (block)
         block_.push_back(block);
@@ -74,6 +79,8 @@ class DFDist : public ParallelDF {
 
     // split up smalleri integrals into 6 dfdist objects
     virtual std::vector<std::shared_ptr<const DFDist>> split_blocks() const {
+      if (disk_)
+        return {std::make_shared<const DFDist>(nindex1_, naux_, disk_->load(), df_, data2_)};
       std::vector<std::shared_ptr<const DFDist>> out;
       assert(nindex1_ == nindex2_);
       for (auto& i : block_)
@@ -123,9 +130,72 @@ class DFDist_ints : public DFDist {
 
     }
 
+    // Only the symmetry-unique (P|ij) shell triples are computed; the others are obtained by the operations that
+    // keep the auxiliary shells of this process within this process (abelian groups; requires Nblocks() == 1).
+    void compute_3index_sym(const std::vector<std::shared_ptr<const Shell>>& ashell, const std::vector<std::shared_ptr<const Shell>>& myashell,
+                            const std::vector<std::shared_ptr<const Shell>>& bshell, std::shared_ptr<const Petite> plist, std::shared_ptr<const Petite> aux_plist,
+                            const double thresh, const bool compute_inv) {
+      Timer time;
+      const int a0 = std::find(ashell.begin(), ashell.end(), myashell.front()) - ashell.begin();
+      const int na = myashell.size();
+      const int nb = bshell.size();
+
+      std::vector<int> ops;
+      for (int iop = 0; iop != plist->nsymop(); ++iop) {
+        bool closed = true;
+        for (int a = a0; closed && a != a0+na; ++a)
+          closed = aux_plist->shellmap(a, iop) >= a0 && aux_plist->shellmap(a, iop) < a0+na;
+        if (closed)
+          ops.push_back(iop);
+      }
+
+      std::vector<int> aoffset(na+1, 0), boffset(nb+1, 0);
+      for (int a = 0; a != na; ++a) aoffset[a+1] = aoffset[a] + myashell[a]->nbasis();
+      for (int b = 0; b != nb; ++b) boffset[b+1] = boffset[b] + bshell[b]->nbasis();
+
+      TaskQueue<DFIntTaskSym<TBatch>> tasks(na*nb*(nb+1)/2/ops.size()+1);
+      auto i3 = std::make_shared<const Shell>(ashell.front()->spherical());
+      std::array<std::shared_ptr<DFBlock>,1> blk{{block_[0]}};
+
+      for (int j2 = 0; j2 != nb; ++j2) {
+        for (int j1 = 0; j1 <= j2; ++j1) {
+          for (int j0 = 0; j0 != na; ++j0) {
+            // the triple is unique if no operation maps it onto a smaller one; distinct images are collected
+            const std::array<int,3> key{{a0+j0, j2, j1}};
+            std::vector<std::pair<std::array<int,3>,int>> images;
+            bool unique = true;
+            for (auto& iop : ops) {
+              const int g1 = plist->shellmap(j1, iop);
+              const int g2 = plist->shellmap(j2, iop);
+              const std::array<int,3> gkey{{aux_plist->shellmap(a0+j0, iop), std::max(g1, g2), std::min(g1, g2)}};
+              if (gkey < key) {
+                unique = false;
+                break;
+              }
+              if (std::find_if(images.begin(), images.end(), [&gkey](const std::pair<std::array<int,3>,int>& o) { return o.first == gkey; }) == images.end())
+                images.emplace_back(gkey, iop);
+            }
+            if (!unique) continue;
+
+            std::vector<std::pair<int,std::array<int,3>>> offsets;
+            for (auto& i : images) {
+              const int iop = i.second;
+              offsets.emplace_back(iop, std::array<int,3>{{boffset[plist->shellmap(j2, iop)], boffset[plist->shellmap(j1, iop)], aoffset[i.first[0]-a0]}});
+            }
+            tasks.emplace_back((std::array<std::shared_ptr<const Shell>,4>{{i3, myashell[j0], bshell[j1], bshell[j2]}}), (std::array<int,3>{{boffset[j2], boffset[j1], aoffset[j0]}}),
+                               blk, plist, aux_plist, (std::array<int,3>{{a0+j0, j1, j2}}), std::move(offsets));
+          }
+        }
+      }
+      time.tick_print("3-index ints prep");
+      tasks.compute();
+      time.tick_print("3-index ints");
+    }
+
   public:
     DFDist_ints(const int nbas, const int naux, const std::vector<std::shared_ptr<const Atom>>& atoms, const std::vector<std::shared_ptr<const Atom>>& aux_atoms,
-                const double thr, const bool inverse, const double dum, const bool average = false, const std::shared_ptr<Matrix> data2 = nullptr, const bool serial = false)
+                const double thr, const bool inverse, const double dum, const bool average = false, const std::shared_ptr<const Matrix> data2 = nullptr, const bool serial = false,
+                const std::shared_ptr<const Petite> plist = nullptr)
       : DFDist(nbas, naux, nullptr, nullptr, nullptr, serial) {
 
       // 3index Integral is now made in DFBlock.
@@ -136,8 +206,9 @@ class DFDist_ints : public DFDist {
 
       // distribute auxiliary shells to each nodes
       int astart;
+      double acost;
       std::vector<std::shared_ptr<const Shell>> myashell;
-      std::tie(astart, myashell) = get_ashell(ashell);
+      std::tie(astart, myashell, acost) = get_ashell(ashell, b1shell);
 
       std::shared_ptr<const StaticDist> adist_shell = make_table(astart);
       std::shared_ptr<const StaticDist> adist_averaged = std::make_shared<const StaticDist>(naux_, mpi__->size());
@@ -150,7 +221,12 @@ class DFDist_ints : public DFDist {
         block_.push_back(std::make_shared<DFBlock>(adist_shell, adist_averaged, asize, b1size, b2size, astart, 0, 0));
 
       // 3-index integrals
-      compute_3index(myashell, b1shell, b2shell, asize, b1size, b2size, astart, thr, inverse);
+      Timer time;
+      if (TBatch::Nblocks() == 1 && plist && plist->nirrep() > 1)
+        compute_3index_sym(ashell, myashell, b1shell, plist, std::make_shared<const Petite>(aux_atoms, plist->symop()), thr, inverse);
+      else
+        compute_3index(myashell, b1shell, b2shell, asize, b1size, b2size, astart, thr, inverse);
+      print_balance(acost, time.tick());
 
       // 2-index integrals
       if (data2)
@@ -119,6 +119,14 @@ shared_ptr<DFBlock> DFBlock::slice_b1(const int slice_start, const int slice_siz
 }
 
 
+shared_ptr<DFBlock> DFBlock::slice_b2(const int slice_start, const int slice_size) const {
+  assert(slice_start >= 0 && slice_start + slice_size <= b2size());
+  auto out = make_shared<DFBlock>(adist_shell_, adist_, asize(), b1size(), slice_size, astart_, b1start_, b2start_, averaged_);
+  copy_n(data() + asize()*b1size()*slice_start, asize()*b1size()*slice_size, out->data());
+  return out;
+}
+
+
 shared_ptr<DFBlock> DFBlock::clone() const {
   auto out = make_shared<DFBlock>(adist_shell_, adist_, asize(), b1size(), b2size(), astart_, b1start_, b2start_, averaged_);
   out->zero();
@@ -85,6 +85,8 @@ class DFBlock : public btas::Tensor3<double> {
 
     // dist
     const std::shared_ptr<const StaticDist>& adist_now() const { return averaged_ ? adist_ : adist_shell_; }
+    const std::shared_ptr<const StaticDist>& adist_shell() const { return adist_shell_; }
+    const std::shared_ptr<const StaticDist>& adist() const { return adist_; }
 
 
     // some math functions
@@ -124,6 +126,7 @@ class DFBlock : public btas::Tensor3<double> {
 
     std::shared_ptr<DFBlock> merge_b1(std::shared_ptr<const DFBlock> o) const;
     std::shared_ptr<DFBlock> slice_b1(const int start, const int size) const;
+    std::shared_ptr<DFBlock> slice_b2(const int start, const int size) const;
 
     // add ab^+  to this.
     void add_direct_product(const VecView a, const MatView b, const double fac);
@@ -0,0 +1,132 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: dfblockfile.cc
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <cstdio>
+#include <future>
+#include <stdlib.h>
+#include <unistd.h>
+#include <src/df/dfblockfile.h>
+
+using namespace std;
+using namespace bagel;
+
+DFBlockFile::DFBlockFile(shared_ptr<const DFBlock> block, const string& directory, const size_t memory)
+ : adist_shell_(block->adist_shell()), adist_(block->adist()), averaged_(block->averaged()),
+   asize_(block->asize()), b1size_(block->b1size()), b2size_(block->b2size()),
+   astart_(block->astart()), b1start_(block->b1start()), b2start_(block->b2start()), memory_(memory), nread_(0), time_read_(0.0), time_wait_(0.0) {
+
+  const size_t slabsize = max(asize_*b1size_, size_t(1));
+  slab_ = max(min(memory / (2*slabsize), b2size_), size_t(1));
+
+  string name = directory + "/bagel_df_XXXXXX";
+  vector<char> tmpl(name.begin(), name.end());
+  tmpl.push_back('\0');
+  const int fd = mkstemp(tmpl.data());
+  if (fd < 0)
+    throw runtime_error("could not create a file for the 3-index integrals in " + directory);
+  close(fd);
+  filename_ = string(tmpl.data());
+
+  ofstream fs(filename_, ios::binary);
+  fs.write(reinterpret_cast<const char*>(block->data()), block->size()*sizeof(double));
+  if (!fs)
+    throw runtime_error("failed to write the 3-index integrals to " + filename_);
+}
+
+
+DFBlockFile::~DFBlockFile() {
+  remove(filename_.c_str());
+  if (nread_ > 0)
+    cout << "    * out-of-core 3-index integrals: " << fixed << setprecision(2) << nread_*sizeof(double)*1.0e-9 << " GB read in "
+         << time_read_ << " sec, " << time_wait_ << " sec waiting for disk" << endl;
+}
+
+
+shared_ptr<DFBlock> DFBlockFile::read_slab(ifstream& fs, const size_t offset, const size_t n) const {
+  assert(offset+n <= b2size_);
+  Timer time;
+  auto out = make_shared<DFBlock>(adist_shell_, adist_, asize_, b1size_, n, astart_, b1start_, b2start_, averaged_);
+  fs.seekg(asize_*b1size_*offset*sizeof(double));
+  fs.read(reinterpret_cast<char*>(out->data()), out->size()*sizeof(double));
+  if (!fs)
+    throw runtime_error("failed to read the 3-index integrals from " + filename_);
+
+  lock_guard<mutex> lock(mut_);
+  nread_ += out->size();
+  time_read_ += time.tick();
+  return out;
+}
+
+
+void DFBlockFile::stream(function<void(shared_ptr<const DFBlock>, const size_t)> func) const {
+  ifstream fs(filename_, ios::binary);
+  auto read = [this, &fs](const size_t i) { return read_slab(fs, i*slab_, min(slab_, b2size_-i*slab_)); };
+
+  future<shared_ptr<DFBlock>> next = async(launch::async, read, 0);
+  for (size_t i = 0; i != nslab(); ++i) {
+    Timer time;
+    shared_ptr<DFBlock> current = next.get();
+    {
+      lock_guard<mutex> lock(mut_);
+      time_wait_ += time.tick();
+    }
+    // the next slab is read while this one is processed
+    if (i+1 != nslab())
+      next = async(launch::async, read, i+1);
+    func(current, i*slab_);
+  }
+}
+
+
+shared_ptr<DFBlock> DFBlockFile::read(const size_t offset, const size_t n) const {
+  ifstream fs(filename_, ios::binary);
+  return read_slab(fs, offset, n);
+}
+
+
+shared_ptr<DFBlock> DFBlockFile::load() const {
+  auto out = make_shared<DFBlock>(adist_shell_, adist_, asize_, b1size_, b2size_, astart_, b1start_, b2start_, averaged_);
+  stream([&](shared_ptr<const DFBlock> slab, const size_t offset) {
+    copy_n(slab->data(), slab->size(), out->data()+asize_*b1size_*offset);
+  });
+  return out;
+}
+
+
+shared_ptr<const DFBlock> DFBlockFile::load_shared() const {
+  lock_guard<mutex> lock(loaded_mut_);
+  shared_ptr<const DFBlock> out = loaded_.lock();
+  if (!out) {
+    out = load();
+    loaded_ = out;
+  }
+  return out;
+}
+
+
+shared_ptr<DFBlock> DFBlockFile::clone() const {
+  auto out = make_shared<DFBlock>(adist_shell_, adist_, asize_, b1size_, b2size_, astart_, b1start_, b2start_, averaged_);
+  out->zero();
+  return out;
+}
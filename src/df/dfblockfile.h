@@ -0,0 +1,103 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: dfblockfile.h
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef __SRC_DF_DFBLOCKFILE_H
+#define __SRC_DF_DFBLOCKFILE_H
+
+#include <mutex>
+#include <fstream>
+#include <functional>
+#include <src/df/dfblock.h>
+
+namespace bagel {
+
+/*
+    DFBlockFile holds a DFBlock on disk. The block is read back in slabs of the slowest index (b2),
+    and the next slab is read asynchronously while the current one is being processed.
+*/
+
+class DFBlockFile {
+  protected:
+    // information of the original block
+    std::shared_ptr<const StaticDist> adist_shell_;
+    std::shared_ptr<const StaticDist> adist_;
+    bool averaged_;
+    size_t asize_, b1size_, b2size_;
+    size_t astart_, b1start_, b2start_;
+
+    // number of doubles for the two slab buffers
+    size_t memory_;
+    // number of b2 indices in one slab
+    size_t slab_;
+    std::string filename_;
+
+    // statistics
+    mutable std::mutex mut_;
+    mutable size_t nread_;
+    mutable double time_read_;
+    mutable double time_wait_;
+
+    // the block returned by load_shared; it stays in memory only while a caller holds it
+    mutable std::mutex loaded_mut_;
+    mutable std::weak_ptr<const DFBlock> loaded_;
+
+    // reads b2 indices [offset, offset+n)
+    std::shared_ptr<DFBlock> read_slab(std::ifstream& fs, const size_t offset, const size_t n) const;
+
+  public:
+    // memory is the number of doubles that can be used for the two slab buffers
+    DFBlockFile(std::shared_ptr<const DFBlock> block, const std::string& directory, const size_t memory);
+    ~DFBlockFile();
+
+    size_t asize() const { return asize_; }
+    size_t b1size() const { return b1size_; }
+    size_t b2size() const { return b2size_; }
+    size_t size() const { return asize_*b1size_*b2size_; }
+    size_t astart() const { return astart_; }
+    size_t b1start() const { return b1start_; }
+    size_t b2start() const { return b2start_; }
+    const std::shared_ptr<const StaticDist>& adist_now() const { return averaged_ ? adist_ : adist_shell_; }
+
+    size_t memory() const { return memory_; }
+    size_t slab() const { return slab_; }
+    size_t nslab() const { return (b2size_+slab_-1) / slab_; }
+
+    // Calls func(slab, offset) for every slab in order; slab contains b2 indices [offset, offset+slab->b2size()).
+    // The offsets of the slabs are those of the original block.
+    void stream(std::function<void(std::shared_ptr<const DFBlock>, const size_t)> func) const;
+
+    // reads b2 indices [offset, offset+n) of the block (the offsets of the returned block are those of the original block)
+    std::shared_ptr<DFBlock> read(const size_t offset, const size_t n) const;
+
+    // reads the entire block into memory
+    std::shared_ptr<DFBlock> load() const;
+    // same as load, but callers that hold the block at the same time share one copy
+    std::shared_ptr<const DFBlock> load_shared() const;
+    // a zero block of the same shape (in memory)
+    std::shared_ptr<DFBlock> clone() const;
+};
+
+}
+
+#endif
@@ -80,7 +80,7 @@ DFDistT::DFDistT(const size_t naux, shared_ptr<const StaticDist> dist, const siz
                  const shared_ptr<const ParallelDF> p)
  : naux_(naux), nindex1_(nindex1), nindex2_(nindex2), dist_(dist), bstart_(dist->start(mpi__->rank())), bsize_(dist->size(mpi__->rank())), df_(p) {
 
-  const int nblock = p->block().size();
+  const int nblock = p->nblocks();
   for (int i = 0; i != nblock; ++i)
     data_.push_back(make_shared<Matrix>(naux_, bsize_, true));
 
@@ -27,6 +27,7 @@
 
 #include <src/df/dfblock.h>
 #include <src/molecule/shell.h>
+#include <src/molecule/petite.h>
 
 namespace bagel {
 
@@ -47,6 +48,16 @@ class DFIntTask {
     DFIntTask(std::array<std::shared_ptr<const Shell>,4>&& a, std::array<int,3>&& b, std::array<std::shared_ptr<DFBlock>,N>& df)
      : shell_(a), offset_(b), dfblocks_(df) { };
 
+    // rough estimate of the work used by TaskQueue: number of primitive triples times the size of the Cartesian batch
+    double cost() const {
+      double out = 1.0;
+      for (int i = 1; i != 4; ++i) {
+        const int l = shell_[i]->angular_number();
+        out *= shell_[i]->num_primitive() * (l+1)*(l+2)/2;
+      }
+      return out;
+    }
+
     void compute() {
       std::shared_ptr<TBatch> p = compute_batch(shell_);
 
@@ -69,6 +80,55 @@ class DFIntTask {
 };
 
 
+// Integrals of a symmetry-unique shell triple, copied to the symmetry-equivalent blocks with the sign of the functions.
+template <typename TBatch>
+class DFIntTaskSym : public DFIntTask<TBatch,1> {
+  protected:
+    std::shared_ptr<const Petite> plist_;
+    std::shared_ptr<const Petite> aux_plist_;
+    // shell indices (auxiliary, basis, basis) in the Petite objects
+    const std::array<int,3> index_;
+    // symmetry operations that generate distinct blocks and the offsets of those blocks
+    const std::vector<std::pair<int,std::array<int,3>>> image_;
+
+  public:
+    DFIntTaskSym(std::array<std::shared_ptr<const Shell>,4>&& a, std::array<int,3>&& b, std::array<std::shared_ptr<DFBlock>,1>& df,
+                 std::shared_ptr<const Petite> p, std::shared_ptr<const Petite> ap, std::array<int,3>&& index, std::vector<std::pair<int,std::array<int,3>>>&& image)
+     : DFIntTask<TBatch,1>(std::move(a), std::move(b), df), plist_(p), aux_plist_(ap), index_(index), image_(image) { }
+
+    void compute() {
+      std::shared_ptr<TBatch> p = this->compute_batch(this->shell_);
+      const std::vector<int>& pa = aux_plist_->parity(index_[0]);
+      const std::vector<int>& p1 = plist_->parity(index_[1]);
+      const std::vector<int>& p2 = plist_->parity(index_[2]);
+      const int na = this->shell_[1]->nbasis();
+      const int n1 = this->shell_[2]->nbasis();
+      const int n2 = this->shell_[3]->nbasis();
+
+      const size_t nbin = this->dfblocks_[0]->b1size();
+      const size_t naux = this->dfblocks_[0]->asize();
+      double* const data = this->dfblocks_[0]->data();
+      std::vector<double> sa(na);
+      for (auto& image : image_) {
+        const int iop = image.first;
+        const std::array<int,3>& offset = image.second;
+        for (int i = 0; i != na; ++i)
+          sa[i] = aux_plist_->sign(pa[i], iop);
+        const double* ppt = p->data(0);
+        for (int j0 = 0; j0 != n2; ++j0) {
+          const int s0 = plist_->sign(p2[j0], iop);
+          for (int j1 = 0; j1 != n1; ++j1, ppt += na) {
+            const int s01 = s0 * plist_->sign(p1[j1], iop);
+            double* const t0 = data+offset[2]+naux*(offset[1]+j1+nbin*(offset[0]+j0));
+            double* const t1 = data+offset[2]+naux*(offset[0]+j0+nbin*(offset[1]+j1));
+            for (int i = 0; i != na; ++i)
+              t0[i] = t1[i] = s01 * sa[i] * ppt[i];
+          }
+        }
+      }
+    }
+};
+
 }
 
 #endif
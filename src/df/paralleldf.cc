@@ -29,24 +29,71 @@ using namespace std;
 using namespace bagel;
 
 
-ParallelDF::ParallelDF(const size_t naux, const size_t nb1, const size_t nb2, shared_ptr<const ParallelDF> df, shared_ptr<Matrix> dat, const bool serial)
+ParallelDF::ParallelDF(const size_t naux, const size_t nb1, const size_t nb2, shared_ptr<const ParallelDF> df, shared_ptr<const Matrix> dat, const bool serial)
  : naux_(naux), nindex1_(nb1), nindex2_(nb2), df_(df), data2_(dat), serial_(df ? df->serial_ : serial) {
 
 }
 
 
+void ParallelDF::for_each_slab(function<void(shared_ptr<const DFBlock>, const size_t)> func) const {
+  if (nblocks() != 1) throw logic_error("so far assumes block_.size() == 1");
+  if (disk_)
+    disk_->stream(func);
+  else
+    func(block_[0], 0);
+}
+
+
+shared_ptr<const DFBlock> ParallelDF::read_slab(const size_t offset, const size_t n) const {
+  if (nblocks() != 1) throw logic_error("so far assumes block_.size() == 1");
+  if (disk_)
+    return disk_->read(offset, n);
+  return (offset == 0 && n == block_[0]->b2size()) ? block_[0] : block_[0]->slice_b2(offset, n);
+}
+
+
 shared_ptr<Matrix> ParallelDF::form_2index(shared_ptr<const ParallelDF> o, const double a, const bool swap) const {
-  if (block_.size() != 1 || o->block_.size() != 1) throw logic_error("so far assumes block_.size() == 1");
-  shared_ptr<Matrix> out = (!swap) ? block_[0]->form_2index(o->block_[0], a) : o->block_[0]->form_2index(block_[0], a);
+  if (nblocks() != 1 || o->nblocks() != 1) throw logic_error("so far assumes block_.size() == 1");
+  shared_ptr<Matrix> out;
+  if (!disk_ && !o->disk_)
+    out = (!swap) ? block_[0]->form_2index(o->block_[0], a) : o->block_[0]->form_2index(block_[0], a);
+  else
+    out = (!swap) ? form_2index_slabs(o, a) : o->form_2index_slabs(shared_from_this(), a);
   if (!serial_)
     out->allreduce();
   return out;
 }
 
 
+shared_ptr<Matrix> ParallelDF::form_2index_slabs(shared_ptr<const ParallelDF> o, const double a) const {
+  shared_ptr<Matrix> out;
+  if (nindex1_ == o->nindex1_) {
+    // each pair of slabs gives a block of the result
+    out = make_shared<Matrix>(nindex2_, o->nindex2_);
+    for_each_slab([&](shared_ptr<const DFBlock> slab, const size_t offset) {
+      o->for_each_slab([&](shared_ptr<const DFBlock> oslab, const size_t ooffset) {
+        out->copy_block(offset, ooffset, slab->b2size(), oslab->b2size(), slab->form_2index(oslab, a));
+      });
+    });
+  } else {
+    // contributions from the slabs are accumulated
+    assert(nindex2_ == o->nindex2_);
+    out = make_shared<Matrix>(nindex1_, o->nindex1_);
+    for_each_slab([&](shared_ptr<const DFBlock> slab, const size_t offset) {
+      *out += *slab->form_2index(o->read_slab(offset, slab->b2size()), a);
+    });
+  }
+  return out;
+}
+
+
 shared_ptr<Matrix> ParallelDF::form_4index(shared_ptr<const ParallelDF> o, const double a, const bool swap) const {
-  if (block_.size() != 1 || o->block_.size() != 1) throw logic_error("so far assumes block_.size() == 1");
-  shared_ptr<Matrix> out = (!swap) ? block_[0]->form_4index(o->block_[0], a) : o->block_[0]->form_4index(block_[0], a);
+  if (nblocks() != 1 || o->nblocks() != 1) throw logic_error("so far assumes block_.size() == 1");
+  shared_ptr<Matrix> out;
+  if (!disk_ && !o->disk_)
+    out = (!swap) ? block_[0]->form_4index(o->block_[0], a) : o->block_[0]->form_4index(block_[0], a);
+  else
+    out = (!swap) ? form_4index_slabs(o, a) : o->form_4index_slabs(shared_from_this(), a);
 
   // all reduce
   if (!serial_)
@@ -55,10 +102,40 @@ shared_ptr<Matrix> ParallelDF::form_4index(shared_ptr<const ParallelDF> o, const
 }
 
 
+shared_ptr<Matrix> ParallelDF::form_4index_slabs(shared_ptr<const ParallelDF> o, const double a) const {
+  // b2 runs slowest in the compound indices, so that a slab is a contiguous set of rows (or columns)
+  auto out = make_shared<Matrix>(nindex1_*nindex2_, o->nindex1_*o->nindex2_);
+  for_each_slab([&](shared_ptr<const DFBlock> slab, const size_t offset) {
+    o->for_each_slab([&](shared_ptr<const DFBlock> oslab, const size_t ooffset) {
+      out->copy_block(nindex1_*offset, o->nindex1_*ooffset, slab->b1size()*slab->b2size(), oslab->b1size()*oslab->b2size(), slab->form_4index(oslab, a));
+    });
+  });
+  return out;
+}
+
+
 shared_ptr<Matrix> ParallelDF::form_aux_2index(shared_ptr<const ParallelDF> o, const double a) const {
-  if (block_.size() != 1 || o->block_.size() != 1) throw logic_error("so far assumes block_.size() == 1");
+  if (nblocks() != 1 || o->nblocks() != 1) throw logic_error("so far assumes block_.size() == 1");
+  if (nindex1_ != o->nindex1_ || nindex2_ != o->nindex2_) throw logic_error("illegal call of ParallelDF::form_aux_2index");
 #ifdef HAVE_MPI_H
-  if (!serial_) {
+  if (!serial_ && (disk_ || o->disk_)) {
+    // Each process forms its rows of the result, for which the aux index of o is gathered slab by slab.
+    // The slab size has to be the same on all the processes.
+    const size_t memory = disk_ ? disk_->memory() : o->disk_->memory();
+    const size_t slab = max(memory / (2*max(naux_, o->naux_)*nindex1_), size_t(1));
+    auto out = make_shared<Matrix>(naux_, o->naux_);
+    for (size_t offset = 0; offset < nindex2_; offset += slab) {
+      const size_t n = min(slab, nindex2_-offset);
+      shared_ptr<const DFBlock> blk = read_slab(offset, n);
+      shared_ptr<const DFBlock> oblk = o->read_slab(offset, n);
+      Matrix ofull(o->naux_, nindex1_*n);
+      ofull.copy_block(oblk->astart(), 0, oblk->asize(), nindex1_*n, oblk->data());
+      ofull.allreduce();
+      dgemm_("N", "T", blk->asize(), o->naux_, nindex1_*n, a, blk->data(), blk->asize(), ofull.data(), o->naux_, 1.0, out->element_ptr(blk->astart(), 0), naux_);
+    }
+    out->allreduce();
+    return out;
+  } else if (!serial_) {
     auto work = make_shared<DFDistT>(this->shared_from_this());
     auto work2 = make_shared<DFDistT>(o);
     return work->form_aux_2index(work2, a).front();
@@ -66,12 +143,21 @@ shared_ptr<Matrix> ParallelDF::form_aux_2index(shared_ptr<const ParallelDF> o, c
 #else
   {
 #endif
-    return block_[0]->form_aux_2index(o->block_[0], a);
+    shared_ptr<Matrix> out;
+    for_each_slab([&](shared_ptr<const DFBlock> slab, const size_t offset) {
+      shared_ptr<Matrix> tmp = slab->form_aux_2index(o->read_slab(offset, slab->b2size()), a);
+      if (!out)
+        out = tmp;
+      else
+        *out += *tmp;
+    });
+    return out;
   }
 }
 
 
 void ParallelDF::add_direct_product(const vector<shared_ptr<const VectorB>> cd, const vector<shared_ptr<const Matrix>> dd, const double a) {
+  make_resident();
   if (block_.size() != 1) throw logic_error("so far assumes block_.size() == 1");
   if (cd.size() != dd.size()) throw logic_error("Illegal call of ParallelDF::DFDist");
 
@@ -85,6 +171,15 @@ void ParallelDF::add_direct_product(const vector<shared_ptr<const VectorB>> cd,
 
 
 void ParallelDF::ax_plus_y(const double a, const shared_ptr<const ParallelDF> o) {
+  make_resident();
+  if (o->disk_) {
+    assert(block_.size() == 1);
+    const size_t slabsize = block_[0]->asize()*block_[0]->b1size();
+    o->for_each_slab([&](shared_ptr<const DFBlock> slab, const size_t offset) {
+      blas::ax_plus_y_n(a, slab->data(), slab->size(), block_[0]->data()+slabsize*offset);
+    });
+    return;
+  }
   assert(block_.size() == o->block_.size());
   auto j = o->block_.begin();
   for (auto& i : block_)
@@ -93,30 +188,36 @@ void ParallelDF::ax_plus_y(const double a, const shared_ptr<const ParallelDF> o)
 
 
 void ParallelDF::scale(const double a) {
+  make_resident();
   for (auto& i : block_)
     i->scale(a);
 }
 
 
 void ParallelDF::symmetrize() {
+  make_resident();
   for (auto& i : block_)
     i->symmetrize();
 }
 
 
 void ParallelDF::add_block(shared_ptr<DFBlock> o) {
+  make_resident();
   block_.push_back(o);
 }
 
 
 shared_ptr<btas::Tensor3<double>> ParallelDF::get_block(const int i, const int id, const int j, const int jd, const int k, const int kd) const {
-  if (block_.size() != 1) throw logic_error("so far assumes block_.size() == 1");
+  if (nblocks() != 1) throw logic_error("so far assumes block_.size() == 1");
   // first thing is to find the node
   tuple<size_t, size_t> info = adist_now()->locate(i);
 
   // date has to be localised in this node
   if (get<0>(info) == mpi__->rank()) {
-    return block_[0]->get_block(i, id, j, jd, k, kd);
+    if (!disk_)
+      return block_[0]->get_block(i, id, j, jd, k, kd);
+    // only the slab of b2 indices [k, k+kd) is read; its offsets are those of the original block
+    return disk_->read(k-disk_->b2start(), kd)->get_block(i, id, j, jd, disk_->b2start(), kd);
   } else {
     throw logic_error("ParallelDF::get_block is an intra-node function (or bug?)");
   }
@@ -125,11 +226,31 @@ shared_ptr<btas::Tensor3<double>> ParallelDF::get_block(const int i, const int i
 
 
 shared_ptr<Matrix> ParallelDF::compute_Jop_from_cd(shared_ptr<const VectorB> tmp0) const {
-  if (block_.size() != 1) throw logic_error("compute_Jop so far assumes block_.size() == 1");
-  shared_ptr<Matrix> out = block_[0]->form_mat(tmp0->slice(block_[0]->astart(), block_[0]->astart()+block_[0]->asize()));
+  return compute_Jop_from_cd(vector<shared_ptr<const VectorB>>{tmp0}).front();
+}
+
+
+vector<shared_ptr<Matrix>> ParallelDF::compute_Jop_from_cd(vector<shared_ptr<const VectorB>> cd) const {
+  if (nblocks() != 1) throw logic_error("compute_Jop so far assumes block_.size() == 1");
+  vector<shared_ptr<Matrix>> out;
+  if (!disk_) {
+    for (auto& i : cd)
+      out.push_back(block_[0]->form_mat(i->slice(block_[0]->astart(), block_[0]->astart()+block_[0]->asize())));
+  } else {
+    vector<btas::Tensor1<double>> fit;
+    for (auto& i : cd) {
+      fit.push_back(i->slice(disk_->astart(), disk_->astart()+disk_->asize()));
+      out.push_back(make_shared<Matrix>(disk_->b1size(), disk_->b2size()));
+    }
+    disk_->stream([&](shared_ptr<const DFBlock> slab, const size_t offset) {
+      for (size_t i = 0; i != cd.size(); ++i)
+        out[i]->copy_block(0, offset, slab->b1size(), slab->b2size(), slab->form_mat(fit[i]));
+    });
+  }
   // all reduce
   if (!serial_)
-    out->allreduce();
+    for (auto& i : out)
+      i->allreduce();
   return out;
 }
 
@@ -141,9 +262,16 @@ shared_ptr<VectorB> ParallelDF::compute_cd(const shared_ptr<const Matrix> den, s
   auto tmp0 = make_shared<VectorB>(naux_);
 
   // D = (D|rs)*d_rs
-  if (block_.size() != 1) throw logic_error("compute_Jop so far assumes block_.size() == 1");
-  shared_ptr<VectorB> tmp = block_[0]->form_vec(den);
-  copy_n(tmp->data(), block_[0]->asize(), tmp0->data()+block_[0]->astart());
+  if (nblocks() != 1) throw logic_error("compute_Jop so far assumes block_.size() == 1");
+  if (!disk_) {
+    shared_ptr<VectorB> tmp = block_[0]->form_vec(den);
+    copy_n(tmp->data(), block_[0]->asize(), tmp0->data()+block_[0]->astart());
+  } else {
+    disk_->stream([&](shared_ptr<const DFBlock> slab, const size_t offset) {
+      shared_ptr<VectorB> tmp = slab->form_vec(den->get_submatrix(0, offset, slab->b1size(), slab->b2size()));
+      blas::ax_plus_y_n(1.0, tmp->data(), slab->asize(), tmp0->data()+slab->astart());
+    });
+  }
   // All reduce
   if (!serial_)
     tmp0->allreduce();
@@ -170,3 +298,14 @@ shared_ptr<Matrix> ParallelDF::compute_Jop(const shared_ptr<const ParallelDF> o,
   return compute_Jop_from_cd(tmp0);
 }
 
+
+void ParallelDF::offload_3index(const string& directory, const double memory) {
+  if (disk_ || block_.size() != 1)
+    return;
+
+  Timer time;
+  disk_ = make_shared<DFBlockFile>(block_[0], directory, static_cast<size_t>(memory*1024*1024/sizeof(double)));
+  block_.clear();
+  time.tick_print("3-index ints written to disk");
+  cout << "        slab size " << disk_->slab() << " (" << disk_->nslab() << " slabs)" << endl;
+}
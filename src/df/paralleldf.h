@@ -28,7 +28,7 @@
 
 #include <src/df/dfinttask_old.h>
 #include <src/df/dfinttask.h>
-#include <src/df/dfblock.h>
+#include <src/df/dfblockfile.h>
 
 namespace bagel {
 
@@ -45,12 +45,32 @@ class ParallelDF : public std::enable_shared_from_this<ParallelDF> {
     std::shared_ptr<const ParallelDF> df_;
     // data2_ is usually empty (except for the original DFDist)
     // AO two-index integrals ^ -1/2
-    std::shared_ptr<Matrix> data2_;
+    std::shared_ptr<const Matrix> data2_;
 
     bool serial_;
 
+    // when set, the (single) block is kept on disk and block_ is empty
+    std::shared_ptr<DFBlockFile> disk_;
+
+    // reads offloaded integrals back into memory; used before in-place modifications
+    void make_resident() {
+      if (disk_) {
+        block_.push_back(disk_->load());
+        disk_.reset();
+      }
+    }
+    // calls func(slab, offset) for slabs of the slowest index of the (single) block.
+    // Offloaded integrals are streamed from disk; otherwise func is called once with the whole block.
+    void for_each_slab(std::function<void(std::shared_ptr<const DFBlock>, const size_t)> func) const;
+    // b2 indices [offset, offset+n) of the (single) block
+    std::shared_ptr<const DFBlock> read_slab(const size_t offset, const size_t n) const;
+
+    // slab-wise versions of the DFBlock functions that are used when either operand is on disk
+    std::shared_ptr<Matrix> form_2index_slabs(std::shared_ptr<const ParallelDF> o, const double a) const;
+    std::shared_ptr<Matrix> form_4index_slabs(std::shared_ptr<const ParallelDF> o, const double a) const;
+
   public:
-    ParallelDF(const size_t, const size_t, const size_t, std::shared_ptr<const ParallelDF> = nullptr, std::shared_ptr<Matrix> = nullptr, const bool serial = false);
+    ParallelDF(const size_t, const size_t, const size_t, std::shared_ptr<const ParallelDF> = nullptr, std::shared_ptr<const Matrix> = nullptr, const bool serial = false);
     virtual ~ParallelDF() { }
 
     size_t naux() const { return naux_; }
@@ -59,13 +79,27 @@ class ParallelDF : public std::enable_shared_from_this<ParallelDF> {
     size_t size() const { return naux_*nindex1_*nindex2_; }
 
     bool serial() const { return serial_; }
+    // number of blocks (without reading offloaded integrals)
+    size_t nblocks() const { return disk_ ? 1 : block_.size(); }
+
+    // non-const access reads offloaded integrals back into memory for good
+    std::vector<std::shared_ptr<DFBlock>>& block() { make_resident(); return block_; }
+    const std::vector<std::shared_ptr<DFBlock>>& block() const {
+      if (disk_) throw std::logic_error("ParallelDF::block is not available for 3-index integrals stored on disk");
+      return block_;
+    }
+    std::shared_ptr<DFBlock> block(const size_t i) { make_resident(); return block_[i]; }
+    // an offloaded block is read back into memory and shared until the last caller releases it
+    std::shared_ptr<const DFBlock> block(const size_t i) const { assert(!disk_ || i == 0); return disk_ ? disk_->load_shared() : block_[i]; }
+    // size and aux offset of the local block (without reading offloaded integrals)
+    size_t block_size() const { return disk_ ? disk_->size() : block_[0]->size(); }
+    size_t block_astart() const { return disk_ ? disk_->astart() : block_[0]->astart(); }
 
-    std::vector<std::shared_ptr<DFBlock>>& block() { return block_; }
-    const std::vector<std::shared_ptr<DFBlock>>& block() const { return block_; }
-    std::shared_ptr<DFBlock> block(const size_t i) { return block_[i]; }
-    std::shared_ptr<const DFBlock> block(const size_t i) const { return block_[i]; }
+    std::shared_ptr<const StaticDist> adist_now() const { return disk_ ? disk_->adist_now() : block_[0]->adist_now(); }
 
-    std::shared_ptr<const StaticDist> adist_now() const { return block_[0]->adist_now(); }
+    // moves the 3-index integrals to a file in directory. memory (in MB) is used for the two slab buffers when streaming them back.
+    void offload_3index(const std::string& directory, const double memory);
+    bool offloaded() const { return !!disk_; }
 
     void add_block(std::shared_ptr<DFBlock> o);
 
@@ -90,9 +124,12 @@ class ParallelDF : public std::enable_shared_from_this<ParallelDF> {
     std::shared_ptr<Matrix> compute_Jop(const std::shared_ptr<const Matrix> den) const;
     std::shared_ptr<Matrix> compute_Jop(const std::shared_ptr<const ParallelDF> o, const std::shared_ptr<const Matrix> den, const bool onlyonce = false) const;
     std::shared_ptr<Matrix> compute_Jop_from_cd(std::shared_ptr<const VectorB> cd) const;
+    // J operators for several vectors; offloaded integrals are read only once
+    std::vector<std::shared_ptr<Matrix>> compute_Jop_from_cd(std::vector<std::shared_ptr<const VectorB>> cd) const;
     std::shared_ptr<VectorB> compute_cd(const std::shared_ptr<const Matrix> den, std::shared_ptr<const Matrix> dat2 = nullptr, const int number_of_j = 2) const;
 
     void average_3index() {
+      make_resident();
       Timer time;
       if (!serial_)
         for (auto& i : block_)
@@ -101,6 +138,7 @@ class ParallelDF : public std::enable_shared_from_this<ParallelDF> {
     }
 
     void shell_boundary_3index() {
+      make_resident();
       if (!serial_)
         for (auto& i : block_)
           i->shell_boundary();
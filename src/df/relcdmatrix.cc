@@ -28,13 +28,30 @@
 using namespace std;
 using namespace bagel;
 
-// Also, C and D matrices are either real (for Coulomb) or purely imaginary (for Gaunt and Breit) due to symmetry. We are not taking advantage of it.
+// Also, C and D matrices are either real (for Coulomb) or purely imaginary (for Gaunt and Breit) due to symmetry. This is used in RelDF::compute_Jop.
+
+namespace {
+  // coefficients are often purely real or purely imaginary (null pointers denote zero blocks); multiplications by zero are skipped
+  ZVectorB compute_cd(shared_ptr<const RelDFHalf> dfhc, shared_ptr<const Matrix> tr, shared_ptr<const Matrix> ti, shared_ptr<const Matrix> dat2, const int number_of_j) {
+    assert(tr || ti);
+    const size_t naux = dfhc->get_real()->naux();
+    VectorB r(naux), i(naux);
+    if (tr) {
+      r.ax_plus_y( 1.0, dfhc->get_real()->compute_cd(tr, dat2, number_of_j));
+      i.ax_plus_y( 1.0, dfhc->get_imag()->compute_cd(tr, dat2, number_of_j));
+    }
+    if (ti) {
+      r.ax_plus_y(-1.0, dfhc->get_imag()->compute_cd(ti, dat2, number_of_j));
+      i.ax_plus_y( 1.0, dfhc->get_real()->compute_cd(ti, dat2, number_of_j));
+    }
+    return ZVectorB(r, i);
+  }
+}
+
 
 RelCDMatrix::RelCDMatrix(shared_ptr<const RelDFHalf> dfhc, shared_ptr<const SpinorInfo> abc, array<shared_ptr<const Matrix>, 4> trcoeff,
                          array<shared_ptr<const Matrix>, 4> ticoeff, shared_ptr<const Matrix> dat2, const int number_of_j)
- : ZVectorB(*dfhc->get_real()->compute_cd(trcoeff[abc->basis(1)], dat2, number_of_j)-*dfhc->get_imag()->compute_cd(ticoeff[abc->basis(1)], dat2, number_of_j),
-            *dfhc->get_real()->compute_cd(ticoeff[abc->basis(1)], dat2, number_of_j)+*dfhc->get_imag()->compute_cd(trcoeff[abc->basis(1)], dat2, number_of_j)),
-   alpha_comp_(abc->alpha_comp()) {
+ : ZVectorB(compute_cd(dfhc, trcoeff[abc->basis(1)], ticoeff[abc->basis(1)], dat2, number_of_j)), alpha_comp_(abc->alpha_comp()) {
 
   btas::scal(abc->fac(dfhc->cartesian()), *this);
 
@@ -71,7 +71,8 @@ vector<shared_ptr<RelDFHalf>> RelDF::compute_half_transform(array<shared_ptr<con
     for (auto& j : basis())
       if (j->basis(0) == i)
         tmp.push_back(j);
-    if (!tmp.empty())
+    // null coefficients denote zero blocks, which do not contribute
+    if (!tmp.empty() && (rc[i] || ic[i]))
       subsets.push_back(tmp);
   }
 
@@ -97,9 +98,15 @@ vector<shared_ptr<ZMatrix>> RelDF::compute_Jop(list<shared_ptr<const RelCDMatrix
 
   // real
   if (!get_imag()) {
+    // C and D vectors are real (Coulomb) or purely imaginary (Gaunt and Breit) for Kramers-symmetric densities; the other part is not computed
+    const double thresh = 1.0e-12;
     for (auto& i : sum) {
-      shared_ptr<const Matrix> rdat = get_real()->compute_Jop_from_cd(i->get_real_part());
-      shared_ptr<const Matrix> idat = get_real()->compute_Jop_from_cd(i->get_imag_part());
+      shared_ptr<const VectorB> cdr = i->get_real_part();
+      shared_ptr<const VectorB> cdi = i->get_imag_part();
+      const double rrms = cdr->rms();
+      const double irms = cdi->rms();
+      shared_ptr<const Matrix> rdat = rrms > thresh*irms ? get_real()->compute_Jop_from_cd(cdr) : make_shared<Matrix>(get_real()->nindex1(), get_real()->nindex2());
+      shared_ptr<const Matrix> idat = irms > thresh*rrms ? get_real()->compute_Jop_from_cd(cdi) : make_shared<Matrix>(get_real()->nindex1(), get_real()->nindex2());
       out.push_back(make_shared<ZMatrix>(*rdat, *idat));
     }
 
@@ -36,21 +36,31 @@ RelDFHalf::RelDFHalf(shared_ptr<const RelDF> df, vector<shared_ptr<const SpinorI
   for (auto& i : basis_)
     if (i->basis(0) != index) throw logic_error("basis should have the same first index");
 
-  // -1 due to dagger (We are transforming the bra.)
-  auto icoeff_scaled = make_shared<const Matrix>(*icoeff[index] * (-1.0));
+  // null coefficients denote zero blocks (purely real or purely imaginary coefficients)
+  assert(rcoeff[index] || icoeff[index]);
 
   // Real RelDF (standard)
   if (!df->get_imag()) {
-    if (df->swapped()) {
-      dfhalf_[0] = df->get_real()->compute_half_transform_swap(rcoeff[index]);
-      dfhalf_[1] = df->get_real()->compute_half_transform_swap(icoeff_scaled);
-    } else {
-      dfhalf_[0] = df->get_real()->compute_half_transform(rcoeff[index]);
-      dfhalf_[1] = df->get_real()->compute_half_transform(icoeff_scaled);
+    if (rcoeff[index])
+      dfhalf_[0] = df->swapped() ? df->get_real()->compute_half_transform_swap(rcoeff[index]) : df->get_real()->compute_half_transform(rcoeff[index]);
+    if (icoeff[index]) {
+      // -1 due to dagger (We are transforming the bra.)
+      auto icoeff_scaled = make_shared<const Matrix>(*icoeff[index] * (-1.0));
+      dfhalf_[1] = df->swapped() ? df->get_real()->compute_half_transform_swap(icoeff_scaled) : df->get_real()->compute_half_transform(icoeff_scaled);
     }
+    if (!dfhalf_[0])
+      dfhalf_[0] = dfhalf_[1]->clone();
+    if (!dfhalf_[1])
+      dfhalf_[1] = dfhalf_[0]->clone();
 
   // Complex RelDF (GIAO)
   } else {
+    const int nbasis = rcoeff[index] ? rcoeff[index]->ndim() : icoeff[index]->ndim();
+    const int nocc   = rcoeff[index] ? rcoeff[index]->mdim() : icoeff[index]->mdim();
+    if (!rcoeff[index])
+      rcoeff[index] = make_shared<const Matrix>(nbasis, nocc);
+    // -1 due to dagger (We are transforming the bra.)
+    auto icoeff_scaled = icoeff[index] ? make_shared<const Matrix>(*icoeff[index] * (-1.0)) : make_shared<const Matrix>(nbasis, nocc);
 
     // For 3-multiplication
     auto ricoeff = make_shared<const Matrix>(*rcoeff[index] + *icoeff_scaled);
@@ -113,6 +123,16 @@ shared_ptr<RelDFHalf> RelDFHalf::merge_b1(shared_ptr<RelDFHalf> o) const {
 }
 
 
+// The partner of an orbital has the coefficients sign * c^* of the other spin component. Only valid for real 3-index integrals.
+shared_ptr<RelDFHalf> RelDFHalf::time_reversal(vector<shared_ptr<const SpinorInfo>> bas, const double sign) const {
+  // dfhalf_[1] holds the transform with -Im(c) (see the constructor)
+  array<shared_ptr<DFHalfDist>,2> data = {{dfhalf_[0]->copy(), dfhalf_[1]->copy()}};
+  data[0]->scale(sign);
+  data[1]->scale(-sign);
+  return make_shared<RelDFHalf>(data, cartesian_, bas);
+}
+
+
 shared_ptr<RelDFHalf> RelDFHalf::slice_b1(const int slice_start, const int slice_size) const {
   return make_shared<RelDFHalf>(array<shared_ptr<DFHalfDist>,2>{{get_real()->slice_b1(slice_start, slice_size),
                                                                  get_imag()->slice_b1(slice_start, slice_size)}}, cartesian_, basis_);
@@ -66,6 +66,9 @@ class RelDFHalf : public RelDFBase {
     std::shared_ptr<RelDFHalf> apply_JJ() const;
 
     std::shared_ptr<RelDFHalf> merge_b1(std::shared_ptr<RelDFHalf> o) const;
+    // half transform with the time-reversed orbitals (Kramers partners), given the half transform of the other spin component
+    // sign is -1 for the alpha (L+, S+) and +1 for the beta (L-, S-) components of bas
+    std::shared_ptr<RelDFHalf> time_reversal(std::vector<std::shared_ptr<const SpinorInfo>> bas, const double sign) const;
     std::shared_ptr<RelDFHalf> slice_b1(const int slice_start, const int slice_size) const;
 
     void ax_plus_y(std::complex<double> a, std::shared_ptr<const RelDFHalf> o);
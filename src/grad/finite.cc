@@ -24,6 +24,7 @@
 
 #include <src/grad/gradeval.h>
 #include <src/grad/finite.h>
+#include <src/grad/finitediff.h>
 #include <src/util/timer.h>
 #include <src/wfn/get_energy.h>
 
@@ -40,67 +41,21 @@ shared_ptr<GradFile> FiniteGrad::compute() {
   cout << "  Gradient evaluation with respect to " << natom * 3 << " DOFs" << endl;
   cout << "  Finite difference size (dx) is " << setprecision(8) << dx_ << " Bohr" << endl;
 
-  Timer timer;
   muffle_ = make_shared<Muffle>("finite.log");
 
-  auto grad = make_shared<GradFile>(natom);
-
-  const int ncomm = mpi__->world_size() / nproc_;
-  const int npass = (natom * 3 - 1) / ncomm + 1;
-
-  for (int ipass = 0; ipass != npass; ++ipass) {
-    const int ncolor = min(ncomm, natom*3-ncomm*ipass);
-    const int icomm = mpi__->rank() % ncolor;
-    mpi__->split(ncolor);
-
-    const int counter = icomm + ncomm * ipass;
-    const int i = counter / 3;
-    const int j = counter % 3;
-
-    muffle_->mute();
-
-    double energy_plus = 0.0;
-    {
-      auto displ = make_shared<XYZFile>(natom);
-      displ->element(j,i) = dx_;
-      auto geom_plus = make_shared<Geometry>(*geom_, displ, make_shared<PTree>(), false, false);
-      geom_plus->print_atoms();
-
-      shared_ptr<const Reference> ref_plus;
-      if (ref_)
-        ref_plus = ref_->project_coeff(geom_plus);
-
+  FiniteDiff fd(geom_, ref_, nullptr, dx_, nproc_, npoint_);
+  shared_ptr<const Matrix> deriv = fd.compute(
+    [this](shared_ptr<const Geometry> geom, shared_ptr<const Reference> ref) {
+      double energy = 0.0;
       for (auto& m : *idata_) {
         const string title = to_lower(m->get<string>("title", ""));
-        tie(energy_plus, ref_plus) = get_energy(title, m, geom_plus, ref_plus, target_state_);
+        tie(energy, ref) = get_energy(title, FiniteDiff::guess_input(m), geom, ref, target_state_);
       }
-    }
-
-    double energy_minus = 0.0;
-    {
-      auto displ = make_shared<XYZFile>(natom);
-      displ->element(j,i) = -dx_;
-      auto geom_minus = make_shared<Geometry>(*geom_, displ, make_shared<PTree>(), false, false);
-      geom_minus->print_atoms();
-
-      shared_ptr<const Reference> ref_minus;
-      if (ref_)
-        ref_minus = ref_->project_coeff(geom_minus);
+      return make_pair(ref, vector<double>{energy});
+    }, 1, muffle_);
 
-      for (auto& m : *idata_) {
-        const string title = to_lower(m->get<string>("title", ""));
-        tie(energy_minus, ref_minus) = get_energy(title, m, geom_minus, ref_minus, target_state_);
-      }
-    }
-
-    if (mpi__->rank() == 0)
-      grad->element(j,i) = (energy_plus - energy_minus) / (2.0 * dx_);
-    muffle_->unmute();
-    stringstream ss; ss << "Finite difference evaluation (" << setw(2) << i*3+j+1 << " / " << geom_->natom() * 3 << ")";
-    timer.tick_print(ss.str());
-    mpi__->merge();
-  }
-  grad->allreduce();
+  auto grad = make_shared<GradFile>(natom);
+  copy_n(deriv->data(), natom*3, grad->data());
 
   grad->print(": Calculated with finite difference", 0);
   return grad;
@@ -118,7 +73,6 @@ shared_ptr<GradFile> FiniteNacm<CASSCF>::compute() {
   const int nclosed = ref_->nclosed();
   const int nocc = ref_->nocc();
 
-  Timer timer;
   muffle_ = make_shared<Muffle>("finite.log");
 
   auto acoeff_ref = make_shared<Matrix>(ref_->coeff()->slice(nclosed, nocc));
@@ -127,83 +81,48 @@ shared_ptr<GradFile> FiniteNacm<CASSCF>::compute() {
   auto gmo = make_shared<Matrix>(norb, norb);
   gmo->zero();
 
-  const int ncomm = mpi__->size() / nproc_;
-  const int npass = (natom * 3 - 1) / ncomm + 1;
-
-  for (int ipass = 0; ipass != npass; ++ipass) {
-    const int ncolor = min(ncomm, natom*3-ncomm*ipass);
-    const int icomm = mpi__->rank() % ncolor;
-    mpi__->split(ncolor);
-
-    const int counter = icomm + ncomm * ipass;
-    const int i = counter / 3;
-    const int j = counter % 3;
-
-    muffle_->mute();
-
-    shared_ptr<Matrix> acoeff_plus;
-    shared_ptr<Dvec> civ_plus;
-    {
-      auto displ = make_shared<XYZFile>(natom);
-      displ->element(j,i) = dx_;
-      auto geom_plus = make_shared<Geometry>(*geom_, displ, make_shared<PTree>(), false, false);
-      geom_plus->print_atoms();
-
-      shared_ptr<const Reference> ref_plus;
-      if (ref_)
-        ref_plus = ref_->project_coeff(geom_plus);
-
-      double energy_plus;
-      tie(energy_plus, ref_plus) = get_energy("casscf", idata_, geom_plus, ref_plus);
-      acoeff_plus = make_shared<Matrix>(ref_plus->coeff()->slice(nclosed, nocc));
+  // quantities to be differentiated: CI coefficients of target_state2_ and active orbitals, both phase-matched to the reference
+  const int lena = civ_ref->det()->lena();
+  const int lenb = civ_ref->det()->lenb();
+  const size_t cisize = lena*lenb;
+  const size_t nvalue = cisize + acoeff_ref->size();
+
+  FiniteDiff fd(geom_, ref_, nullptr, dx_, nproc_, npoint_);
+  shared_ptr<const PTree> idata_guess = FiniteDiff::guess_input(idata_);
+  shared_ptr<const Matrix> deriv = fd.compute(
+    [&](shared_ptr<const Geometry> geom, shared_ptr<const Reference> ref) {
+      double energy;
+      tie(energy, ref) = get_energy("casscf", idata_guess, geom, ref);
+      auto acoeff = make_shared<Matrix>(ref->coeff()->slice(nclosed, nocc));
       for (int im = 0; im != acoeff_ref->mdim(); ++im) {
-        double dmatch = blas::dot_product(acoeff_ref->element_ptr(0, im), acoeff_ref->ndim(), acoeff_plus->element_ptr(0,im));
+        double dmatch = blas::dot_product(acoeff_ref->element_ptr(0, im), acoeff_ref->ndim(), acoeff->element_ptr(0,im));
         if (dmatch < 0.0)
-          blas::scale_n(-1.0, acoeff_plus->element_ptr(0, im), acoeff_ref->ndim());
+          blas::scale_n(-1.0, acoeff->element_ptr(0, im), acoeff_ref->ndim());
       }
-      civ_plus = ref_plus->civectors()->copy();
-      civ_plus->match(civ_ref);
-    }
+      shared_ptr<Dvec> civ = ref->civectors()->copy();
+      civ->match(civ_ref);
 
-    shared_ptr<Matrix> acoeff_minus;
-    shared_ptr<Dvec> civ_minus;
-    {
-      auto displ = make_shared<XYZFile>(natom);
-      displ->element(j,i) = -dx_;
-      auto geom_minus = make_shared<Geometry>(*geom_, displ, make_shared<PTree>(), false, false);
-      geom_minus->print_atoms();
-
-      shared_ptr<const Reference> ref_minus;
-      if (ref_)
-        ref_minus = ref_->project_coeff(geom_minus);
-
-      double energy_minus;
-      tie(energy_minus, ref_minus) = get_energy("casscf", idata_, geom_minus, ref_minus);
-      acoeff_minus = make_shared<Matrix>(ref_minus->coeff()->slice(nclosed, nocc));
-      for (int im = 0; im != acoeff_ref->mdim(); ++im) {
-        double dmatch = blas::dot_product(acoeff_ref->element_ptr(0, im), acoeff_ref->ndim(), acoeff_minus->element_ptr(0,im));
-        if (dmatch < 0.0)
-          blas::scale_n(-1.0, acoeff_minus->element_ptr(0, im), acoeff_ref->ndim());
-      }
-      civ_minus = ref_minus->civectors()->copy();
-      civ_minus->match(civ_ref);
-    }
+      vector<double> values(nvalue);
+      copy_n(civ->data(target_state2_)->data(), cisize, values.begin());
+      copy_n(acoeff->data(), acoeff->size(), values.begin()+cisize);
+      return make_pair(ref, values);
+    }, nvalue, muffle_, "Finite difference evaluation");
+
+  auto Smn = make_shared<Overlap>(geom_);
+  for (int counter = 0; counter != natom*3; ++counter) {
+    const int i = counter / 3;
+    const int j = counter % 3;
 
-    auto civ_diff = civ_plus->copy();
-    *civ_diff -= *civ_minus;
-    civ_diff->scale(1.0 / (2.0 * dx_));
-    auto acoeff_diff = make_shared<Matrix>(*acoeff_plus - *acoeff_minus);
-    acoeff_diff->scale(1.0 / (2.0 * dx_));
+    const double* civ_diff = deriv->element_ptr(0, counter);
+    auto acoeff_diff = make_shared<Matrix>(acoeff_ref->ndim(), acoeff_ref->mdim());
+    copy_n(deriv->element_ptr(cisize, counter), acoeff_diff->size(), acoeff_diff->data());
 
-    auto Smn = make_shared<Overlap>(geom_);
     auto Uij = make_shared<Matrix>(*acoeff_ref % *Smn * *acoeff_diff);
     if (mpi__->rank() == 0) {
-      grad->element(j,i) = civ_ref->data(target_state1_)->dot_product(civ_diff->data(target_state2_));
+      grad->element(j,i) = blas::dot_product(civ_ref->data(target_state1_)->data(), cisize, civ_diff);
 
       for (int ii = 0; ii != norb; ++ii) {
         for (int ij = 0; ij != norb; ++ij) {
-          const int lena = civ_ref->det()->lena();
-          const int lenb = civ_ref->det()->lenb();
           if (ii != ij) {
             for (auto& iter : civ_ref->det()->phia(ii, ij)) {
               size_t iaA = iter.source;
@@ -236,10 +155,6 @@ shared_ptr<GradFile> FiniteNacm<CASSCF>::compute() {
         }
       }
     }
-    mpi__->merge();
-    muffle_->unmute();
-    stringstream ss; ss << "Finite difference evaluation (" << setw(2) << i*3+j+1 << " / " << geom_->natom() * 3 << ")";
-    timer.tick_print(ss.str());
   }
   grad->allreduce();
   gmo->allreduce();
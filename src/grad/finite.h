@@ -43,11 +43,14 @@ class FiniteGrad : public GradEval_base {
     int target_state_;
     double dx_;
     int nproc_;
+    // number of points in the finite-difference stencil (2 or 4)
+    int npoint_;
 
   public:
     // Constructor does nothing here
-    FiniteGrad(std::shared_ptr<const PTree> idata, std::shared_ptr<const Geometry> geom, std::shared_ptr<const Reference> ref, const int target, const double dx, const int nproc)
-      : GradEval_base(geom), idata_(idata), ref_(ref), target_state_(target), dx_(dx), nproc_(nproc) {
+    FiniteGrad(std::shared_ptr<const PTree> idata, std::shared_ptr<const Geometry> geom, std::shared_ptr<const Reference> ref, const int target, const double dx, const int nproc,
+               const int npoint = 2)
+      : GradEval_base(geom), idata_(idata), ref_(ref), target_state_(target), dx_(dx), nproc_(nproc), npoint_(npoint) {
     }
 
     std::shared_ptr<GradFile> compute();
@@ -74,6 +77,7 @@ class FiniteNacm : public GradEval_base {
     int target_state2_;
     double dx_;
     int nproc_;
+    int npoint_;
 
     void init() {
       if (geom_->external())
@@ -91,8 +95,9 @@ class FiniteNacm : public GradEval_base {
     }
 
   public:
-    FiniteNacm(std::shared_ptr<const PTree> idata, std::shared_ptr<const Geometry> geom, std::shared_ptr<const Reference> ref, const int target, const int target2, const double dx, const int nproc)
-      : GradEval_base(geom), idata_(idata), ref_(ref), target_state1_(target), target_state2_(target2), dx_(dx), nproc_(nproc) {
+    FiniteNacm(std::shared_ptr<const PTree> idata, std::shared_ptr<const Geometry> geom, std::shared_ptr<const Reference> ref, const int target, const int target2, const double dx, const int nproc,
+               const int npoint = 2)
+      : GradEval_base(geom), idata_(idata), ref_(ref), target_state1_(target), target_state2_(target2), dx_(dx), nproc_(nproc), npoint_(npoint) {
       init();
     }
 
@@ -0,0 +1,104 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: finitediff.cc
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <src/grad/finitediff.h>
+#include <src/util/timer.h>
+
+using namespace std;
+using namespace bagel;
+
+FiniteDiff::FiniteDiff(shared_ptr<const Geometry> geom, shared_ptr<const Reference> ref, shared_ptr<const PTree> geominfo,
+                       const double dx, const int nproc, const int npoint)
+ : geom_(geom), ref_(ref), geominfo_(geominfo ? geominfo : make_shared<const PTree>()), dx_(dx), nproc_(nproc), npoint_(npoint) {
+  if (npoint_ != 2 && npoint_ != 4)
+    throw runtime_error("Finite-difference stencil should have 2 or 4 points");
+  if (nproc_ < 1)
+    throw runtime_error("nproc should be a positive number");
+}
+
+
+shared_ptr<const Reference> FiniteDiff::guess(shared_ptr<const Reference> ref, shared_ptr<const Geometry> geom) const {
+  if (!ref) return nullptr;
+  shared_ptr<const Reference> out = ref->project_coeff(geom);
+  // CI vectors are carried over as a guess
+  if (ref->ciwfn())
+    out = make_shared<const Reference>(geom, out->coeff(), out->nclosed(), out->nact(), out->nvirt(), out->energy(),
+                                       nullptr, nullptr, nullptr, nullptr, ref->ciwfn());
+  return out;
+}
+
+
+shared_ptr<const PTree> FiniteDiff::guess_input(shared_ptr<const PTree> input) {
+  auto out = make_shared<PTree>(*input);
+  out->put("_ci_guess", true);
+  return out;
+}
+
+
+shared_ptr<Matrix> FiniteDiff::compute(EvalFunc func, const int nvalue, shared_ptr<Muffle> muffle, const string label) const {
+  const int natom = geom_->natom();
+  const int ndof = natom * 3;
+  const int nbranch = ndof * 2;
+
+  // steps (in units of dx) and weights for the first derivative along one branch
+  const vector<pair<int,double>> stencil = npoint_ == 2 ? vector<pair<int,double>>{{1, 1.0/2.0}}
+                                                        : vector<pair<int,double>>{{1, 8.0/12.0}, {2, -1.0/12.0}};
+
+  auto out = make_shared<Matrix>(nvalue, ndof, true);
+
+  Timer timer;
+  const int ncolor = min(max(mpi__->size() / nproc_, 1), nbranch);
+  const int icomm = mpi__->rank() % ncolor;
+  mpi__->split(ncolor);
+
+  // branches 2*dof and 2*dof+1 are the +dx and -dx directions of the same dof and are handled by different communicators
+  for (int ibranch = icomm; ibranch < nbranch; ibranch += ncolor) {
+    const int counter = ibranch / 2;
+    const double sign = ibranch % 2 == 0 ? 1.0 : -1.0;
+    const int i = counter / 3;
+    const int j = counter % 3;
+
+    shared_ptr<const Reference> ref = ref_;
+    for (auto& step : stencil) {
+      muffle->mute();
+      auto displ = make_shared<XYZFile>(natom);
+      displ->element(j,i) = sign * step.first * dx_;
+      auto geom = make_shared<Geometry>(*geom_, displ, geominfo_, false, false);
+      geom->print_atoms();
+
+      vector<double> values;
+      tie(ref, values) = func(geom, guess(ref, geom));
+      assert(values.size() == nvalue);
+      if (mpi__->rank() == 0)
+        blas::ax_plus_y_n(sign * step.second / dx_, values.data(), nvalue, out->element_ptr(0, counter));
+      muffle->unmute();
+    }
+    stringstream ss; ss << label << " (" << setw(2) << counter+1 << (sign > 0.0 ? "+" : "-") << " / " << ndof << ")";
+    timer.tick_print(ss.str());
+  }
+  mpi__->merge();
+
+  out->allreduce();
+  return out;
+}
@@ -0,0 +1,74 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: finitediff.h
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#ifndef __SRC_GRAD_FINITEDIFF_H
+#define __SRC_GRAD_FINITEDIFF_H
+
+#include <functional>
+#include <src/wfn/reference.h>
+#include <src/util/muffle.h>
+
+namespace bagel {
+
+// Driver for finite-difference derivatives with respect to nuclear coordinates (used by FiniteGrad, FiniteNacm and Hess).
+// Each +dx and -dx branch of each Cartesian displacement is a job; jobs are distributed over the MPI sub-communicators of
+// nproc processes. Within a branch, every displaced calculation starts from the orbitals and CI vectors of its converged
+// neighbour (the reference geometry for the first step); CI vectors are used only by methods whose input is made
+// by guess_input. The 2-point (central) and 4-point stencils are supported.
+class FiniteDiff {
+  public:
+    // computes the quantities to be differentiated at a displaced geometry, given an initial guess.
+    // Returns the converged reference (used as a guess for the next step) and the quantities.
+    using EvalFunc = std::function<std::pair<std::shared_ptr<const Reference>,std::vector<double>>(std::shared_ptr<const Geometry>, std::shared_ptr<const Reference>)>;
+
+  protected:
+    std::shared_ptr<const Geometry> geom_;
+    std::shared_ptr<const Reference> ref_;
+    // input used to construct the displaced geometries
+    std::shared_ptr<const PTree> geominfo_;
+
+    double dx_;
+    int nproc_;
+    int npoint_;
+
+    // returns the guess for a displaced geometry from a converged reference
+    std::shared_ptr<const Reference> guess(std::shared_ptr<const Reference> ref, std::shared_ptr<const Geometry> geom) const;
+
+  public:
+    FiniteDiff(std::shared_ptr<const Geometry> geom, std::shared_ptr<const Reference> ref, std::shared_ptr<const PTree> geominfo,
+               const double dx, const int nproc, const int npoint = 2);
+
+    // returns the derivatives of the quantities (nvalue x 3*natom), which are identical on all the processes
+    std::shared_ptr<Matrix> compute(EvalFunc func, const int nvalue, std::shared_ptr<Muffle> muffle, const std::string label = "Finite difference evaluation") const;
+
+    int npoint() const { return npoint_; }
+
+    // returns a copy of the input of a method in which the CI vectors of the neighbour are requested as a guess
+    static std::shared_ptr<const PTree> guess_input(std::shared_ptr<const PTree> input);
+};
+
+}
+
+#endif
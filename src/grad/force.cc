@@ -203,10 +203,11 @@ shared_ptr<GradFile> Force::compute() {
 
     const double dx = idata_->get<double>("dx", 1.0e-3);
     const int nproc = idata_->get<int>("nproc", 1);
+    const int npoint = idata_->get<int>("stencil", 2);
 
     if (jobtitle == "force") {
 
-      auto force = make_shared<FiniteGrad>(input, geom_, ref_, target, dx, nproc);
+      auto force = make_shared<FiniteGrad>(input, geom_, ref_, target, dx, nproc, npoint);
       out = force->compute();
       ref = force->ref();
 
@@ -214,13 +215,13 @@ shared_ptr<GradFile> Force::compute() {
 
       if (method == "casscf") {
 
-        auto force = make_shared<FiniteNacm<CASSCF>>(cinput, geom_, ref_, target, target2, dx, nproc);
+        auto force = make_shared<FiniteNacm<CASSCF>>(cinput, geom_, ref_, target, target2, dx, nproc, npoint);
         out = force->compute();
         ref = force->ref();
 
       } else if (method == "caspt2") {
 
-        auto force = make_shared<FiniteNacm<CASPT2Energy>>(cinput, geom_, ref_, target, target2, dx, nproc);
+        auto force = make_shared<FiniteNacm<CASPT2Energy>>(cinput, geom_, ref_, target, target2, dx, nproc, npoint);
         out = force->compute();
         ref = force->ref();
 
@@ -67,13 +67,10 @@ shared_ptr<GradFile> GradEval_base::contract_gradient(const shared_ptr<const Mat
       task.insert(task.end(), task0.begin(), task0.end());
     }
 
-    TaskQueue<shared_ptr<GradTask>> tq(move(task));
-    tq.compute();
+    compute_tasks(move(task));
   } else {
     vector<shared_ptr<GradTask>> task = contract_grad1e<GradTask1s>(v, v);
-
-    TaskQueue<shared_ptr<GradTask>> tq(move(task));
-    tq.compute();
+    compute_tasks(move(task));
   }
 
   if (!v)
@@ -85,6 +82,45 @@ shared_ptr<GradFile> GradEval_base::contract_gradient(const shared_ptr<const Mat
 }
 
 
+vector<shared_ptr<GradTask>> GradEval_base::distribute(vector<shared_ptr<GradTask>>&& task) const {
+  const int nproc = mpi__->size();
+  if (nproc == 1)
+    return move(task);
+
+  // longest-processing-time-first assignment; every process computes the same assignment
+  vector<pair<double,size_t>> cost(task.size());
+  for (size_t i = 0; i != task.size(); ++i)
+    cost[i] = make_pair(-task[i]->cost(), i);
+  sort(cost.begin(), cost.end());
+
+  vector<double> load(nproc, 0.0);
+  vector<shared_ptr<GradTask>> out;
+  out.reserve(task.size()/nproc+1);
+  for (auto& i : cost) {
+    const int rank = min_element(load.begin(), load.end()) - load.begin();
+    load[rank] -= i.first;
+    if (rank == mpi__->rank())
+      out.push_back(task[i.second]);
+  }
+  return out;
+}
+
+
+void GradEval_base::compute_tasks(vector<shared_ptr<GradTask>>&& task) {
+  const int nthreads = resources__->max_num_threads();
+  grad_thread_.resize(nthreads);
+  for (auto& i : grad_thread_)
+    i = make_shared<GradFile>(geom_->natom());
+
+  TaskQueue<shared_ptr<GradTask>> tq(move(task));
+  tq.compute(nthreads);
+
+  for (auto& i : grad_thread_)
+    *grad_ += *i;
+  grad_thread_.clear();
+}
+
+
 template<typename TaskType>
 vector<shared_ptr<GradTask>> GradEval_base::contract_grad1e(const shared_ptr<const Matrix> d, const shared_ptr<const Matrix> w) {
   return contract_grad1e<TaskType>(d, d, w);
@@ -99,7 +135,6 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad1e(const shared_ptr<con
   out.reserve(nshell*nshell);
 
   // TODO perhaps we could reduce operation by a factor of 2
-  int cnt = 0;
   int iatom0 = 0;
   auto oa0 = geom_->offsets().begin();
   for (auto a0 = geom_->atoms().begin(); a0 != geom_->atoms().end(); ++a0, ++oa0, ++iatom0) {
@@ -112,9 +147,6 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad1e(const shared_ptr<con
         auto o1 = oa1->begin();
         for (auto b1 = (*a1)->shells().begin(); b1 != (*a1)->shells().end(); ++b1, ++o1) {
 
-          // static distribution since this is cheap
-          if (cnt++ % mpi__->size() != mpi__->rank()) continue;
-
           array<shared_ptr<const Shell>,2> input = {{*b1, *b0}};
           vector<int> atom = {iatom0, iatom1};
           vector<int> offset_ = {*o0, *o1};
@@ -125,6 +157,8 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad1e(const shared_ptr<con
     }
   }
 
+  out = distribute(move(out));
+
   // if finite nucleus are used, we need to insert additional tasks that are omitted from the 1e part
   if (geom_->has_finite_nucleus()) {
     vector<shared_ptr<GradTask>> task0 = contract_grad1e_fnai(nmat);
@@ -144,7 +178,6 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_graddkh1e(array<shared_ptr<
   out.reserve(nshell*nshell);
 
   // TODO perhaps we could reduce operation by a factor of 2
-  int cnt = 0;
   int iatom0 = 0;
   auto oa0 = geom->offsets().begin();
   for (auto a0 = geom->atoms().begin(); a0 != geom->atoms().end(); ++a0, ++oa0, ++iatom0) {
@@ -157,9 +190,6 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_graddkh1e(array<shared_ptr<
         auto o1 = oa1->begin();
         for (auto b1 = (*a1)->shells().begin(); b1 != (*a1)->shells().end(); ++b1, ++o1) {
 
-          // static distribution since this is cheap
-          if (cnt++ % mpi__->size() != mpi__->rank()) continue;
-
           array<shared_ptr<const Shell>,2> input = {{*b1, *b0}};
           vector<int> atom = {iatom0, iatom1};
           vector<int> offset_ = {*o0, *o1};
@@ -170,7 +200,7 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_graddkh1e(array<shared_ptr<
     }
   }
 
-  return out;
+  return distribute(move(out));
 }
 
 
@@ -182,7 +212,6 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_gradsmall1e(array<shared_pt
   out.reserve(nshell*nshell);
 
   // TODO perhaps we could reduce operation by a factor of 2
-  int cnt = 0;
   int iatom0 = 0;
   auto oa0 = geom_->offsets().begin();
   for (auto a0 = geom_->atoms().begin(); a0 != geom_->atoms().end(); ++a0, ++oa0, ++iatom0) {
@@ -195,9 +224,6 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_gradsmall1e(array<shared_pt
         auto o1 = oa1->begin();
         for (auto b1 = (*a1)->shells().begin(); b1 != (*a1)->shells().end(); ++b1, ++o1) {
 
-          // static distribution since this is cheap
-          if (cnt++ % mpi__->size() != mpi__->rank()) continue;
-
           array<shared_ptr<const Shell>,2> input = {{*b1, *b0}};
           vector<int> atom = {iatom0, iatom1};
           vector<int> offset_ = {*o0, *o1};
@@ -207,7 +233,7 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_gradsmall1e(array<shared_pt
       }
     }
   }
-  return out;
+  return distribute(move(out));
 }
 
 
@@ -268,7 +294,6 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad1e_fnai(const array<sha
 
   // loop over atoms
   int iatomf = -1;
-  int cnt = 0;
   for (auto& af : cgeom->atoms()) {
     ++iatomf;
     if (!af->finite_nucleus()) continue;
@@ -290,9 +315,6 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad1e_fnai(const array<sha
           auto o1 = oa1->begin();
           for (auto b1 = (*a1)->shells().begin(); b1 != (*a1)->shells().end(); ++b1, ++o1) {
 
-            // static distribution since this is cheap
-            if (cnt++ % mpi__->size() != mpi__->rank()) continue;
-
             array<shared_ptr<const Shell>,4> input = {{b3, b2, *b1, *b0}};
             vector<int> atoms = {iatom0, iatom1, iatomf};
             vector<int> offs = {*o0, *o1, 0};
@@ -304,7 +326,7 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad1e_fnai(const array<sha
       }
     }
   }
-  return out;
+  return distribute(move(out));
 }
 
 
@@ -365,7 +387,6 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad2e_2index(const shared_
   out.reserve(nshell2*(nshell2+1)/2);
 
   // using symmetry (b0 <-> b1)
-  int cnt = 0;
   int iatom0 = 0;
   auto oa0 = cgeom->aux_offsets().begin();
   for (auto a0 = cgeom->aux_atoms().begin(); a0 != cgeom->aux_atoms().end(); ++a0, ++oa0, ++iatom0) {
@@ -382,9 +403,6 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad2e_2index(const shared_
         auto o1 = a0!=a1 ? oa1->begin() : o0;
         for (auto b1 = (a0!=a1 ? (*a1)->shells().begin() : b0); b1 != (*a1)->shells().end(); ++b1, ++o1) {
 
-          // static distribution since this is cheap
-          if (cnt++ % mpi__->size() != mpi__->rank()) continue;
-
           array<shared_ptr<const Shell>,4> input = {{*b1, b3, *b0, b3}};
           vector<int> atoms = {iatom0, iatom1};
           vector<int> offs = {*o0, *o1};
@@ -394,7 +412,7 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad2e_2index(const shared_
       }
     }
   }
-  return out;
+  return distribute(move(out));
 }
 
 
@@ -404,7 +422,6 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad1e_fnai(const shared_pt
   const size_t nfatom = std::accumulate(geom_->atoms().begin(), geom_->atoms().end(), 0, [](const int& i, const shared_ptr<const Atom>& o) { return i+(o->finite_nucleus() ? 1 : 0); });
   out.reserve(nshell*nshell*nfatom);
 
-  int cnt = 0;
 
   // loop over finite nucleus
   int iatomf = -1;
@@ -432,9 +449,6 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad1e_fnai(const shared_pt
           auto o1 = oa1->begin();
           for (auto b1 = (*a1)->shells().begin(); b1 != (*a1)->shells().end(); ++b1, ++o1) {
 
-            // static distribution since this is cheap
-            if (cnt++ % mpi__->size() != mpi__->rank()) continue;
-
             array<shared_ptr<const Shell>,4> input = {{dummy, nshell, *b1, *b0}};
             vector<int> atom = {iatom0, iatom1, iatomf};
             vector<int> offset_ = {*o0, *o1, 0};
@@ -445,7 +459,7 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad1e_fnai(const shared_pt
       }
     }
   }
-  return out;
+  return distribute(move(out));
 }
 
 // explicit instantiation of the template functions
@@ -25,7 +25,6 @@
 #ifndef __SRC_GRAD_GRADEVAL_BASE_H
 #define __SRC_GRAD_GRADEVAL_BASE_H
 
-#include <mutex>
 #include <src/util/math/xyzfile.h>
 #include <src/wfn/geometry.h>
 
@@ -64,12 +63,21 @@ class GradEval_base {
     /// contract 2-index 2-electron gradient integrals with density matrix "o".
     std::vector<std::shared_ptr<GradTask>> contract_grad2e_2index(const std::shared_ptr<const Matrix> o,        const std::shared_ptr<const Geometry> geom = nullptr);
 
+    /// keeps the tasks assigned to this process; tasks are dealt out in the order of decreasing estimated cost to the least loaded process
+    std::vector<std::shared_ptr<GradTask>> distribute(std::vector<std::shared_ptr<GradTask>>&& task) const;
+    /// runs the tasks with thread-local accumulators and adds the results to grad_
+    void compute_tasks(std::vector<std::shared_ptr<GradTask>>&& task);
+
     // the results will be stored in grad_
     std::shared_ptr<GradFile> grad_;
-    std::vector<std::mutex> mutex_;
+    // per-thread accumulators used while compute_tasks is running
+    std::vector<std::shared_ptr<GradFile>> grad_thread_;
 
   public:
-    GradEval_base(const std::shared_ptr<const Geometry> g) : geom_(g), grad_(std::make_shared<GradFile>(g->natom())), mutex_(g->natom()) { }
+    GradEval_base(const std::shared_ptr<const Geometry> g) : geom_(g), grad_(std::make_shared<GradFile>(g->natom())) { }
+
+    /// 2-electron derivative integrals are skipped if the contracted density block is smaller than this
+    static constexpr double screen_thresh__ = 1.0e-12;
 
     /// compute gradient given density matrices
     std::shared_ptr<GradFile> contract_gradient(const std::shared_ptr<const Matrix> d, const std::shared_ptr<const Matrix> w,
@@ -80,6 +88,7 @@ class GradEval_base {
                                                 const std::shared_ptr<const Matrix> g2o2 = nullptr);
     virtual std::shared_ptr<GradFile> compute() { assert(false); return nullptr; }
 
+    friend class GradTask;
     friend class GradTask1;
     friend class GradTask1s;
     friend class GradTask2;
@@ -38,8 +38,46 @@
 using namespace std;
 using namespace bagel;
 
+namespace {
+  // largest absolute element of a density block, used for screening
+  double max_abs(const double* p, const size_t n) {
+    double out = 0.0;
+    for (size_t i = 0; i != n; ++i)
+      out = max(out, fabs(p[i]));
+    return out;
+  }
+}
+
+
+void GradTask::accumulate(const int iatom, const array<double,3>& g) {
+  GradFile& grad = *ge_->grad_thread_[thread_];
+  for (int icart = 0; icart != 3; ++icart)
+    grad.element(icart, iatom) += g[icart];
+}
+
+
+void GradTask::accumulate(const GradFile& g) {
+  *ge_->grad_thread_[thread_] += g;
+}
+
+
+int GradTask::natom() const {
+  return ge_->geom_->natom();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 
 void GradTask3::compute() {
+  shared_ptr<btas::Tensor3<double>> db1 = den_->get_block(offset_[2], shell_[1]->nbasis(), offset_[1], shell_[2]->nbasis(), offset_[0], shell_[3]->nbasis());
+  shared_ptr<btas::Tensor3<double>> db2 = den_->get_block(offset_[2], shell_[1]->nbasis(), offset_[0], shell_[3]->nbasis(), offset_[1], shell_[2]->nbasis());
+  sort_indices<0,2,1,1,1,1,1>(db2->data(), db1->data(), shell_[1]->nbasis(), shell_[3]->nbasis(), shell_[2]->nbasis());
+
+  // screening by the magnitude of the contracted 3-index density
+  if (max_abs(db1->data(), db1->storage().size()) < GradEval_base::screen_thresh__)
+    return;
+
 #ifdef LIBINT_INTERFACE
   GLibint gradbatch(shell_);
 #else
@@ -55,20 +93,15 @@ void GradTask3::compute() {
   if (gradbatch.swap01()) swap(jatom[0], jatom[1]);
   if (gradbatch.swap23()) swap(jatom[2], jatom[3]);
 
-  shared_ptr<btas::Tensor3<double>> db1 = den_->get_block(offset_[2], shell_[1]->nbasis(), offset_[1], shell_[2]->nbasis(), offset_[0], shell_[3]->nbasis());
-  shared_ptr<btas::Tensor3<double>> db2 = den_->get_block(offset_[2], shell_[1]->nbasis(), offset_[0], shell_[3]->nbasis(), offset_[1], shell_[2]->nbasis());
-  sort_indices<0,2,1,1,1,1,1>(db2->data(), db1->data(), shell_[1]->nbasis(), shell_[3]->nbasis(), shell_[2]->nbasis());
-
+  const double fac = 0.5 * (shell_[2] == shell_[3] ? 1.0 : 2.0);
   for (int iatom = 0; iatom != 4; ++iatom) {
     if (jatom[iatom] < 0) continue;
     array<double,3> sum = {{0.0, 0.0, 0.0}};
     for (int icart = 0; icart != 3; ++icart) {
       const double* ppt = gradbatch.data(icart+iatom*3);
-      sum[icart] += blas::dot_product(ppt, sblock, db1->data());
+      sum[icart] += fac * blas::dot_product(ppt, sblock, db1->data());
     }
-    lock_guard<mutex> lock(ge_->mutex_[jatom[iatom]]);
-    for (int icart = 0; icart != 3; ++icart)
-      ge_->grad_->element(icart, jatom[iatom]) += 0.5 * sum[icart] * (shell_[2] == shell_[3] ? 1.0 : 2.0);
+    accumulate(jatom[iatom], sum);
   }
 }
 
@@ -101,9 +134,7 @@ void GradTask1f::compute() {
       const double* ppt = gradbatch.data(icart+iatom*3);
       sum[icart] += blas::dot_product(ppt, sblock, db1->data());
     }
-    lock_guard<mutex> lock(ge_->mutex_[jatom[iatom]]);
-    for (int icart = 0; icart != 3; ++icart)
-      ge_->grad_->element(icart, jatom[iatom]) += sum[icart];
+    accumulate(jatom[iatom], sum);
   }
 }
 
@@ -111,6 +142,14 @@ void GradTask1f::compute() {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void GradTask2::compute() {
+  // screening by the magnitude of the 2-index density
+  double dmax = 0.0;
+  for (int j0 = offset_[0]; j0 != offset_[0] + shell_[2]->nbasis(); ++j0)
+    for (int j1 = offset_[1]; j1 != offset_[1] + shell_[0]->nbasis(); ++j1)
+      dmax = max(dmax, fabs(den2_->element(j1,j0) + den2_->element(j0,j1)));
+  if (dmax < GradEval_base::screen_thresh__)
+    return;
+
 #ifdef LIBINT_INTERFACE
   GLibint gradbatch(shell_);
 #else
@@ -124,6 +163,8 @@ void GradTask2::compute() {
   if (gradbatch.swap01()) swap(jatom[0], jatom[1]);
   if (gradbatch.swap23()) swap(jatom[2], jatom[3]);
 
+  // first 0.5 from symmetrization. second 0.5 from the Hamiltonian
+  const double fac = - 0.5 * 0.5 * (shell_[0] == shell_[2] ? 1.0 : 2.0);
   for (int iatom = 0; iatom != 4; ++iatom) {
     if (jatom[iatom] < 0) continue;
     array<double,3> sum = {{0.0, 0.0, 0.0}};
@@ -135,11 +176,9 @@ void GradTask2::compute() {
           sum[icart] += *ppt * den2_->element(j0,j1);
         }
       }
+      sum[icart] *= fac;
     }
-    lock_guard<mutex> lock(ge_->mutex_[jatom[iatom]]);
-    // first 0.5 from symmetrization. second 0.5 from the Hamiltonian
-    for (int icart = 0; icart != 3; ++icart)
-      ge_->grad_->element(icart, jatom[iatom]) -= 0.5 * sum[icart] * 0.5 * (shell_[0] == shell_[2] ? 1.0 : 2.0);
+    accumulate(jatom[iatom], sum);
   }
 }
 
@@ -152,12 +191,7 @@ void GradTask1::compute() {
   *grad_local += *compute_os<GKineticBatch>(den3_);
   *grad_local -= *compute_os<GOverlapBatch>(eden_);
 
-  for (int iatom = 0; iatom != ge_->geom_->natom(); ++iatom) {
-    lock_guard<mutex> lock(ge_->mutex_[iatom]);
-    ge_->grad_->element(0, iatom) += grad_local->element(0, iatom);
-    ge_->grad_->element(1, iatom) += grad_local->element(1, iatom);
-    ge_->grad_->element(2, iatom) += grad_local->element(2, iatom);
-  }
+  accumulate(*grad_local);
 }
 
 
@@ -175,35 +209,25 @@ void GradTask1s::compute() {
   auto grad_local = make_shared<GradFile>(ge_->geom_->natom());
   *grad_local += *compute_os<GDerivOverBatch>(eden_);
 
-  for (int iatom = 0; iatom != ge_->geom_->natom(); ++iatom) {
-    lock_guard<mutex> lock(ge_->mutex_[iatom]);
-    ge_->grad_->element(0, iatom) += grad_local->element(0, iatom);
-    ge_->grad_->element(1, iatom) += grad_local->element(1, iatom);
-    ge_->grad_->element(2, iatom) += grad_local->element(2, iatom);
-  }
+  accumulate(*grad_local);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void GradTask3r::compute() {
   shared_ptr<GradFile> grad_local = compute_smalleri();
+  if (!grad_local) return;
   list<int> done;
   for (int i = 0; i != 3; ++i) {
     const int iatom = atomindex_[i];
     if (find(done.begin(), done.end(), iatom) != done.end()) continue; // should not add twice
     done.push_back(iatom);
-
-    lock_guard<mutex> lock(ge_->mutex_[iatom]);
-    ge_->grad_->element(0, iatom) += grad_local->element(0, iatom);
-    ge_->grad_->element(1, iatom) += grad_local->element(1, iatom);
-    ge_->grad_->element(2, iatom) += grad_local->element(2, iatom);
+    accumulate(iatom, {{grad_local->element(0, iatom), grad_local->element(1, iatom), grad_local->element(2, iatom)}});
   }
 }
 
 
 shared_ptr<GradFile> GradTask3r::compute_smalleri() const {
-  GSmallERIBatch batch(shell_, array<int,3>{{atomindex_[0], atomindex_[1], atomindex_[2]}}, ge_->geom_->natom());
-  batch.compute();
   array<shared_ptr<const btas::Tensor3<double>>,6> d = {{
     rden3_[0]->get_block(offset_[2], shell_[1]->nbasis(), offset_[1], shell_[2]->nbasis(), offset_[0], shell_[3]->nbasis()),
     rden3_[1]->get_block(offset_[2], shell_[1]->nbasis(), offset_[1], shell_[2]->nbasis(), offset_[0], shell_[3]->nbasis()),
@@ -211,6 +235,16 @@ shared_ptr<GradFile> GradTask3r::compute_smalleri() const {
     rden3_[3]->get_block(offset_[2], shell_[1]->nbasis(), offset_[1], shell_[2]->nbasis(), offset_[0], shell_[3]->nbasis()),
     rden3_[4]->get_block(offset_[2], shell_[1]->nbasis(), offset_[1], shell_[2]->nbasis(), offset_[0], shell_[3]->nbasis()),
     rden3_[5]->get_block(offset_[2], shell_[1]->nbasis(), offset_[1], shell_[2]->nbasis(), offset_[0], shell_[3]->nbasis()) }};
+
+  // screening by the magnitude of the contracted 3-index densities
+  double dmax = 0.0;
+  for (auto& i : d)
+    dmax = max(dmax, max_abs(i->data(), i->storage().size()));
+  if (dmax < GradEval_base::screen_thresh__)
+    return nullptr;
+
+  GSmallERIBatch batch(shell_, array<int,3>{{atomindex_[0], atomindex_[1], atomindex_[2]}}, ge_->geom_->natom());
+  batch.compute();
   return batch.compute_gradient(d);
 }
 
@@ -224,11 +258,7 @@ void GradTask1rf::compute() {
     const int iatom = atomindex_[i];
     if (find(done.begin(), done.end(), iatom) != done.end()) continue; // should not add twice
     done.push_back(iatom);
-
-    lock_guard<mutex> lock(ge_->mutex_[iatom]);
-    ge_->grad_->element(0, iatom) += grad_local->element(0, iatom);
-    ge_->grad_->element(1, iatom) += grad_local->element(1, iatom);
-    ge_->grad_->element(2, iatom) += grad_local->element(2, iatom);
+    accumulate(iatom, {{grad_local->element(0, iatom), grad_local->element(1, iatom), grad_local->element(2, iatom)}});
   }
 }
 
@@ -254,12 +284,7 @@ shared_ptr<GradFile> GradTask1rf::compute_smalleri() const {
 
 void GradTask1r::compute() {
   shared_ptr<GradFile> grad_local = compute_smallnai();
-  for (int iatom = 0; iatom != ge_->geom_->natom(); ++iatom) {
-    lock_guard<mutex> lock(ge_->mutex_[iatom]);
-    ge_->grad_->element(0, iatom) += grad_local->element(0, iatom);
-    ge_->grad_->element(1, iatom) += grad_local->element(1, iatom);
-    ge_->grad_->element(2, iatom) += grad_local->element(2, iatom);
-  }
+  accumulate(*grad_local);
 }
 
 
@@ -288,12 +313,7 @@ void GradTask1d::compute() {
   *grad_local += *compute_os<GKineticBatch>(den_[0]);
   *grad_local += *compute_os<GOverlapBatch>(den_[3]);
 
-  for (int iatom = 0; iatom != ge_->geom_->natom(); ++iatom) {
-    lock_guard<mutex> lock(ge_->mutex_[iatom]);
-    ge_->grad_->element(0, iatom) += grad_local->element(0, iatom);
-    ge_->grad_->element(1, iatom) += grad_local->element(1, iatom);
-    ge_->grad_->element(2, iatom) += grad_local->element(2, iatom);
-  }
+  accumulate(*grad_local);
 }
 
 
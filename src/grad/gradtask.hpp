@@ -35,6 +35,9 @@ class GradTask {
     std::array<int,4> atomindex_;
     std::array<int,4> offset_;
     GradEval_base* ge_;
+    // index of the worker thread running this task, and the estimated cost
+    int thread_;
+    double cost_;
 
     void common_init(const std::vector<int>& a, const std::vector<int>& o) {
       assert(a.size() == o.size());
@@ -45,9 +48,29 @@ class GradTask {
       }
     }
 
+    // products of the number of primitives and Cartesian components times the number of Rys roots (dummy shells count as one)
+    template<size_t N>
+    static double shell_cost(const std::array<std::shared_ptr<const Shell>,N>& s) {
+      double out = 1.0;
+      int l = 0;
+      for (auto& i : s) {
+        out *= i->num_primitive() * (i->angular_number()+1) * (i->angular_number()+2) / 2;
+        l += i->angular_number();
+      }
+      return out * ((l+1)/2+1);
+    }
+
+    // adds to the gradient accumulator of the current thread (implemented in gradtask.cc)
+    void accumulate(const int iatom, const std::array<double,3>& g);
+    void accumulate(const GradFile& g);
+    // number of atoms; the cost of nuclear attraction integrals scales with it
+    int natom() const;
+
   public:
-    GradTask(const std::vector<int>& a, const std::vector<int>& o, GradEval_base* p) : ge_(p) { common_init(a,o); }
+    GradTask(const std::vector<int>& a, const std::vector<int>& o, GradEval_base* p) : ge_(p), thread_(0), cost_(1.0) { common_init(a,o); }
     virtual void compute() = 0;
+    void compute(const int thread) { thread_ = thread; compute(); }
+    double cost() const { return cost_; }
 };
 
 
@@ -59,7 +82,7 @@ class GradTask3 : public GradTask {
   public:
     GradTask3(const std::array<std::shared_ptr<const Shell>,4>& s, const std::vector<int>& a, const std::vector<int>& o,
               const std::shared_ptr<const DFDist> d, GradEval_base* p)
-      : GradTask(a, o, p), shell_(s), den_(d) { }
+      : GradTask(a, o, p), shell_(s), den_(d) { cost_ = shell_cost(shell_); }
     void compute();
 };
 
@@ -72,7 +95,7 @@ class GradTask2 : public GradTask {
   public:
     GradTask2(const std::array<std::shared_ptr<const Shell>,4>& s, const std::vector<int>& a, const std::vector<int>& o,
               const std::shared_ptr<const Matrix> d, GradEval_base* p)
-      : GradTask(a, o, p), shell_(s), den2_(d) { }
+      : GradTask(a, o, p), shell_(s), den2_(d) { cost_ = shell_cost(shell_); }
     void compute();
 };
 
@@ -93,7 +116,7 @@ class GradTask1 : public GradTask {
   public:
     GradTask1(const std::array<std::shared_ptr<const Shell>,2>& s, const std::vector<int>& a, const std::vector<int>& o,
               const std::shared_ptr<const Matrix> nmat, const std::shared_ptr<const Matrix> kmat, const std::shared_ptr<const Matrix> omat, GradEval_base* p)
-      : GradTask(a, o, p), shell_(s), den2_(nmat), den3_(kmat), eden_(omat) { }
+      : GradTask(a, o, p), shell_(s), den2_(nmat), den3_(kmat), eden_(omat) { cost_ = shell_cost(shell_) * (natom()+2); }
     void compute();
 };
 
@@ -112,7 +135,7 @@ class GradTask1s : public GradTask {
   public:
     GradTask1s(const std::array<std::shared_ptr<const Shell>,2>& s, const std::vector<int>& a, const std::vector<int>& o,
                const std::shared_ptr<const Matrix> vmat, const std::shared_ptr<const Matrix> kmat, const std::shared_ptr<const Matrix> omat, GradEval_base* p)
-      : GradTask(a, o, p), shell_(s), den2_(omat), den3_(kmat), eden_(vmat) { }
+      : GradTask(a, o, p), shell_(s), den2_(omat), den3_(kmat), eden_(vmat) { cost_ = shell_cost(shell_); }
     void compute();
 };
 
@@ -124,7 +147,7 @@ class GradTask1f : public GradTask {
   public:
     GradTask1f(const std::array<std::shared_ptr<const Shell>,4>& s, const std::vector<int>& a, const std::vector<int>& o,
                const std::shared_ptr<const Matrix> d, GradEval_base* p)
-      : GradTask(a, o, p), shell_(s), den_(d) { }
+      : GradTask(a, o, p), shell_(s), den_(d) { cost_ = shell_cost(shell_); }
     void compute();
 };
 
@@ -139,7 +162,7 @@ class GradTask3r : public GradTask {
   public:
     GradTask3r(const std::array<std::shared_ptr<const Shell>,4>& s, const std::vector<int>& a, const std::vector<int>& o,
                const std::array<std::shared_ptr<const DFDist>,6> rmat, GradEval_base* p)
-      : GradTask(a, o, p), shell_(s), rden3_(rmat) { }
+      : GradTask(a, o, p), shell_(s), rden3_(rmat) { cost_ = shell_cost(shell_); }
     void compute();
 };
 
@@ -154,7 +177,7 @@ class GradTask1r : public GradTask {
   public:
     GradTask1r(const std::array<std::shared_ptr<const Shell>,2>& s, const std::vector<int>& a, const std::vector<int>& o,
                const std::array<std::shared_ptr<const Matrix>,6> rmat, GradEval_base* p)
-      : GradTask(a, o, p), shell_(s), rden_(rmat) { }
+      : GradTask(a, o, p), shell_(s), rden_(rmat) { cost_ = shell_cost(shell_) * (natom()+2); }
     void compute();
 };
 
@@ -169,7 +192,7 @@ class GradTask1rf : public GradTask {
   public:
     GradTask1rf(const std::array<std::shared_ptr<const Shell>,4>& s, const std::vector<int>& a, const std::vector<int>& o,
                 const std::array<std::shared_ptr<const Matrix>,6> d, GradEval_base* p)
-      : GradTask(a, o, p), shell_(s), rden_(d) { }
+      : GradTask(a, o, p), shell_(s), rden_(d) { cost_ = shell_cost(shell_); }
     void compute();
 };
 
@@ -189,7 +212,7 @@ class GradTask1d : public GradTask {
   public:
     GradTask1d(const std::array<std::shared_ptr<const Shell>,2>& s, const std::vector<int>& a, const std::vector<int>& o,
               const std::array<std::shared_ptr<const Matrix>, 4> den, GradEval_base* p)
-      : GradTask(a, o, p), shell_(s), den_(den) { }
+      : GradTask(a, o, p), shell_(s), den_(den) { cost_ = shell_cost(shell_) * (natom()+2); }
     void compute();
 };
 
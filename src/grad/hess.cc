@@ -26,6 +26,7 @@
 #include <src/grad/hess.h>
 #include <src/grad/force.h>
 #include <src/grad/finite.h>
+#include <src/grad/finitediff.h>
 #include <src/wfn/get_energy.h>
 #include <src/grad/gradeval.h>
 #include <src/util/atommap.h>
@@ -67,6 +68,7 @@ Hess::Hess(shared_ptr<const PTree> idata, shared_ptr<const Geometry> g, shared_p
   cout << "  Finite difference displacement (dx) is " << setprecision(8) << dx_ << " bohr" << endl;
 
   nproc_ = idata_->get<int>("nproc", 1);
+  npoint_ = idata_->get<int>("stencil", 2);
 
   const int natom = geom_->natom();
   const int ndispl = natom * 3;
@@ -148,77 +150,33 @@ void Hess::compute() {
 
 
 void Hess::compute_finite_diff_() {
-  Timer timer;
   const int natom = geom_->natom();
-  const int ncomm = mpi__->size() / nproc_;
-  const int npass = (natom * 3 - 1) / ncomm + 1;
-
-  for (int ipass = 0; ipass != npass; ++ipass) {
-    const int ncolor = min(ncomm, natom*3-ncomm*ipass);
-    const int icomm = mpi__->rank() % ncolor;
-    mpi__->split(ncolor);
+  const int ndispl = natom * 3;
 
-    const int counter = icomm + ncomm * ipass;
+  // gradients and dipole moments are differentiated
+  FiniteDiff fd(geom_, ref_, nullptr, dx_, nproc_, npoint_);
+  shared_ptr<const Matrix> deriv = fd.compute(
+    [this, ndispl](shared_ptr<const Geometry> geom, shared_ptr<const Reference> ref) {
+      auto force = make_shared<Force>(idata_, geom, ref);
+      shared_ptr<const GradFile> grad = force->compute();
+      vector<double> values(grad->data(), grad->data()+ndispl);
+      vector<double> dipole = force->force_dipole();
+      dipole.resize(3, 0.0);
+      values.insert(values.end(), dipole.begin(), dipole.end());
+      return make_pair(force->conv_to_ref(), values);
+    }, ndispl+3, muffle_, "Hessian evaluation");
+
+  for (int counter = 0; counter != ndispl; ++counter) {
     const int i = counter / 3;
-    const int j = counter % 3;
-
-    muffle_->mute();
-
-    vector<double> dipole_plus;
-    shared_ptr<const GradFile> outplus;
-    //displace +dx
-    {
-      auto displ = make_shared<XYZFile>(natom);
-      displ->element(j,i) = dx_;
-      auto geom_plus = make_shared<Geometry>(*geom_, displ, make_shared<PTree>(), false, false);
-      geom_plus->print_atoms();
-
-      shared_ptr<const Reference> ref_plus;
-      if (ref_)
-        ref_plus = ref_->project_coeff(geom_plus);
-
-      auto plus = make_shared<Force>(idata_, geom_plus, ref_plus);
-      outplus = plus->compute();
-      dipole_plus = plus->force_dipole();
-    }
-
-    // displace -dx
-    vector<double> dipole_minus;
-    shared_ptr<const GradFile> outminus;
-    {
-      auto displ = make_shared<XYZFile>(natom);
-      displ->element(j,i) = -dx_;
-      auto geom_minus = make_shared<Geometry>(*geom_, displ, make_shared<PTree>(), false, false);
-      geom_minus->print_atoms();
-
-      shared_ptr<const Reference> ref_minus;
-      if (ref_)
-        ref_minus = ref_->project_coeff(geom_minus);
-
-      auto minus = make_shared<Force>(idata_, geom_minus, ref_minus);
-      outminus = minus->compute();
-      dipole_minus = minus->force_dipole();
-    }
-
-    if (mpi__->rank() == 0) {
-      for (int k = 0, step = 0; k != natom; ++k) { // atom j
-        for (int l = 0; l != 3; ++l, ++step) { //xyz
-          (*hess_)(counter,step) = (outplus->element(l,k) - outminus->element(l,k)) / (2*dx_);
-          (*mw_hess_)(counter,step) =  (*hess_)(counter,step) / sqrt(geom_->atoms(i)->mass() * geom_->atoms(k)->mass());
-          (*cartesian_)(l,counter) = (dipole_plus[l] - dipole_minus[l]) / (2*dx_);
-        }
+    for (int k = 0, step = 0; k != natom; ++k) { // atom j
+      for (int l = 0; l != 3; ++l, ++step) { //xyz
+        (*hess_)(counter,step) = (*deriv)(step, counter);
+        (*mw_hess_)(counter,step) =  (*hess_)(counter,step) / sqrt(geom_->atoms(i)->mass() * geom_->atoms(k)->mass());
       }
     }
-    muffle_->unmute();
-    stringstream ss; ss << "Hessian evaluation (" << setw(2) << i*3+j+1 << " / " << natom * 3 << ")";
-    timer.tick_print(ss.str());
-
-    mpi__->merge();
+    for (int l = 0; l != 3; ++l)
+      (*cartesian_)(l,counter) = (*deriv)(ndispl+l, counter);
   }
-
-  hess_->allreduce();
-  mw_hess_->allreduce();
-  cartesian_->allreduce();
 }
 
 
@@ -42,6 +42,8 @@ class Hess {
     bool numforce_;
 
     int nproc_;
+    // number of points in the finite-difference stencil (2 or 4)
+    int npoint_;
 
     std::shared_ptr<Matrix> hess_;
     std::shared_ptr<Matrix> mw_hess_;
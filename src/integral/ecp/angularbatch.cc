@@ -24,120 +24,75 @@
 
 
 #include <src/util/math/bessel.h>
-#include <src/util/math/algo.h>
-#include <src/integral/ecp/wigner3j.h>
+#include <src/util/math/comb.h>
 #include <src/integral/ecp/angularbatch.h>
-#include <src/integral/ecp/sphusplist.h>
+#include <src/integral/ecp/angularprojection.h>
 #include <iomanip>
 
 using namespace bagel;
 using namespace std;
 
-const static SphUSPList sphusplist;
-const static DoubleFactorial df;
+const static MSphBesselI msbessel;
 
 AngularBatch::AngularBatch(const shared_ptr<const ECP> _ecp, const array<shared_ptr<const Shell>,2>& _info,
-                           const int contA, const int contC, const array<int, 3> angA, const array<int, 3> angC,
-                           const bool print, const int max_iter, const double thresh_int)
- : RadialInt(1, print, max_iter, thresh_int),
-   basisinfo_(_info), ecp_(_ecp), cont0_(contA), cont1_(contC), ang0_(angA), ang1_(angC) {
+                           shared_ptr<AngularProjectionCache> projection, const bool print, const int max_iter, const double thresh_int)
+ : RadialInt(_info[0]->num_contracted() * _info[1]->num_contracted()
+             * (_info[0]->angular_number()+1) * (_info[0]->angular_number()+2) / 2
+             * (_info[1]->angular_number()+1) * (_info[1]->angular_number()+2) / 2, print, max_iter, thresh_int),
+   basisinfo_(_info), ecp_(_ecp), projection_(projection ? projection : make_shared<AngularProjectionCache>()) {
 
   init();
-  map_angular_number();
 
 }
 
-double AngularBatch::integrate3SHs(array<pair<int, int>, 3> lm) const {
+vector<double> AngularBatch::angular_factors(const int l, const int ang, const array<double, 3>& AB) const {
 
-  const int l1 = lm[0].first;
-  const int l2 = lm[1].first;
-  const int l3 = lm[2].first;
-
-  const static Wigner3j wigner3j;
-  const double w1 = wigner3j.lookup_wigner3j(l1, lm[0].second, l2, lm[1].second, l3, lm[2].second);
-  const double w2 = wigner3j.lookup_wigner3j(l1, 0, l2, 0, l3, 0);
-  const double coeff = sqrt(0.25 * (2*l1 + 1) * (2*l2 + 1) * (2*l3 + 1) / pi__);
-
-  return coeff * w1 * w2;
-
-}
-
-void AngularBatch::map_angular_number() {
-
-  for (int l = 0; l != ANG_HRR_END*2-1; ++l) {
-    map<int, array<int, 3>> mapl;
-    int key = 0;
-    for (int z = 0; z <= l; ++z) {
-      for (int y = 0; y <= l - z; ++y) {
-        const int x = l - y - z;
-        array<int, 3> xyz = {{x, y, z}};
-        mapl.insert(make_pair(key, xyz));
-        ++key;
-      }
+  const static Comb c;
+  const AngularProjection& proj = *projection_->get(l, ang, AB);
+
+  const int nld = l + ang + 1;
+  vector<double> out((ang+1)*(ang+2)/2 * (2*l+1) * nld * (ang+1), 0.0);
+
+  int icart = 0;
+  for (int iz = 0; iz <= ang; ++iz)
+  for (int iy = 0; iy <= ang - iz; ++iy) {
+    const int ix = ang - iz - iy;
+    for (int kx = 0; kx <= ix; ++kx)
+    for (int ky = 0; ky <= iy; ++ky)
+    for (int kz = 0; kz <= iz; ++kz) {
+      const int lk = kx + ky + kz;
+      const double coeff = c(ix, kx) * pow(AB[0], ix - kx) * c(iy, ky) * pow(AB[1], iy - ky) * c(iz, kz) * pow(AB[2], iz - kz)
+                         * pow(-1.0, lk - ang);
+      if (abs(coeff) > 1e-15)
+        for (int m = 0; m <= 2*l; ++m)
+          for (int ld = max(l-lk, 0); ld <= l+lk; ++ld)
+            if ((l + lk - ld) % 2 == 0)
+              out[((icart*(2*l+1) + m)*nld + ld)*(ang+1) + lk] += coeff * proj(m, ld, kx, ky, kz);
     }
-    map_.push_back(mapl);
+    ++icart;
   }
 
-}
+  return out;
 
-vector<double> AngularBatch::project_AB(const int l, const vector<double> usp, const vector<double> r) {
-  const static MSphBesselI msbessel;
-
-  vector<vector<double>> rbessel(r.size());
-
-  const int begin0 = basisinfo_[0]->contraction_ranges(cont0_).first;
-  const int end0   = basisinfo_[0]->contraction_ranges(cont0_).second;
-  for (int ir = 0; ir != r.size(); ++ir) {
-    vector<double> bessel(l0_+l+1);
-    for (int i0 = begin0; i0 != end0; ++i0) {
-      const double coef0 = basisinfo_[0]->contractions()[cont0_][i0];
-      const double exp0  = basisinfo_[0]->exponents(i0);
-      const double fac = coef0 * exp(-exp0 * pow(dAB_-r[ir], 2));
-      for (int i = 0; i <= l0_+l; ++i)
-        bessel[i] += fac * msbessel.compute(i, 2.0 * exp0 * dAB_ * r[ir]);
-    }
-    rbessel[ir] = bessel;
-  }
+}
 
-  vector<double> out(r.size(), 0.0);
-  for (int j = 0; j != usp.size(); ++j) {
-    if (usp[j] != 0.0) {
-      map<int, array<int, 3>>::const_iterator pj = map_[l].find(j);
-      assert (pj != map_[l].end());
-      const array<int, 3> kj = pj->second;
-
-      for (int kx = 0; kx <= ang0_[0]; ++kx)
-      for (int ky = 0; ky <= ang0_[1]; ++ky)
-      for (int kz = 0; kz <= ang0_[2]; ++kz) {
-        const int lk = kx + ky + kz;
-        const int index = kx * ANG_HRR_END * ANG_HRR_END + ky * ANG_HRR_END + kz;
-        const double coeff = c0_[index] * pow(-1.0, lk - l0_);
-        if (abs(coeff) > 1e-15) {
-        for (int ld = max(l-lk, 0); ld <= l+lk; ++ld) {
-            if ((l + lk - ld) % 2 == 0) {
-              double smu = 0.0;
-              for (int mu = 0; mu <= 2 * ld; ++mu) {
-
-                const vector<double> usp1 = sphusplist.sphuspfunc_call(ld, mu-ld);
-                double sAB = 0.0;
-                for (int i = 0; i != usp1.size(); ++i) {
-                  if (usp1[i] != 0.0) {
-                    map<int, array<int, 3>>::const_iterator p = map_[ld].find(i);
-                    assert (p != map_[ld].end());
-                    const array<int, 3> ki = p->second;
-                    const int x = ki[0] + kj[0] + kx;
-                    const int y = ki[1] + kj[1] + ky;
-                    const int z = ki[2] + kj[2] + kz;
-                    const double xyz = (x % 2 == 0 && y % 2 == 0 && z % 2 == 0) ? (4.0 * pi__ * df(x-1) * df(y-1) * df(z-1) / df(x+y+z+1)) : 0.0;
-                    sAB += usp1[i] * usp[j] * xyz;
-                  }
-                }
-                smu += zAB_[ld][mu] * sAB;
-              }
-              for (int ir = 0; ir != r.size(); ++ir) out[ir] += smu * rbessel[ir][ld] * coeff * pow(r[ir], lk);
-            }
-          }
-        }
+vector<double> AngularBatch::radial_factors(const int ish, const int lmax, const vector<double>& r) const {
+
+  const shared_ptr<const Shell> shell = basisinfo_[ish];
+  const double d = ish == 0 ? dAB_ : dCB_;
+  const int nr = r.size();
+
+  // sum over primitives of the contracted function times the scaled modified spherical Bessel functions, (cont, ld, r)
+  vector<double> out(shell->num_contracted() * (lmax+1) * nr, 0.0);
+  for (int ic = 0; ic != shell->num_contracted(); ++ic) {
+    double* const o = out.data() + ic*(lmax+1)*nr;
+    for (int i = shell->contraction_ranges(ic).first; i != shell->contraction_ranges(ic).second; ++i) {
+      const double coef = shell->contractions()[ic][i];
+      const double expo = shell->exponents(i);
+      for (int ir = 0; ir != nr; ++ir) {
+        const double fac = coef * exp(-expo * pow(d-r[ir], 2));
+        for (int ld = 0; ld <= lmax; ++ld)
+          o[ld*nr+ir] += fac * msbessel.compute(ld, 2.0 * expo * d * r[ir]);
       }
     }
   }
@@ -146,67 +101,29 @@ vector<double> AngularBatch::project_AB(const int l, const vector<double> usp, c
 
 }
 
-vector<double> AngularBatch::project_CB(const int l, const vector<double> usp, const vector<double> r) {
-  const static MSphBesselI msbessel;
-
-  vector<vector<double>> rbessel(r.size());
-
-  const int begin1 = basisinfo_[1]->contraction_ranges(cont1_).first;
-  const int end1   = basisinfo_[1]->contraction_ranges(cont1_).second;
-  for (int ir = 0; ir != r.size(); ++ir) {
-    vector<double> bessel(l1_+l+1);
-    for (int i1 = begin1; i1 != end1; ++i1) {
-      const double coef1 = basisinfo_[1]->contractions()[cont1_][i1];
-      const double exp1  = basisinfo_[1]->exponents(i1);
-      const double fac = coef1 * exp(-exp1 * pow(dCB_-r[ir], 2));
-      for (int i = 0; i <= l1_+l; ++i)
-        bessel[i] += fac * msbessel.compute(i, 2.0 * exp1 * dCB_ * r[ir]);
-    }
-    rbessel[ir] = bessel;
-  }
-
-  vector<double> out(r.size(), 0.0);
-  for (int j = 0; j != usp.size(); ++j) {
-    if (usp[j] != 0.0) {
-      map<int, array<int, 3>>::const_iterator pj = map_[l].find(j);
-      assert (pj != map_[l].end());
-      const array<int, 3> kj = pj->second;
-
-      for (int kx = 0; kx <= ang1_[0]; ++kx)
-      for (int ky = 0; ky <= ang1_[1]; ++ky)
-      for (int kz = 0; kz <= ang1_[2]; ++kz) {
-        const int lk = kx + ky + kz;
-        const int index = kx * ANG_HRR_END * ANG_HRR_END + ky * ANG_HRR_END + kz;
-        const double coeff = c1_[index] * pow(-1.0, lk - l1_);
-        if (abs(coeff) > 1e-15) {
-          for (int ld = max(l-lk, 0); ld <= l+lk; ++ld) {
-            if ((l + lk - ld) % 2 == 0) {
-              double smu = 0.0;
-              for (int mu = 0; mu <= 2 * ld; ++mu) {
-
-                const vector<double> usp1 = sphusplist.sphuspfunc_call(ld, mu-ld);
-                double sCB = 0.0;
-                for (int i = 0; i != usp1.size(); ++i) {
-                  if (usp1[i] != 0.0) {
-                    map<int, array<int, 3>>::const_iterator p = map_[ld].find(i);
-                    assert (p != map_[ld].end());
-                    const array<int, 3> ki = p->second;
-                    const int x = ki[0] + kj[0] + kx;
-                    const int y = ki[1] + kj[1] + ky;
-                    const int z = ki[2] + kj[2] + kz;
-                    const double xyz = (x % 2 == 0 && y % 2 == 0 && z % 2 == 0) ? (4.0 * pi__ * df(x-1) * df(y-1) * df(z-1) / df(x+y+z+1)) : 0.0;
-                    sCB += usp1[i] * usp[j] * xyz;
-                  }
-                }
-                smu += zCB_[ld][mu] * sCB;
-              }
-              for (int ir = 0; ir != r.size(); ++ir) out[ir] += smu * rbessel[ir][ld] * coeff * pow(r[ir], lk);
-            }
-          }
+vector<double> AngularBatch::project(const vector<double>& angular, const int l, const int m, const int ang, const int ncont,
+                                     const vector<double>& radial, const vector<double>& rpow) const {
+
+  const int nr = rpow.size() / (max(ang0_, ang1_)+1);
+  const int ncart = (ang+1)*(ang+2)/2;
+  const int nld = l + ang + 1;
+  const int ldstride = ang + lmax_ + 1;
+
+  // projection onto S_lm of every (cont, cartesian) function of the shell, (cont, cartesian, r)
+  vector<double> out(ncont * ncart * nr, 0.0);
+  for (int icart = 0; icart != ncart; ++icart)
+    for (int ld = 0; ld != nld; ++ld)
+      for (int lk = 0; lk <= ang; ++lk) {
+        const double a = angular[((icart*(2*l+1) + m)*nld + ld)*(ang+1) + lk];
+        if (a == 0.0) continue;
+        const double* const p = rpow.data() + lk*nr;
+        for (int ic = 0; ic != ncont; ++ic) {
+          const double* const b = radial.data() + (ic*ldstride + ld)*nr;
+          double* const o = out.data() + (ic*ncart + icart)*nr;
+          for (int ir = 0; ir != nr; ++ir)
+            o[ir] += a * b[ir] * p[ir];
         }
       }
-    }
-  }
 
   return out;
 
@@ -214,33 +131,62 @@ vector<double> AngularBatch::project_CB(const int l, const vector<double> usp, c
 
 vector<double> AngularBatch::compute(const vector<double> r) {
 
-  vector<shared_ptr<const Shell_ECP>> shells_ecp = ecp_->shells_ecp();
-  vector<double> out(r.size(), 0.0);
+  const int nr = r.size();
+  const int asize = ncart0_ * ncart1_;
+  vector<double> out(nc_*nr, 0.0);
+  if (shells_.empty()) return out;
+
+  vector<double> rpow((max(ang0_, ang1_)+1) * nr);
+  for (int k = 0; k <= max(ang0_, ang1_); ++k)
+    for (int ir = 0; ir != nr; ++ir)
+      rpow[k*nr+ir] = pow(r[ir], k);
+
+  const vector<double> radialA = radial_factors(0, ang0_ + lmax_, r);
+  const vector<double> radialC = radial_factors(1, ang1_ + lmax_, r);
+
+  for (size_t ish = 0; ish != shells_.size(); ++ish) {
+    const shared_ptr<const Shell_ECP> shecp = shells_[ish];
+    const int l = shecp->angular_number();
+
+    vector<double> u(nr, 0.0);
+    for (size_t i = 0; i != shecp->ecp_exponents().size(); ++i)
+      if (shecp->ecp_coefficients(i) != 0) {
+        const double coeff = 16.0 * pi__ * pi__ * shecp->ecp_coefficients(i);
+        for (int ir = 0; ir != nr; ++ir)
+          u[ir] += coeff * pow(r[ir], shecp->ecp_r_power(i)) * exp(-shecp->ecp_exponents(i) * r[ir] * r[ir]);
+      }
 
-  for (auto& ishecp : shells_ecp) {
-    const int l = ishecp->angular_number();
-    if (l != ecp_->ecp_maxl()) {
-      for (int m = 0; m <= 2*l; ++m) {
-        const vector<double> usp = sphusplist.sphuspfunc_call(l, m-l);
-        vector<double> pA = project_AB(l, usp, r);
-        vector<double> pC = project_CB(l, usp, r);
-        for (int i = 0; i != ishecp->ecp_exponents().size(); ++i)
-          if (ishecp->ecp_coefficients(i) != 0) {
-            const double coeff = 16.0 * pi__ * pi__ * ishecp->ecp_coefficients(i);
-            for (int ir = 0; ir != r.size(); ++ir)
-              out[ir] += coeff * pow(r[ir], ishecp->ecp_r_power(i)) * exp(-ishecp->ecp_exponents(i) * r[ir] * r[ir]) * pA[ir] * pC[ir];
+    for (int m = 0; m <= 2*l; ++m) {
+      const vector<double> pA = project(angA_[ish], l, m, ang0_, cont0_, radialA, rpow);
+      const vector<double> pC = project(angC_[ish], l, m, ang1_, cont1_, radialC, rpow);
+      for (int contA = 0; contA != cont0_; ++contA)
+      for (int contC = 0; contC != cont1_; ++contC)
+        for (int iA = 0; iA != ncart0_; ++iA) {
+          const double* const a = pA.data() + (contA*ncart0_ + iA)*nr;
+          for (int iC = 0; iC != ncart1_; ++iC) {
+            const double* const c = pC.data() + (contC*ncart1_ + iC)*nr;
+            double* const o = out.data() + ((contA*cont1_ + contC)*asize + iA*ncart1_ + iC)*nr;
+            for (int ir = 0; ir != nr; ++ir)
+              o[ir] += u[ir] * a[ir] * c[ir];
           }
-      }
+        }
     }
   }
 
-
   return out;
 
 }
 
 void AngularBatch::init() {
 
+  ang0_ = basisinfo_[0]->angular_number();
+  ang1_ = basisinfo_[1]->angular_number();
+  cont0_ = basisinfo_[0]->num_contracted();
+  cont1_ = basisinfo_[1]->num_contracted();
+  ncart0_ = (ang0_+1) * (ang0_+2) / 2;
+  ncart1_ = (ang1_+1) * (ang1_+2) / 2;
+  assert(nc_ == cont0_ * cont1_ * ncart0_ * ncart1_);
+
   for (int i = 0; i != 3; ++i) {
     AB_[i] = basisinfo_[0]->position(i) - ecp_->position(i);
     CB_[i] = basisinfo_[1]->position(i) - ecp_->position(i);
@@ -248,48 +194,17 @@ void AngularBatch::init() {
   dAB_ = sqrt(pow(AB_[0], 2) + pow(AB_[1], 2) + pow(AB_[2], 2));
   dCB_ = sqrt(pow(CB_[0], 2) + pow(CB_[1], 2) + pow(CB_[2], 2));
 
-  c0_.resize(ANG_HRR_END*ANG_HRR_END*ANG_HRR_END);
-  c1_.resize(ANG_HRR_END*ANG_HRR_END*ANG_HRR_END);
-
-  const static Comb c;
-
-  for (int kx = 0; kx <= ang0_[0]; ++kx) {
-    const double ckx = c(ang0_[0], kx) * pow(AB_[0], ang0_[0] - kx);
-    for (int ky = 0; ky <= ang0_[1]; ++ky) {
-      const double cky = c(ang0_[1], ky) * pow(AB_[1], ang0_[1] - ky);
-      for (int kz = 0; kz <= ang0_[2]; ++kz) {
-        const double ckz = c(ang0_[2], kz) * pow(AB_[2], ang0_[2] - kz);
-        const int index = kx * ANG_HRR_END * ANG_HRR_END + ky * ANG_HRR_END + kz;
-        c0_[index] = ckx * cky * ckz;
-      }
-    }
-  }
-
-  for (int kx = 0; kx <= ang1_[0]; ++kx) {
-    const double ckx = c(ang1_[0], kx) * pow(CB_[0], ang1_[0] - kx);
-    for (int ky = 0; ky <= ang1_[1]; ++ky) {
-      const double cky = c(ang1_[1], ky) * pow(CB_[1], ang1_[1] - ky);
-      for (int kz = 0; kz <= ang1_[2]; ++kz) {
-        const double ckz = c(ang1_[2], kz) * pow(CB_[2], ang1_[2] - kz);
-        const int index = kx * ANG_HRR_END * ANG_HRR_END + ky * ANG_HRR_END + kz;
-        c1_[index] = ckx * cky * ckz;
-      }
-    }
-  }
-
-  l0_ = ang0_[0] + ang0_[1] + ang0_[2];
-  l1_ = ang1_[0] + ang1_[1] + ang1_[2];
+  lmax_ = 0;
+  for (auto& ishecp : ecp_->shells_ecp()) {
+    const int l = ishecp->angular_number();
+    if (l == ecp_->ecp_maxl()) continue;
 
-  for (int l = 0; l != max(l0_, l1_) + ecp_->ecp_maxl(); ++l) {
-    vector<double> zAB_l(2*l+1, 0.0), zCB_l(2*l+1, 0.0);
-    for (int m = 0; m <= 2*l; ++m) {
-      auto shAB = make_shared<SphHarmonics>(l, m-l, AB_);
-      zAB_l[m] = (dAB_ < 1e-12 ? (1.0/sqrt(4.0*pi__)) : shAB->zlm());
-      auto shCB = make_shared<SphHarmonics>(l, m-l, CB_);
-      zCB_l[m] = (dCB_ < 1e-12 ? (1.0/sqrt(4.0*pi__)) : shCB->zlm());
+    if (projector_bound(*basisinfo_[0], dAB_, *basisinfo_[1], dCB_, *ishecp) > thresh_int_) {
+      shells_.push_back(ishecp);
+      angA_.push_back(angular_factors(l, ang0_, AB_));
+      angC_.push_back(angular_factors(l, ang1_, CB_));
+      lmax_ = max(lmax_, l);
     }
-    zAB_.push_back(zAB_l);
-    zCB_.push_back(zCB_l);
   }
 
 }
@@ -27,9 +27,8 @@
 #define __SRC_INTEGRAL_ECP_ANGULARBATCH_H
 
 #include <src/molecule/atom.h>
-#include <src/util/math/sphharmonics.h>
 #include <src/integral/ecp/radial.h>
-#include <map>
+#include <src/integral/ecp/angularprojection.h>
 
 namespace bagel {
 
@@ -38,31 +37,37 @@ class AngularBatch : public RadialInt {
 
     std::array<std::shared_ptr<const Shell>,2> basisinfo_;
     std::shared_ptr<const ECP> ecp_;
-    int cont0_, cont1_;
-    std::array<int, 3> ang0_, ang1_;
+    std::shared_ptr<AngularProjectionCache> projection_;
+    int ang0_, ang1_, cont0_, cont1_;
+    int ncart0_, ncart1_;
     std::array<double, 3> AB_, CB_;
     double dAB_, dCB_;
-    std::vector<double> c0_, c1_;
-    std::vector<std::map<int, std::array<int, 3>>> map_;
 
-    int l0_, l1_;
-    std::vector<std::vector<double>> zAB_, zCB_;
+    // semi-local projectors that survive screening, and for each of them the angular factors
+    // of both shells in the (cartesian, m, ld, lk) layout
+    std::vector<std::shared_ptr<const Shell_ECP>> shells_;
+    std::vector<std::vector<double>> angA_, angC_;
+    int lmax_;
 
-    void map_angular_number();
-
-    double integrate3SHs(std::array<std::pair<int, int>, 3> lm) const;
-    std::vector<double> project_AB(const int l, const std::vector<double> usp, const std::vector<double> r);
-    std::vector<double> project_CB(const int l, const std::vector<double> usp, const std::vector<double> r);
+    std::vector<double> angular_factors(const int l, const int ang, const std::array<double, 3>& AB) const;
+    std::vector<double> radial_factors(const int ish, const int lmax, const std::vector<double>& r) const;
+    std::vector<double> project(const std::vector<double>& angular, const int l, const int m, const int ang, const int ncont,
+                                const std::vector<double>& radial, const std::vector<double>& rpow) const;
 
   public:
+    // all cartesian components and contractions of the shell pair are integrated on a common radial grid;
+    // integral(i) is laid out as (contA, contC, cartA, cartC) with cartC running fastest
+    // projections are taken from (and added to) the cache of the integral build; a private one is used if none is given
     AngularBatch(const std::shared_ptr<const ECP> _ecp, const std::array<std::shared_ptr<const Shell>,2>& _info,
-                 const int contA, const int contC, const std::array<int, 3> angA, const std::array<int, 3> angC,
-                 const bool print = false, const int max_iter = 100, const double thresh_int = PRIM_SCREEN_THRESH);
+                 std::shared_ptr<AngularProjectionCache> projection = nullptr, const bool print = false, const int max_iter = 100, const double thresh_int = PRIM_SCREEN_THRESH);
 
     ~AngularBatch() {}
 
     std::vector<double> compute(const std::vector<double> r) override;
 
+    // true if no projector of this ECP centre contributes to the shell pair
+    bool screened() const { return shells_.empty(); }
+
     void init();
     void print() const;
     void print_one_centre(std::array<double, 3> posA, const std::array<int, 3> lxyz, const double expA,
@@ -0,0 +1,106 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: angularprojection.cc
+// Copyright (C) 2014 Toru Shiozaki
+//
+// Author: Hai-Anh Le <anh@u.northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#include <src/util/constants.h>
+#include <src/util/math/factorial.h>
+#include <src/util/math/sphharmonics.h>
+#include <src/integral/ecp/angularprojection.h>
+#include <src/integral/ecp/sphusplist.h>
+
+using namespace bagel;
+using namespace std;
+
+const static SphUSPList sphusplist;
+const static DoubleFactorial df;
+
+AngularProjection::AngularProjection(const int l, const int lk, const array<double,3>& AB) : l_(l), lk_(lk) {
+
+  const int ldmax = l_ + lk_;
+  data_.resize((2*l_+1) * (ldmax+1) * (lk_+1)*(lk_+1)*(lk_+1), 0.0);
+
+  // exponents of the unitary sphere polynomials, in the order used by SphUSPList
+  vector<vector<array<int,3>>> usp_xyz(ldmax+1);
+  for (int ld = 0; ld <= ldmax; ++ld)
+    for (int z = 0; z <= ld; ++z)
+      for (int y = 0; y <= ld - z; ++y)
+        usp_xyz[ld].push_back({{ld - y - z, y, z}});
+
+  // sum_mu Z_{ld,mu}(AB) S_{ld,mu} as a polynomial on the unit sphere
+  const double dAB = sqrt(AB[0]*AB[0] + AB[1]*AB[1] + AB[2]*AB[2]);
+  vector<vector<double>> yAB(ldmax+1);
+  for (int ld = 0; ld <= ldmax; ++ld) {
+    yAB[ld].resize(usp_xyz[ld].size(), 0.0);
+    for (int mu = 0; mu <= 2*ld; ++mu) {
+      const double z = dAB < 1e-12 ? (1.0/sqrt(4.0*pi__)) : SphHarmonics(ld, mu-ld, AB).zlm();
+      const vector<double> usp1 = sphusplist.sphuspfunc_call(ld, mu-ld);
+      for (size_t i = 0; i != usp1.size(); ++i)
+        yAB[ld][i] += z * usp1[i];
+    }
+  }
+
+  for (int m = 0; m <= 2*l_; ++m) {
+    const vector<double> usp = sphusplist.sphuspfunc_call(l_, m-l_);
+    for (int kx = 0; kx <= lk_; ++kx)
+    for (int ky = 0; ky <= lk_ - kx; ++ky)
+    for (int kz = 0; kz <= lk_ - kx - ky; ++kz) {
+      const int k = kx + ky + kz;
+      for (int ld = max(l_-k, 0); ld <= l_+k; ++ld) {
+        if ((l_ + k - ld) % 2 != 0) continue;
+        double sum = 0.0;
+        for (size_t j = 0; j != usp.size(); ++j) {
+          if (usp[j] == 0.0) continue;
+          const array<int,3>& kj = usp_xyz[l_][j];
+          for (size_t i = 0; i != yAB[ld].size(); ++i) {
+            if (yAB[ld][i] == 0.0) continue;
+            const array<int,3>& ki = usp_xyz[ld][i];
+            const int x = ki[0] + kj[0] + kx;
+            const int y = ki[1] + kj[1] + ky;
+            const int z = ki[2] + kj[2] + kz;
+            if (x % 2 == 0 && y % 2 == 0 && z % 2 == 0)
+              sum += yAB[ld][i] * usp[j] * 4.0 * pi__ * df(x-1) * df(y-1) * df(z-1) / df(x+y+z+1);
+          }
+        }
+        data_[index(m, ld, kx, ky, kz)] = sum;
+      }
+    }
+  }
+
+}
+
+
+shared_ptr<const AngularProjection> AngularProjectionCache::get(const int l, const int lk, const array<double,3>& AB) {
+
+  // shells on the same atom give bit-wise identical directions
+  const double dAB = sqrt(AB[0]*AB[0] + AB[1]*AB[1] + AB[2]*AB[2]);
+  const array<double,3> dir = dAB < 1e-12 ? array<double,3>{{0.0, 0.0, 0.0}} : array<double,3>{{AB[0]/dAB, AB[1]/dAB, AB[2]/dAB}};
+  const auto key = make_tuple(l, lk, dir);
+
+  lock_guard<mutex> lock(mut_);
+  auto iter = data_.find(key);
+  if (iter == data_.end())
+    iter = data_.emplace(key, make_shared<const AngularProjection>(l, lk, dir)).first;
+  return iter->second;
+
+}
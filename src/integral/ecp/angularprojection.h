@@ -0,0 +1,81 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: angularprojection.h
+// Copyright (C) 2014 Toru Shiozaki
+//
+// Author: Hai-Anh Le <anh@u.northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#ifndef __SRC_INTEGRAL_ECP_ANGULARPROJECTION_H
+#define __SRC_INTEGRAL_ECP_ANGULARPROJECTION_H
+
+#include <array>
+#include <map>
+#include <tuple>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <cassert>
+
+namespace bagel {
+
+// Angular part of the projection of x^kx y^ky z^kz (centred at B, |k| <= lk) onto the real spherical harmonic S_lm at B,
+//   sum_mu Z_{ld,mu}(AB) \int dOmega S_{ld,mu} S_lm x^kx y^ky z^kz,
+// tabulated for all m, ld and k. It depends only on l and the direction of AB, so it is computed
+// once per (shell centre, ECP centre, l) and shared by every component and radial point.
+class AngularProjection {
+  protected:
+    int l_, lk_;
+    std::vector<double> data_;
+
+    size_t index(const int m, const int ld, const int kx, const int ky, const int kz) const {
+      return (((static_cast<size_t>(m)*(l_+lk_+1) + ld)*(lk_+1) + kx)*(lk_+1) + ky)*(lk_+1) + kz;
+    }
+
+  public:
+    AngularProjection(const int l, const int lk, const std::array<double,3>& AB);
+
+    int l() const { return l_; }
+    int lk() const { return lk_; }
+
+    double operator()(const int m, const int ld, const int kx, const int ky, const int kz) const {
+      assert(m <= 2*l_ && ld <= l_+lk_ && kx+ky+kz <= lk_);
+      return data_[index(m, ld, kx, ky, kz)];
+    }
+
+};
+
+
+// Projections keyed on (l, lk, direction of AB). The key does not refer to the ECP centre, so one cache serves all
+// centres, shell pairs and threads of an integral build (see Hcore); it is dropped when the build is done.
+class AngularProjectionCache {
+  protected:
+    std::map<std::tuple<int, int, std::array<double,3>>, std::shared_ptr<const AngularProjection>> data_;
+    std::mutex mut_;
+
+  public:
+    AngularProjectionCache() { }
+
+    std::shared_ptr<const AngularProjection> get(const int l, const int lk, const std::array<double,3>& AB);
+};
+
+}
+
+#endif
@@ -33,8 +33,8 @@ using namespace std;
 const static CarSphList carsphlist;
 
 ECPBatch::ECPBatch(const array<shared_ptr<const Shell>,2>& info, const shared_ptr<const Molecule> mol,
-                         shared_ptr<StackMem> stack)
- : basisinfo_(info), mol_(mol) {
+                         shared_ptr<AngularProjectionCache> projection, shared_ptr<StackMem> stack)
+ : basisinfo_(info), mol_(mol), projection_(projection ? projection : make_shared<AngularProjectionCache>()) {
 
   if (stack == nullptr) {
     stack_ = resources__->get();
@@ -67,30 +67,13 @@ void ECPBatch::compute() {
   fill_n(intermediate_c, size_alloc_, 0.0);
   double* const current_data = intermediate_c;
 
-  int i = 0;
-  for (int izA = 0; izA <= ang0_; ++izA)
-  for (int iyA = 0; iyA <= ang0_ - izA; ++iyA) {
-    const int ixA = ang0_ - izA - iyA;
-    const array<int, 3> lA = {ixA, iyA, izA};
-    for (int izC = 0; izC <= ang1_; ++izC)
-    for (int iyC = 0; iyC <= ang1_ - izC; ++iyC) {
-      const int ixC = ang1_ - izC - iyC;
-      const array<int, 3> lC = {ixC, iyC, izC};
-      for (int contA = 0; contA != cont0_; ++contA)
-      for (int contC = 0; contC != cont1_; ++contC) {
-        double tmp = 0.0;
-        for (auto& aiter : mol_->atoms()) {
-          shared_ptr<const ECP> aiter_ecp = aiter->ecp_parameters();
-
-          AngularBatch radint(aiter_ecp, basisinfo_, contA, contC, lA, lC, false, max_iter_, integral_thresh_);
-          radint.integrate();
-          tmp += radint.integral(0);
-        }
-        const int index = contA * cont1_ * asize_ + contC * asize_ + i;
-        current_data[index] = tmp;
-      }
-      ++i;
-    }
+  // one radial quadrature per ECP centre covers all components and contractions of the shell pair
+  for (auto& aiter : mol_->atoms()) {
+    AngularBatch radint(aiter->ecp_parameters(), basisinfo_, projection_, false, max_iter_, integral_thresh_);
+    if (radint.screened()) continue;
+    radint.integrate();
+    for (size_t i = 0; i != size_alloc_; ++i)
+      current_data[i] += radint.integral(i);
   }
 
   get_data(current_data, data_);
@@ -41,6 +41,7 @@ class ECPBatch : public Integral {
 
     std::array<std::shared_ptr<const Shell>,2> basisinfo_;
     std::shared_ptr<const Molecule> mol_;
+    std::shared_ptr<AngularProjectionCache> projection_;
 
     bool spherical_;
 
@@ -60,7 +61,7 @@ class ECPBatch : public Integral {
 
   public:
     ECPBatch(const std::array<std::shared_ptr<const Shell>,2>& info, const std::shared_ptr<const Molecule> mol,
-                   std::shared_ptr<StackMem> = nullptr);
+                   std::shared_ptr<AngularProjectionCache> projection = nullptr, std::shared_ptr<StackMem> = nullptr);
     ~ECPBatch();
 
     double* data() { return data_; }
@@ -23,6 +23,7 @@
 //
 
 
+#include <src/util/math/comb.h>
 #include <src/integral/ecp/radial.h>
 
 using namespace bagel;
@@ -156,3 +157,64 @@ void RadialInt::GaussChebyshev2nd(const int ngrid) {
     w_[i-1] = pi__ * sin(i * pi__ / (ngrid + 1)) / (ngrid + 1);
   }
 }
+
+double RadialInt::projector_bound(const Shell& shA, const double dA, const Shell& shC, const double dC, const Shell_ECP& ecp) {
+
+  // With r the distance from the ECP centre, a cartesian function of A is bounded on the sphere by
+  //   |c| (r+dA)^la exp(-alpha (r-dA)^2),
+  // and sum_m |<A|lm>(r)|^2 <= \int dOmega |A|^2 <= 4pi max|A|^2, so by Cauchy-Schwarz the integral is bounded by
+  //   4pi sum_k |d_k| \int dr r^n_k (r+dA)^la (r+dC)^lc exp(-alpha (r-dA)^2 - gamma (r-dC)^2 - zeta_k r^2).
+  // With p = alpha+gamma+zeta_k and r = r0 + s, r^j <= (r0 + |s|)^j, which integrates in closed form over the real line.
+  const static Comb comb;
+  const int la = shA.angular_number();
+  const int lc = shC.angular_number();
+
+  // |c| of each primitive, maximised over the contracted functions it enters
+  auto maxcoeff = [](const Shell& sh) {
+    vector<double> out(sh.num_primitive(), 0.0);
+    for (int ic = 0; ic != sh.num_contracted(); ++ic)
+      for (int i = sh.contraction_ranges(ic).first; i != sh.contraction_ranges(ic).second; ++i)
+        out[i] = max(out[i], fabs(sh.contractions()[ic][i]));
+    return out;
+  };
+  const vector<double> cA = maxcoeff(shA);
+  const vector<double> cC = maxcoeff(shC);
+
+  double out = 0.0;
+  for (int k = 0; k != ecp.ecp_exponents().size(); ++k) {
+    if (ecp.ecp_coefficients(k) == 0.0) continue;
+    const int n = ecp.ecp_r_power(k);
+    const double zeta = ecp.ecp_exponents(k);
+    assert(n >= 0);
+
+    // r^n (r+dA)^la (r+dC)^lc as a polynomial in r; all coefficients are non-negative
+    const int deg = n + la + lc;
+    vector<double> poly(deg+1, 0.0);
+    for (int a = 0; a <= la; ++a)
+      for (int c = 0; c <= lc; ++c)
+        poly[n+a+c] += comb(la, a) * pow(dA, la-a) * comb(lc, c) * pow(dC, lc-c);
+
+    for (int i = 0; i != shA.num_primitive(); ++i) {
+      const double alpha = shA.exponents(i);
+      for (int j = 0; j != shC.num_primitive(); ++j) {
+        const double gamma = shC.exponents(j);
+        const double p = alpha + gamma + zeta;
+        const double r0 = (alpha * dA + gamma * dC) / p;
+        const double exponent = (alpha * gamma * pow(dA - dC, 2) + zeta * (alpha * dA * dA + gamma * dC * dC)) / p;
+
+        // \int ds |s|^m exp(-p s^2) = Gamma((m+1)/2) p^{-(m+1)/2}
+        double moment = 0.0;
+        for (int d = 0; d <= deg; ++d) {
+          if (poly[d] == 0.0) continue;
+          double sum = 0.0;
+          for (int m = 0; m <= d; ++m)
+            sum += comb(d, m) * pow(r0, d-m) * tgamma(0.5*(m+1)) * pow(p, -0.5*(m+1));
+          moment += poly[d] * sum;
+        }
+        out += fabs(ecp.ecp_coefficients(k)) * cA[i] * cC[j] * exp(-exponent) * moment;
+      }
+    }
+  }
+  return 4.0 * pi__ * out;
+
+}
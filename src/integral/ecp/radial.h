@@ -32,6 +32,8 @@
 #include <iomanip>
 #include <src/util/constants.h>
 #include <src/util/timer.h>
+#include <src/molecule/shell.h>
+#include <src/molecule/shellecp.h>
 
 namespace bagel {
 
@@ -67,6 +69,10 @@ class RadialInt {
 
     void GaussChebyshev2nd(const int ngrid);
 
+    // upper bound on |sum_m <A|lm> u_l(r) <lm|C>| for any cartesian component and contracted function of
+    // shells A and C at distances dA and dC from the centre of the projector u_l (used for screening)
+    static double projector_bound(const Shell& shA, const double dA, const Shell& shC, const double dC, const Shell_ECP& ecp);
+
 };
 
 }
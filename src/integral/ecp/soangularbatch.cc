@@ -24,43 +24,24 @@
 
 
 #include <src/util/math/bessel.h>
-#include <src/util/math/algo.h>
+#include <src/util/math/comb.h>
 #include <src/integral/ecp/soangularbatch.h>
-#include <src/integral/ecp/sphusplist.h>
+#include <src/integral/ecp/angularprojection.h>
 #include <iomanip>
 
 using namespace bagel;
 using namespace std;
 
-const static SphUSPList sphusplist;
-const static DoubleFactorial df;
+const static MSphBesselI msbessel;
 
 SOBatch::SOBatch(const shared_ptr<const SOECP> _so, const array<shared_ptr<const Shell>,2>& _info,
-                           const int contA, const int contC, const array<int, 3> angA, const array<int, 3> angC,
-                           const bool print, const int max_iter, const double thresh_int)
- : RadialInt(3, print, max_iter, thresh_int),
-   basisinfo_(_info), so_(_so), cont0_(contA), cont1_(contC), ang0_(angA), ang1_(angC) {
+                 shared_ptr<AngularProjectionCache> projection, const bool print, const int max_iter, const double thresh_int)
+ : RadialInt(3 * _info[0]->num_contracted() * _info[1]->num_contracted()
+             * (_info[0]->angular_number()+1) * (_info[0]->angular_number()+2) / 2
+             * (_info[1]->angular_number()+1) * (_info[1]->angular_number()+2) / 2, print, max_iter, thresh_int),
+   basisinfo_(_info), so_(_so), projection_(projection ? projection : make_shared<AngularProjectionCache>()) {
 
   init();
-  map_angular_number();
-
-}
-
-void SOBatch::map_angular_number() {
-
-  for (int l = 0; l != ANG_HRR_END*2-1; ++l) {
-    map<int, array<int, 3>> mapl;
-    int key = 0;
-    for (int z = 0; z <= l; ++z) {
-      for (int y = 0; y <= l - z; ++y) {
-        const int x = l - y - z;
-        array<int, 3> xyz = {{x, y, z}};
-        mapl.insert(make_pair(key, xyz));
-        ++key;
-      }
-    }
-    map_.push_back(mapl);
-  }
 
 }
 
@@ -98,92 +79,54 @@ array<double, 3> SOBatch::fm0lm1(const int l, const int m0, const int m1) const
   return out;
 }
 
-double SOBatch::angularA(const int h, const int ld, const vector<double> usp) {
-
-  double out = 0;
-
-  const int l = static_cast<int>(round(sqrt(usp.size()*2)-1));
-  assert((l+1)*(l+2) == usp.size() * 2);
-
-  for (int a = max(0, h-ang0_[1]-ang0_[2]); a <= min(ang0_[0], h); ++a) {
-    for (int b = max(0, h-a-ang0_[2]); b <= min(ang0_[1], h-a); ++b) {
-      const int index = a * ANG_HRR_END * ANG_HRR_END + b * ANG_HRR_END + h - a - b;
-      if (abs(c0_[index]) > 1e-15) {
-
-        double smu = 0.0;
-        for (int j = 0; j != usp.size(); ++j) {
-          if (usp[j] != 0.0) {
-            map<int, array<int, 3>>::const_iterator pj = map_[l].find(j);
-            assert (pj != map_[l].end());
-            const array<int, 3> kj = pj->second;
-
-            for (int mu = 0; mu <= 2*ld; ++mu) {
-              const vector<double> usp1 = sphusplist.sphuspfunc_call(ld, mu-ld);
-              double sAB = 0.0;
-              for (int i = 0; i != usp1.size(); ++i) {
-                if (usp1[i] != 0.0) {
-                  map<int, array<int, 3>>::const_iterator pi = map_[ld].find(i);
-                  assert (pi != map_[ld].end());
-                  const array<int, 3> ki = pi->second;
-                  const int x = ki[0] + kj[0] + a;
-                  const int y = ki[1] + kj[1] + b;
-                  const int z = ki[2] + kj[2] + h-a-b;
-                  const double xyz = (x % 2 == 0 && y % 2 == 0 && z % 2 == 0) ? (4.0 * pi__ * df(x-1) * df(y-1) * df(z-1) / df(x+y+z+1)) : 0.0;
-                  sAB += usp1[i] * usp[j] * xyz;
-                }
-              }
-              smu += zAB_[ld][mu] * sAB;
-            }
-          }
-        }
-        out += smu*c0_[index];
-      }
+vector<double> SOBatch::angular_factors(const int l, const int ang, const array<double, 3>& AB) const {
+
+  const static Comb c;
+  const AngularProjection& proj = *projection_->get(l, ang, AB);
+
+  const int nld = l + ang + 1;
+  vector<double> out((ang+1)*(ang+2)/2 * (2*l+1) * nld * (ang+1), 0.0);
+
+  int icart = 0;
+  for (int iz = 0; iz <= ang; ++iz)
+  for (int iy = 0; iy <= ang - iz; ++iy) {
+    const int ix = ang - iz - iy;
+    for (int kx = 0; kx <= ix; ++kx)
+    for (int ky = 0; ky <= iy; ++ky)
+    for (int kz = 0; kz <= iz; ++kz) {
+      const int h = kx + ky + kz;
+      const double coeff = c(ix, kx) * pow(AB[0], ix - kx) * c(iy, ky) * pow(AB[1], iy - ky) * c(iz, kz) * pow(AB[2], iz - kz)
+                         * pow(-1.0, ang - h);
+      if (abs(coeff) > 1e-15)
+        for (int m = 0; m <= 2*l; ++m)
+          for (int ld = max(l-h, 0); ld <= l+h; ++ld)
+            if ((l + h - ld) % 2 == 0)
+              out[((icart*(2*l+1) + m)*nld + ld)*(ang+1) + h] += coeff * proj(m, ld, kx, ky, kz);
     }
+    ++icart;
   }
 
   return out;
 
 }
 
-double SOBatch::angularC(const int h, const int ld, const vector<double> usp) {
-
-  double out = 0;
-
-  const int l = static_cast<int>(round(sqrt(usp.size()*2)-1));
-  assert((l+1)*(l+2) == usp.size() * 2);
-
-  for (int a = max(0, h-ang1_[1]-ang1_[2]); a <= min(ang1_[0], h); ++a) {
-    for (int b = max(0, h-a-ang1_[2]); b <= min(ang1_[1], h-a); ++b) {
-      const int index = a * ANG_HRR_END * ANG_HRR_END + b * ANG_HRR_END + h - a - b;
-      if (abs(c1_[index]) > 1e-15) {
-
-        double smu = 0.0;
-        for (int j = 0; j != usp.size(); ++j) {
-          if (usp[j] != 0.0) {
-            map<int, array<int, 3>>::const_iterator pj = map_[l].find(j);
-            assert (pj != map_[l].end());
-            const array<int, 3> kj = pj->second;
-
-            for (int mu = 0; mu <= 2*ld; ++mu) {
-              const vector<double> usp1 = sphusplist.sphuspfunc_call(ld, mu-ld);
-              double sCB = 0.0;
-              for (int i = 0; i != usp1.size(); ++i) {
-                if (usp1[i] != 0.0) {
-                  map<int, array<int, 3>>::const_iterator pi = map_[ld].find(i);
-                  assert (pi != map_[ld].end());
-                  const array<int, 3> ki = pi->second;
-                  const int x = ki[0] + kj[0] + a;
-                  const int y = ki[1] + kj[1] + b;
-                  const int z = ki[2] + kj[2] + h-a-b;
-                  const double xyz = (x % 2 == 0 && y % 2 == 0 && z % 2 == 0) ? (4.0 * pi__ * df(x-1) * df(y-1) * df(z-1) / df(x+y+z+1)) : 0.0;
-                  sCB += usp1[i] * usp[j] * xyz;
-                }
-              }
-              smu += zCB_[ld][mu] * sCB;
-            }
-          }
-        }
-        out += smu*c1_[index];
+vector<double> SOBatch::radial_factors(const int ish, const int lmax, const vector<double>& r) const {
+
+  const shared_ptr<const Shell> shell = basisinfo_[ish];
+  const double d = ish == 0 ? dAB_ : dCB_;
+  const int nr = r.size();
+
+  // sum over primitives of the contracted function times the scaled modified spherical Bessel functions, (cont, ld, r)
+  vector<double> out(shell->num_contracted() * (lmax+1) * nr, 0.0);
+  for (int ic = 0; ic != shell->num_contracted(); ++ic) {
+    double* const o = out.data() + ic*(lmax+1)*nr;
+    for (int i = shell->contraction_ranges(ic).first; i != shell->contraction_ranges(ic).second; ++i) {
+      const double coef = shell->contractions()[ic][i];
+      const double expo = shell->exponents(i);
+      for (int ir = 0; ir != nr; ++ir) {
+        const double fac = coef * exp(-expo * pow(d-r[ir], 2));
+        for (int ld = 0; ld <= lmax; ++ld)
+          o[ld*nr+ir] += fac * msbessel.compute(ld, 2.0 * expo * d * r[ir]);
       }
     }
   }
@@ -192,73 +135,67 @@ double SOBatch::angularC(const int h, const int ld, const vector<double> usp) {
 
 }
 
-vector<double> SOBatch::project(const int l, const vector<double> r) {
-
-  const static MSphBesselI msbessel;
-  vector<vector<double>> rbessel0(r.size()), rbessel1(r.size());
-
-  const int begin0 = basisinfo_[0]->contraction_ranges(cont0_).first;
-  const int end0   = basisinfo_[0]->contraction_ranges(cont0_).second;
-
-  const int begin1 = basisinfo_[1]->contraction_ranges(cont1_).first;
-  const int end1   = basisinfo_[1]->contraction_ranges(cont1_).second;
-
-  for (int ir = 0; ir != r.size(); ++ir) {
-    vector<double> b0(l0_+l+1, 0.0);
-    for (int i0 = begin0; i0 != end0; ++i0) {
-      const double coef0 = basisinfo_[0]->contractions()[cont0_][i0];
-      const double exp0 = basisinfo_[0]->exponents(i0);
-      const double fac0 = coef0 * exp(-exp0 * pow(dAB_-r[ir], 2));
-      for (int i = 0; i <= l0_+l; ++i)
-        b0[i] += fac0 * msbessel.compute(i, 2.0*exp0*dAB_*r[ir]);
-    }
-    rbessel0[ir] = b0;
-
-    vector<double> b1(l1_+l+1, 0.0);
-    for (int i1 = begin1; i1 != end1; ++i1) {
-      const double coef1 = basisinfo_[1]->contractions()[cont1_][i1];
-      const double exp1 = basisinfo_[1]->exponents(i1);
-      const double fac1 = coef1 * exp(-exp1 * pow(dCB_-r[ir], 2));
-      for (int i = 0; i <= l1_+l; ++i)
-        b1[i] += fac1 * msbessel.compute(i, 2.0*exp1*dCB_*r[ir]);
-    }
-    rbessel1[ir] = b1;
-  }
-
-  vector<vector<double>> usp(2*l+1);
-  for (int m = 0; m <= 2*l; ++m) usp[m] = sphusplist.sphuspfunc_call(l, m-l);
-
-  vector<double> out(3*r.size(), 0.0);
-
-  for (int ld0 = max(0, l-l0_); ld0 <= l+l0_; ++ld0) {
-    for (int ld1 = max(0, l-l1_); ld1 <= l+l1_; ++ld1) {
-      const int c0 = l0_ - (l0_ - abs(ld0-l))%2;
-      const int c1 = l1_ - (l1_ - abs(ld1-l))%2;
+vector<double> SOBatch::project(const int l, const vector<double>& r, const vector<double>& radialA, const vector<double>& radialC) const {
+
+  const int nr = r.size();
+  const int asize = ncart0_ * ncart1_;
+  const int nblock = cont0_ * cont1_ * asize;
+  const int nldA = l + ang0_ + 1;
+  const int nldC = l + ang1_ + 1;
+  const int strideA = ang0_ + lmax_ + 1;
+  const int strideC = ang1_ + lmax_ + 1;
+  const vector<double>& angA = angA_[l-1];
+  const vector<double>& angC = angC_[l-1];
+  auto angularA = [&](const int iA, const int h, const int ld, const int m) { return angA[((iA*(2*l+1) + m)*nldA + ld)*(ang0_+1) + h]; };
+  auto angularC = [&](const int iC, const int h, const int ld, const int m) { return angC[((iC*(2*l+1) + m)*nldC + ld)*(ang1_+1) + h]; };
+
+  vector<double> out(3*nblock*nr, 0.0);
+  vector<double> p(nr);
+  vector<array<double, 3>> sum(asize);
+
+  for (int ld0 = max(0, l-ang0_); ld0 <= l+ang0_; ++ld0) {
+    for (int ld1 = max(0, l-ang1_); ld1 <= l+ang1_; ++ld1) {
+      const int c0 = ang0_ - (ang0_ - abs(ld0-l))%2;
+      const int c1 = ang1_ - (ang1_ - abs(ld1-l))%2;
 
       const int gmin = abs(ld0-l)+abs(ld1-l);
       const int gmax = c0 + c1;
       for (int g = gmin; g <= gmax; g += 2) {
-        array<double, 3> sum = {{0.0, 0.0, 0.0}};
-
         const int hmin = max(abs(ld0-l), g - c1);
         const int hmax = min(c0, g - abs(ld1-l));
-        for (int i = 0; i != fm0lm1_[l-1].size(); ++i) {
-          tuple<int, int, int, double> fmm = fm0lm1_[l-1][i];
-          const int id = get<0>(fmm);
-          const int m0 = get<1>(fmm);
-          const int m1 = get<2>(fmm);
-          const double f = get<3>(fmm);
-          for (int h = hmin; h <= hmax; h += 2)
-            sum[id] += (angularA(h, ld0, usp[m0]) * angularC(g-h, ld1, usp[m1]) - angularA(h, ld0, usp[m1]) * angularC(g-h, ld1, usp[m0]))*f;
-        }
-        for (int ir = 0; ir != r.size(); ++ir) {
-          const double p = rbessel0[ir][ld0] * rbessel1[ir][ld1] * pow(r[ir], g);
-          for (int id = 0; id != 3; ++id) {
-            const int index = id*r.size() + ir;
-            out[index] += sum[id] * p;
+
+        bool nonzero = false;
+        for (int iA = 0; iA != ncart0_; ++iA)
+          for (int iC = 0; iC != ncart1_; ++iC) {
+            array<double, 3>& s = sum[iA*ncart1_ + iC];
+            s = {{0.0, 0.0, 0.0}};
+            for (auto& fmm : fm0lm1_[l-1]) {
+              const int id = get<0>(fmm);
+              const int m0 = get<1>(fmm);
+              const int m1 = get<2>(fmm);
+              const double f = get<3>(fmm);
+              for (int h = hmin; h <= hmax; h += 2)
+                s[id] += (angularA(iA, h, ld0, m0) * angularC(iC, g-h, ld1, m1) - angularA(iA, h, ld0, m1) * angularC(iC, g-h, ld1, m0))*f;
+            }
+            nonzero |= s[0] != 0.0 || s[1] != 0.0 || s[2] != 0.0;
           }
+        if (!nonzero) continue;
+
+        for (int contA = 0; contA != cont0_; ++contA)
+        for (int contC = 0; contC != cont1_; ++contC) {
+          const double* const bA = radialA.data() + (contA*strideA + ld0)*nr;
+          const double* const bC = radialC.data() + (contC*strideC + ld1)*nr;
+          for (int ir = 0; ir != nr; ++ir)
+            p[ir] = bA[ir] * bC[ir] * pow(r[ir], g);
+          for (int i = 0; i != asize; ++i)
+            for (int id = 0; id != 3; ++id) {
+              const double s = sum[i][id];
+              if (s == 0.0) continue;
+              double* const o = out.data() + (id*nblock + (contA*cont1_ + contC)*asize + i)*nr;
+              for (int ir = 0; ir != nr; ++ir)
+                o[ir] += s * p[ir];
+            }
         }
-
       }
     }
   }
@@ -269,23 +206,31 @@ vector<double> SOBatch::project(const int l, const vector<double> r) {
 
 vector<double> SOBatch::compute(const vector<double> r) {
 
-  vector<shared_ptr<const Shell_ECP>> shells_so = so_->shells_so();
-  vector<double> out(3*r.size(), 0.0);
+  const int nr = r.size();
+  vector<double> out(nc_*nr, 0.0);
+  if (shells_.empty()) return out;
+
+  const vector<double> radialA = radial_factors(0, ang0_ + lmax_, r);
+  const vector<double> radialC = radial_factors(1, ang1_ + lmax_, r);
 
-  for (auto& ishso : shells_so) {
+  for (auto& ishso : shells_) {
     const int l = ishso->angular_number();
-    vector<double> p = project(l, r);
+    const vector<double> p = project(l, r, radialA, radialC);
+
+    vector<double> u(nr, 0.0);
     for (int i = 0; i != ishso->ecp_exponents().size(); ++i)
       if (ishso->ecp_coefficients(i) != 0) {
         const double ecpcoeff = 16.0 * pi__ * pi__ * ishso->ecp_coefficients(i); // 2/(2l+1) not needed for Stuggart basis sets
-        for (int ir = 0; ir != r.size(); ++ir) {
-          const double coeff = ecpcoeff * pow(r[ir], ishso->ecp_r_power(i)) * exp(-ishso->ecp_exponents(i) * r[ir] * r[ir]);
-          for (int id = 0; id != 3; ++id) {
-            const int index = id*r.size() + ir;
-            out[index] += coeff * p[index];
-          }
-        }
+        for (int ir = 0; ir != nr; ++ir)
+          u[ir] += ecpcoeff * pow(r[ir], ishso->ecp_r_power(i)) * exp(-ishso->ecp_exponents(i) * r[ir] * r[ir]);
       }
+
+    for (int ic = 0; ic != nc_; ++ic) {
+      const double* const pc = p.data() + ic*nr;
+      double* const o = out.data() + ic*nr;
+      for (int ir = 0; ir != nr; ++ir)
+        o[ir] += u[ir] * pc[ir];
+    }
   }
 
   return out;
@@ -294,8 +239,13 @@ vector<double> SOBatch::compute(const vector<double> r) {
 
 void SOBatch::init() {
 
-  l0_ = ang0_[0] + ang0_[1] + ang0_[2];
-  l1_ = ang1_[0] + ang1_[1] + ang1_[2];
+  ang0_ = basisinfo_[0]->angular_number();
+  ang1_ = basisinfo_[1]->angular_number();
+  cont0_ = basisinfo_[0]->num_contracted();
+  cont1_ = basisinfo_[1]->num_contracted();
+  ncart0_ = (ang0_+1) * (ang0_+2) / 2;
+  ncart1_ = (ang1_+1) * (ang1_+2) / 2;
+  assert(nc_ == 3 * cont0_ * cont1_ * ncart0_ * ncart1_);
 
   for (int i = 0; i != 3; ++i) {
     AB_[i] = basisinfo_[0]->position(i) - so_->position(i);
@@ -304,47 +254,25 @@ void SOBatch::init() {
   dAB_ = sqrt(pow(AB_[0], 2) + pow(AB_[1], 2) + pow(AB_[2], 2));
   dCB_ = sqrt(pow(CB_[0], 2) + pow(CB_[1], 2) + pow(CB_[2], 2));
 
-  c0_.resize(ANG_HRR_END*ANG_HRR_END*ANG_HRR_END);
-  c1_.resize(ANG_HRR_END*ANG_HRR_END*ANG_HRR_END);
-
-  const static Comb c;
-
-  for (int kx = 0; kx <= ang0_[0]; ++kx) {
-    const double ckx = c(ang0_[0], kx) * pow(AB_[0], ang0_[0] - kx);
-    for (int ky = 0; ky <= ang0_[1]; ++ky) {
-      const double cky = c(ang0_[1], ky) * pow(AB_[1], ang0_[1] - ky);
-      for (int kz = 0; kz <= ang0_[2]; ++kz) {
-        const double ckz = c(ang0_[2], kz) * pow(AB_[2], ang0_[2] - kz);
-        const int index = kx * ANG_HRR_END * ANG_HRR_END + ky * ANG_HRR_END + kz;
-        c0_[index] = ckx * cky * ckz * pow(-1.0, l0_-kx-ky-kz);
-      }
-    }
-  }
-
-  for (int kx = 0; kx <= ang1_[0]; ++kx) {
-    const double ckx = c(ang1_[0], kx) * pow(CB_[0], ang1_[0] - kx);
-    for (int ky = 0; ky <= ang1_[1]; ++ky) {
-      const double cky = c(ang1_[1], ky) * pow(CB_[1], ang1_[1] - ky);
-      for (int kz = 0; kz <= ang1_[2]; ++kz) {
-        const double ckz = c(ang1_[2], kz) * pow(CB_[2], ang1_[2] - kz);
-        const int index = kx * ANG_HRR_END * ANG_HRR_END + ky * ANG_HRR_END + kz;
-        c1_[index] = ckx * cky * ckz * pow(-1.0, l1_-kx-ky-kz);
+  lmax_ = 0;
+  angA_.resize(so_->so_maxl());
+  angC_.resize(so_->so_maxl());
+  for (auto& ishso : so_->shells_so()) {
+    const int l = ishso->angular_number();
+    if (l == 0) continue;
+
+    // the matrix of L_i between the S_lm has a Frobenius norm of sqrt(l(l+1)(2l+1)/3), which bounds its spectral norm
+    const double lnorm = sqrt(l*(l+1)*(2*l+1)/3.0);
+    if (lnorm * projector_bound(*basisinfo_[0], dAB_, *basisinfo_[1], dCB_, *ishso) > thresh_int_) {
+      shells_.push_back(ishso);
+      if (angA_[l-1].empty()) {
+        angA_[l-1] = angular_factors(l, ang0_, AB_);
+        angC_[l-1] = angular_factors(l, ang1_, CB_);
       }
+      lmax_ = max(lmax_, l);
     }
   }
 
-  for (int l = 0; l <= max(l0_, l1_) + so_->so_maxl(); ++l) {
-    vector<double> zAB_l(2*l+1, 0.0), zCB_l(2*l+1, 0.0);
-    for (int m = 0; m <= 2*l; ++m) {
-      auto shAB = make_shared<SphHarmonics>(l, m-l, AB_);
-      zAB_l[m] = (dAB_ < 1e-12 ? (1.0/sqrt(4.0*pi__)) : shAB->zlm());
-      auto shCB = make_shared<SphHarmonics>(l, m-l, CB_);
-      zCB_l[m] = (dCB_ < 1e-12 ? (1.0/sqrt(4.0*pi__)) : shCB->zlm());
-    }
-    zAB_.push_back(zAB_l);
-    zCB_.push_back(zCB_l);
-  }
-
   fm0lm1_.resize(so_->so_maxl());
   for (int l = 1; l <= so_->so_maxl(); ++l) {
     vector<tuple<int, int, int, double>> fmm;
@@ -27,9 +27,10 @@
 #define __SRC_INTEGRAL_ECP_SOBATCH_H
 
 #include <src/molecule/atom.h>
-#include <src/util/math/sphharmonics.h>
 #include <src/integral/ecp/radial.h>
-#include <map>
+#include <src/integral/ecp/angularprojection.h>
+#include <complex>
+#include <tuple>
 
 namespace bagel {
 
@@ -38,34 +39,40 @@ class SOBatch : public RadialInt {
 
     std::array<std::shared_ptr<const Shell>,2> basisinfo_;
     std::shared_ptr<const SOECP> so_;
-    int cont0_, cont1_;
-    std::array<int, 3> ang0_, ang1_;
+    std::shared_ptr<AngularProjectionCache> projection_;
+    int ang0_, ang1_, cont0_, cont1_;
+    int ncart0_, ncart1_;
     std::array<double, 3> AB_, CB_;
     double dAB_, dCB_;
-    std::vector<double> c0_, c1_;
-    std::vector<std::map<int, std::array<int, 3>>> map_;
 
-    int l0_, l1_;
-    std::vector<std::vector<double>> zAB_, zCB_;
     std::vector<std::vector<std::tuple<int, int, int, double>>> fm0lm1_; // li, m0, m1, fmm
 
-    void map_angular_number();
+    // spin-orbit projectors that survive screening; angular factors for each l in the (cartesian, m, ld, h) layout
+    std::vector<std::shared_ptr<const Shell_ECP>> shells_;
+    std::vector<std::vector<double>> angA_, angC_;
+    int lmax_;
+
     std::complex<double> theta(const int m) const;
 
     std::array<double, 3> fm0lm1(const int l, const int m0, const int m1) const;
-    std::vector<double> project(const int l, const std::vector<double> r);
-    double angularA(const int h, const int ld, const std::vector<double> usp);
-    double angularC(const int h, const int ld, const std::vector<double> usp);
+    std::vector<double> angular_factors(const int l, const int ang, const std::array<double, 3>& AB) const;
+    std::vector<double> radial_factors(const int ish, const int lmax, const std::vector<double>& r) const;
+    std::vector<double> project(const int l, const std::vector<double>& r, const std::vector<double>& radialA, const std::vector<double>& radialC) const;
 
   public:
+    // all cartesian components and contractions of the shell pair are integrated on a common radial grid;
+    // integral(i) is laid out as (Im{aa}/Re{ab}/Im{ab}, contA, contC, cartA, cartC) with cartC running fastest
+    // projections are taken from (and added to) the cache of the integral build; a private one is used if none is given
     SOBatch(const std::shared_ptr<const SOECP> _so, const std::array<std::shared_ptr<const Shell>,2>& _info,
-                 const int contA, const int contC, const std::array<int, 3> angA, const std::array<int, 3> angC,
-                 const bool print = false, const int max_iter = 100, const double thresh_int = PRIM_SCREEN_THRESH);
+            std::shared_ptr<AngularProjectionCache> projection = nullptr, const bool print = false, const int max_iter = 100, const double thresh_int = PRIM_SCREEN_THRESH);
 
     ~SOBatch() {}
 
     std::vector<double> compute(const std::vector<double> r) override;
 
+    // true if no spin-orbit projector of this centre contributes to the shell pair
+    bool screened() const { return shells_.empty(); }
+
     void init();
     void print() const;
 
@@ -33,8 +33,8 @@ using namespace std;
 const static CarSphList carsphlist;
 
 SOECPBatch::SOECPBatch(const array<shared_ptr<const Shell>,2>& info, const shared_ptr<const Molecule> mol,
-                       shared_ptr<StackMem> stack)
- : basisinfo_(info), mol_(mol) {
+                       shared_ptr<AngularProjectionCache> projection, shared_ptr<StackMem> stack)
+ : basisinfo_(info), mol_(mol), projection_(projection ? projection : make_shared<AngularProjectionCache>()) {
 
   if (stack == nullptr) {
     stack_ = resources__->get();
@@ -70,42 +70,16 @@ void SOECPBatch::compute() {
   double* current_data1 = intermediate_c + size_block_;
   double* current_data2 = intermediate_c + 2*size_block_;
 
-  int i = 0;
-  for (int izA = 0; izA <= ang0_; ++izA)
-  for (int iyA = 0; iyA <= ang0_ - izA; ++iyA) {
-    const int ixA = ang0_ - izA - iyA;
-    const array<int, 3> lA = {ixA, iyA, izA};
-    for (int izC = 0; izC <= ang1_; ++izC)
-    for (int iyC = 0; iyC <= ang1_ - izC; ++iyC) {
-      const int ixC = ang1_ - izC - iyC;
-      const array<int, 3> lC = {ixC, iyC, izC};
-      for (int contA = 0; contA != cont0_; ++contA)
-      for (int contC = 0; contC != cont1_; ++contC) {
-        double iaa = 0.0;
-        double rab = 0.0;
-        double iab = 0.0;
-        for (auto& aiter : mol_->atoms()) {
-          shared_ptr<const SOECP> aiter_ecp = aiter->so_parameters();
-          if (aiter_ecp->so_maxl() > 0) {
-            SOBatch radint(aiter_ecp, basisinfo_, contA, contC, lA, lC, false, max_iter_, integral_thresh_);
-            radint.integrate();
-            iaa += radint.integral(0);
-            rab += radint.integral(1);
-            iab += radint.integral(2);
-          }
-        }
-        const int index = contA * cont1_ * asize_ + contC * asize_ + i;
-        if (swap01_) {
-          current_data[index]  =-iaa;
-          current_data1[index] =-rab;
-          current_data2[index] =-iab;
-        } else {
-          current_data[index]  = iaa;
-          current_data1[index] = rab;
-          current_data2[index] = iab;
-        }
-      }
-      ++i;
+  // one radial quadrature per centre covers all components and contractions of the shell pair
+  for (auto& aiter : mol_->atoms()) {
+    shared_ptr<const SOECP> aiter_ecp = aiter->so_parameters();
+    if (aiter_ecp->so_maxl() > 0) {
+      SOBatch radint(aiter_ecp, basisinfo_, projection_, false, max_iter_, integral_thresh_);
+      if (radint.screened()) continue;
+      radint.integrate();
+      const double sign = swap01_ ? -1.0 : 1.0;
+      for (size_t i = 0; i != size_alloc_; ++i)
+        intermediate_c[i] += sign * radint.integral(i);
     }
   }
 
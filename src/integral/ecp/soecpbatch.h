@@ -41,6 +41,7 @@ class SOECPBatch : public Integral {
 
     std::array<std::shared_ptr<const Shell>,2> basisinfo_;
     std::shared_ptr<const Molecule> mol_;
+    std::shared_ptr<AngularProjectionCache> projection_;
 
     bool spherical_;
 
@@ -62,7 +63,7 @@ class SOECPBatch : public Integral {
 
   public:
     SOECPBatch(const std::array<std::shared_ptr<const Shell>,2>& info, const std::shared_ptr<const Molecule> mol,
-                   std::shared_ptr<StackMem> = nullptr);
+                   std::shared_ptr<AngularProjectionCache> projection = nullptr, std::shared_ptr<StackMem> = nullptr);
     ~SOECPBatch();
 
     const double* data() const { return data_; }
@@ -93,5 +93,114 @@ void vrr_driver(DataType* out, const DataType* const roots, const DataType* cons
 }
 
 
+// number of primitive quartets that are processed at once in vrr_driver_batch (one AVX2 register of doubles)
+constexpr int vrr_batch_size = 4;
+
+
+// Same as vrr_driver, but processes the primitive quartets listed in screening in batches of vrr_batch_size.
+// The recursion runs over nbatch*rank_ lanes (root-major, primitive-minor) so that short Rys quadratures still fill SIMD registers,
+// and the quadrature sums in the final step become vertical additions over the primitives in the batch.
+// The work arrays should have at least vrr_batch_size*rank_*(a_+b_+1)*(c_+d_+1) elements each.
+template<int a_, int b_, int c_, int d_, int rank_, typename DataType>
+void vrr_driver_batch(DataType* out, const int acsize, const int* const screening, const int nscreen,
+                      const DataType* const roots, const DataType* const weights, const DataType* const coeff,
+                      const std::array<double,3>& A, const std::array<double,3>& C,
+                      const DataType* const P, const DataType* const Q, const double* const xp, const double* const xq,
+                      const int* const amap, const int* const cmap, const int& asize_, DataType* const workx, DataType* const worky, DataType* const workz) {
+
+  // compile time
+  constexpr int amax_ = a_+b_;
+  constexpr int cmax_ = c_+d_;
+  constexpr int amax1_ = a_+b_+1;
+  constexpr int cmax1_ = c_+d_+1;
+  constexpr int amin_ = a_;
+  constexpr int cmin_ = c_;
+
+  constexpr int nbatch = vrr_batch_size;
+  constexpr int lane = nbatch * rank_;
+  constexpr int isize = (amax_ + 1) * (cmax_ + 1);
+  constexpr int worksize = lane * isize;
+
+  alignas(32) DataType C00[3][lane];
+  alignas(32) DataType D00[3][lane];
+  alignas(32) DataType B00[lane];
+  alignas(32) DataType B10[lane];
+  alignas(32) DataType B01[lane];
+  alignas(32) DataType scale[lane];
+  alignas(32) DataType iyiz[lane];
+  alignas(32) DataType sum[nbatch];
+  std::array<int, nbatch> index;
+  DataType* const work[3] = {workx, worky, workz};
+
+  for (int j = 0; j < nscreen; j += nbatch) {
+    // the last batch is padded with the last quartet, whose duplicates are not written out
+    const int n = std::min(nbatch, nscreen - j);
+    for (int k = 0; k != nbatch; ++k)
+      index[k] = screening[j + std::min(k, n-1)];
+
+    for (int k = 0; k != nbatch; ++k) {
+      const int ii = index[k];
+      const double oxp2 = 0.5 / xp[ii];
+      const double oxq2 = 0.5 / xq[ii];
+      const double opq = 1.0 / (xp[ii] + xq[ii]);
+      const double xqopq = xq[ii] * opq;
+      const double xpopq = xp[ii] * opq;
+      for (int x = 0; x != 3; ++x) {
+        const DataType c00i0 = P[ii*3+x] - A[x];
+        const DataType c00i1 = (P[ii*3+x] - Q[ii*3+x]) * xqopq;
+        const DataType d00i0 = Q[ii*3+x] - C[x];
+        const DataType d00i1 = (P[ii*3+x] - Q[ii*3+x]) * xpopq;
+        for (int i = 0; i != rank_; ++i) {
+          C00[x][i*nbatch+k] = c00i0 - c00i1 * roots[ii*rank_+i];
+          D00[x][i*nbatch+k] = d00i0 + d00i1 * roots[ii*rank_+i];
+        }
+      }
+      for (int i = 0; i != rank_; ++i) {
+        const DataType tsq = roots[ii*rank_+i];
+        B00[i*nbatch+k] = 0.5 * opq * tsq;
+        B10[i*nbatch+k] = oxp2 - xqopq * oxp2 * tsq;
+        B01[i*nbatch+k] = oxq2 - xpopq * oxq2 * tsq;
+        scale[i*nbatch+k] = coeff[ii] * weights[ii*rank_+i];
+      }
+    }
+
+    for (int x = 0; x != 3; ++x)
+      vrr<amax_,cmax_,lane,DataType>(work[x], C00[x], D00[x], B00, B01, B10);
+    for (int of = 0; of != worksize; of += lane)
+      for (int i = 0; i != lane; ++i)
+        workx[of+i] *= scale[i];
+
+    for (int iz = 0; iz <= cmax_; ++iz) {
+      for (int iy = 0; iy <= cmax_ - iz; ++iy) {
+        const int iyz = cmax1_ * (iy + cmax1_ * iz);
+        for (int jz = 0; jz <= amax_; ++jz) {
+          const int offsetz = lane * (amax1_ * iz + jz);
+          for (int jy = 0; jy <= amax_ - jz; ++jy) {
+            const int offsety = lane * (amax1_ * iy + jy);
+            const int jyz = amax1_ * (jy + amax1_ * jz);
+            for (int i = 0; i != lane; ++i)
+              iyiz[i] = worky[offsety + i] * workz[offsetz + i];
+            for (int ix = std::max(0, cmin_ - iy - iz); ix <= cmax_ - iy - iz; ++ix) {
+              const int ipos_asize = cmap[ix + iyz] * asize_;
+              for (int jx = std::max(0, amin_ - jy - jz); jx <= amax_ - jy - jz; ++jx) {
+                const int offsetx = lane * (amax1_ * ix + jx);
+                const int ijposition = amap[jx + jyz] + ipos_asize;
+                for (int k = 0; k != nbatch; ++k)
+                  sum[k] = iyiz[k] * workx[offsetx + k];
+                for (int i = 1; i != rank_; ++i)
+                  for (int k = 0; k != nbatch; ++k)
+                    sum[k] += iyiz[i*nbatch + k] * workx[offsetx + i*nbatch + k];
+                for (int k = 0; k != n; ++k)
+                  out[index[k]*acsize + ijposition] = sum[k];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+
 }
 #endif
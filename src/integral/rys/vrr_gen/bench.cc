@@ -0,0 +1,133 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: bench.cc
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+// Benchmark of the batched VRR driver (vrr_driver_batch, used by the generated vrr.cc) against the per-quartet
+// driver (vrr_driver). Both are run on the same primitive quartets; the results are compared and the timings printed.
+// Not part of the build. From this directory:
+//   g++ -std=c++11 -O3 -march=native -I../../../.. -I../../../../btas -I<directory of bagel_config.h> bench.cc -o bench && ./bench
+
+#include <chrono>
+#include <functional>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <src/util/math/algo.h>
+#include <src/integral/rys/_vrr_drv.h>
+
+using namespace std;
+using namespace bagel;
+
+namespace {
+
+template<int a_, int b_, int c_, int d_, int rank_>
+void run(const int nprim, const int nrepeat) {
+  constexpr int amax1 = a_+b_+1;
+  constexpr int cmax1 = c_+d_+1;
+
+  // mapping from (x,y,z) to the position in the output; all the angular components between a_ and a_+b_ (c_ and c_+d_)
+  auto make_map = [](const int lmin, const int lmax, vector<int>& map) {
+    const int lmax1 = lmax+1;
+    map.assign(lmax1*lmax1*lmax1, -1);
+    int n = 0;
+    for (int z = 0; z <= lmax; ++z)
+      for (int y = 0; y <= lmax - z; ++y)
+        for (int x = max(0, lmin - y - z); x <= lmax - y - z; ++x)
+          map[x + lmax1*(y + lmax1*z)] = n++;
+    return n;
+  };
+  vector<int> amap, cmap;
+  const int asize = make_map(a_, a_+b_, amap);
+  const int csize = make_map(c_, c_+d_, cmap);
+  const int acsize = asize * csize;
+
+  mt19937 gen(11);
+  uniform_real_distribution<double> dist(0.1, 1.0);
+  const array<double,3> A{{0.0, 0.0, 0.0}}, B{{0.3, -0.5, 1.1}}, C{{1.2, 0.4, -0.7}}, D{{-0.6, 1.5, 0.2}};
+  vector<double> roots(nprim*rank_), weights(nprim*rank_), coeff(nprim), P(nprim*3), Q(nprim*3), xp(nprim), xq(nprim);
+  for (auto& i : roots) i = dist(gen);
+  for (auto& i : weights) i = dist(gen);
+  for (auto& i : coeff) i = dist(gen);
+  for (int i = 0; i != nprim; ++i) {
+    xp[i] = dist(gen) * 4.0;
+    xq[i] = dist(gen) * 4.0;
+    for (int x = 0; x != 3; ++x) {
+      P[i*3+x] = A[x] + (B[x] - A[x]) * dist(gen);
+      Q[i*3+x] = C[x] + (D[x] - C[x]) * dist(gen);
+    }
+  }
+  // every fifth quartet is screened out
+  vector<int> screening;
+  for (int i = 0; i != nprim; ++i)
+    if (i % 5 != 4) screening.push_back(i);
+  const int nscreen = screening.size();
+
+  const int worksize = amax1 * cmax1 * rank_ * vrr_batch_size;
+  vector<double> work(worksize*3);
+  vector<double> out0(nprim*acsize), out1(nprim*acsize);
+
+  auto time = [&nrepeat](function<void()> f) {
+    auto start = chrono::high_resolution_clock::now();
+    for (int i = 0; i != nrepeat; ++i) f();
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::high_resolution_clock::now() - start).count() * 1.0e-9;
+  };
+  const double t0 = time([&] {
+    for (int j = 0; j != nscreen; ++j) {
+      const int ii = screening[j];
+      vrr_driver<a_,b_,c_,d_,rank_,double>(out0.data()+ii*acsize, roots.data()+ii*rank_, weights.data()+ii*rank_, coeff[ii], A, B, C, D,
+                                          P.data()+ii*3, Q.data()+ii*3, xp[ii], xq[ii], amap.data(), cmap.data(), asize,
+                                          work.data(), work.data()+worksize, work.data()+worksize*2);
+    }
+  });
+  const double t1 = time([&] {
+    vrr_driver_batch<a_,b_,c_,d_,rank_,double>(out1.data(), acsize, screening.data(), nscreen, roots.data(), weights.data(), coeff.data(), A, C,
+                                              P.data(), Q.data(), xp.data(), xq.data(), amap.data(), cmap.data(), asize,
+                                              work.data(), work.data()+worksize, work.data()+worksize*2);
+  });
+
+  double error = 0.0, norm = 0.0;
+  for (size_t i = 0; i != out0.size(); ++i) {
+    error = max(error, fabs(out0[i] - out1[i]));
+    norm = max(norm, fabs(out0[i]));
+  }
+  cout << "  (" << a_ << b_ << "|" << c_ << d_ << ")  per-quartet " << fixed << setprecision(4) << setw(9) << t0
+       << "  batched " << setw(9) << t1 << "  speedup " << setprecision(2) << setw(5) << t0/t1
+       << "  rel. error " << scientific << setprecision(1) << error/norm << endl;
+}
+
+}
+
+int main() {
+  const int nprim = 37;
+  const int nrepeat = 20000;
+  run<1,0,1,0,2>(nprim, nrepeat);
+  run<2,1,1,0,3>(nprim, nrepeat);
+  run<2,2,2,0,4>(nprim, nrepeat);
+  run<3,0,3,0,4>(nprim, nrepeat);
+  run<3,2,3,1,5>(nprim, nrepeat/2);
+  run<4,4,4,4,9>(nprim, nrepeat/20);
+  return 0;
+}
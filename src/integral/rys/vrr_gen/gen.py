@@ -44,9 +44,10 @@ void ERIBatch::perform_VRR() {\n\
   const int c = basisinfo_[2]->angular_number();\n\
   const int d = basisinfo_[3]->angular_number();\n\
   const int isize = (amax_+1) * (cmax_+1);\n\
-  double* const workx = stack_->get(isize*rank_*3);\n\
-  double* const worky = workx + isize*rank_;\n\
-  double* const workz = worky + isize*rank_;\n\
+  const int worksize = isize*rank_*vrr_batch_size;\n\
+  double* const workx = stack_->get(worksize*3);\n\
+  double* const worky = workx + worksize;\n\
+  double* const workz = worky + worksize;\n\
   const int hashkey = (a << 24) + (b << 16) + (c << 8) + d;\n"
 
 for a in range(0,8):
@@ -67,12 +68,10 @@ for a in range(0,8):
 #ifdef COMPILE_J_ORB\n"
     ss += "\
   case " + str(key) + " :\n\
-    for (int j = 0; j != screening_size_; ++j) {\n\
-      int ii = screening_[j];\n\
-      vrr_driver<" + str(a) + "," + str(b) + "," + str(c) + "," +  str(d) + "," + str(rank) + ",double>(data_+ii*acsize, roots_+ii*rank_, weights_+ii*rank_, coeff_[ii],\n\
-                    basisinfo_[0]->position(), basisinfo_[1]->position(), basisinfo_[2]->position(), basisinfo_[3]->position(),\n\
-                    P_+ii*3, Q_+ii*3, xp_[ii], xq_[ii], amapping_, cmapping_, asize_, workx, worky, workz);\n\
-    } break;\n"
+    vrr_driver_batch<" + str(a) + "," + str(b) + "," + str(c) + "," +  str(d) + "," + str(rank) + ",double>(data_, acsize, screening_, screening_size_, roots_, weights_, coeff_,\n\
+                    basisinfo_[0]->position(), basisinfo_[2]->position(),\n\
+                    P_, Q_, xp_, xq_, amapping_, cmapping_, asize_, workx, worky, workz);\n\
+    break;\n"
     if a == 7 or c == 7 or c == 7 or d == 7:
      ss += "\
 #endif\n"
@@ -80,7 +79,7 @@ ss += "\
   default :\n\
     assert(false);   // hashkey not found\n\
   }\n\
-  stack_->release(rank_*isize*3, workx);\n\
+  stack_->release(worksize*3, workx);\n\
 \n\
 #endif\n\
 }"
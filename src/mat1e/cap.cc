@@ -42,9 +42,7 @@ void CAP::compute() {
   DefaultGrid grid(mol_);
 #endif
 
-  shared_ptr<const Matrix> ao = grid.grid()->basis();
   shared_ptr<const Matrix> gp = grid.grid()->data(); // x,y,z,weight
-  shared_ptr<Matrix> aow = ao->copy();
 
   const array<double,3> origin = mol_->charge_center();
   const array<double,3> size = mol_->cap();
@@ -55,18 +53,22 @@ void CAP::compute() {
     return ra < onset ? 0.0 : ra - onset;
   };
 
-  for (size_t i = 0; i != ao->mdim(); ++i) {
-    const double x = gp->element(0, i) - origin[0];
-    const double y = gp->element(1, i) - origin[1];
-    const double z = gp->element(2, i) - origin[2];
-    const double w = gp->element(3, i);
+  zero();
+  for (auto& block : grid.grid()->blocks()) {
+    shared_ptr<const Matrix> ao = block->basis();
+    shared_ptr<Matrix> aow = ao->copy();
+    for (size_t i = 0; i != block->size(); ++i) {
+      const double x = gp->element(0, block->point(i)) - origin[0];
+      const double y = gp->element(1, block->point(i)) - origin[1];
+      const double z = gp->element(2, block->point(i)) - origin[2];
+      const double w = gp->element(3, block->point(i));
 
-    // here we calculate the CAP amplitude at this grid point
-    // omega is set to one 
-    const double cap = pow(r(x, size[0]), 2) + pow(r(y, size[1]), 2) + pow(r(z, size[2]), 2);
-    blas::scale_n(cap * w, aow->element_ptr(0, i), aow->ndim());
+      // here we calculate the CAP amplitude at this grid point
+      // omega is set to one
+      const double cap = pow(r(x, size[0]), 2) + pow(r(y, size[1]), 2) + pow(r(z, size[2]), 2);
+      blas::scale_n(cap * w, aow->element_ptr(0, i), aow->ndim());
+    }
+    block->scatter_add(*ao ^ *aow, *this);
   }
-
-  *static_cast<Matrix*>(this) = *ao ^ *aow;
 }
 
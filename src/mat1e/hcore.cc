@@ -42,7 +42,9 @@ BOOST_CLASS_EXPORT_IMPLEMENT(Hcore)
 
 Hcore::Hcore(shared_ptr<const Molecule> mol, shared_ptr<const HcoreInfo> hcoreinfo) : Matrix1e(mol), hso_(make_shared<HSO>(mol->nbasis())) {
   if (hcoreinfo->standard() || hcoreinfo->ecp()) {
+    projection_ = make_shared<AngularProjectionCache>();
     init(mol);
+    projection_.reset();
     fill_upper();
   } else {
     auto hcore = hcoreinfo->compute(mol);
@@ -99,13 +101,13 @@ void Hcore::computebatch(const array<shared_ptr<const Shell>,2>& input, const in
       add_block(1.0, offsetb1, offsetb0, dimb1, dimb0, r2.data());
     }
     {
-      ECPBatch ecp(input, mol);
+      ECPBatch ecp(input, mol, projection_);
       ecp.compute();
 
       add_block(1.0, offsetb1, offsetb0, dimb1, dimb0, ecp.data());
     }
     {
-      SOECPBatch soecp(input, mol);
+      SOECPBatch soecp(input, mol, projection_);
       soecp.compute();
 
       hso_->construct_iaa(offsetb1, offsetb0, dimb1, dimb0, soecp.data());
@@ -29,12 +29,15 @@
 #include <src/wfn/hcoreinfo.h>
 #include <src/mat1e/matrix1e.h>
 #include <src/mat1e/hso.h>
+#include <src/integral/ecp/angularprojection.h>
 
 namespace bagel {
 
 class Hcore : public Matrix1e {
   protected:
     std::shared_ptr<HSO> hso_; // for spin-orbit ECP
+    // ECP angular projections shared by the shell pairs of one build; released once the matrix is formed
+    std::shared_ptr<AngularProjectionCache> projection_;
     void computebatch(const std::array<std::shared_ptr<const Shell>,2>&, const int, const int, std::shared_ptr<const Molecule>) override;
 
   private:
@@ -30,6 +30,7 @@
 #include <cassert>
 #include <cmath>
 #include <algorithm>
+#include <numeric>
 
 using namespace std;
 using namespace bagel;
@@ -44,6 +45,57 @@ static inline array<double,3> matmul33(const vector<double>& a, const array<doub
   return out;
 };
 
+namespace {
+  // atoms are equivalent when they carry the same charge and basis functions
+  bool equivalent(const Atom& a, const Atom& b) {
+    if (a.name() != b.name() || a.atom_charge() != b.atom_charge() || a.nshell() != b.nshell())
+      return false;
+    for (int i = 0; i != a.nshell(); ++i) {
+      const Shell& sa = *a.shells()[i];
+      const Shell& sb = *b.shells()[i];
+      if (sa.spherical() != sb.spherical() || sa.angular_number() != sb.angular_number() || sa.nbasis() != sb.nbasis()
+       || sa.exponents() != sb.exponents() || sa.contractions() != sb.contractions())
+        return false;
+    }
+    return true;
+  }
+
+  // returns the atom onto which atom i is mapped (-1 if none)
+  int image(const vector<shared_ptr<const Atom>>& atoms, const int i, const vector<double>& op, const double thresh) {
+    const array<double,3> target = matmul33(op, atoms[i]->position());
+    for (size_t j = 0; j != atoms.size(); ++j) {
+      const array<double,3>& current = atoms[j]->position();
+      if (fabs(current[0]-target[0]) <= thresh && fabs(current[1]-target[1]) <= thresh && fabs(current[2]-target[2]) <= thresh
+       && equivalent(*atoms[i], *atoms[j]))
+        return j;
+    }
+    return -1;
+  }
+
+  // parities of the basis functions in a shell (the order follows the integral codes)
+  vector<int> shell_parity(const Shell& s) {
+    const int l = s.angular_number();
+    vector<int> angular;
+    if (s.spherical()) {
+      for (int n = 0; n != 2*l+1; ++n) {
+        // |m| = l - n/2; odd n are sine-type (m < 0)
+        const int am = l - n/2;
+        const int sine = n % 2;
+        angular.push_back(((am - sine) & 1) + (sine << 1) + (((l - am) & 1) << 2));
+      }
+    } else {
+      for (int z = 0; z <= l; ++z)
+        for (int y = 0; y <= l - z; ++y)
+          angular.push_back(((l - y - z) & 1) + ((y & 1) << 1) + ((z & 1) << 2));
+    }
+    vector<int> out;
+    for (int i = 0; i != s.num_contracted(); ++i)
+      out.insert(out.end(), angular.begin(), angular.end());
+    return out;
+  }
+}
+
+
 Petite::Petite(const vector<shared_ptr<const Atom>>& atoms, const string sym) : sym_(sym) {
   const string c1("c1");
   const string cs("cs");
@@ -54,72 +106,88 @@ Petite::Petite(const vector<shared_ptr<const Atom>>& atoms, const string sym) :
   const string c2v("c2v");
   const string d2h("d2h");
 
+  if (sym == c1) {
+    symop_ = {{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0}};
+  } else if (sym == c2v) {
+    symop_ = SymC2v().symop();
+  } else if (sym == d2h) {
+    symop_ = SymD2h().symop();
+  } else if (sym == cs) {
+    symop_ = SymCs().symop();
+  } else if (sym == ci) {
+    symop_ = SymCi().symop();
+  } else if (sym == c2) {
+    symop_ = SymC2().symop();
+  } else if (sym == d2) {
+    symop_ = SymD2().symop();
+  } else if (sym == c2h) {
+    symop_ = SymC2h().symop();
+  } else {
+    assert(false);
+  }
+  init(atoms, 0.0);
+}
+
+
+Petite::Petite(const vector<shared_ptr<const Atom>>& atoms, const vector<vector<double>>& symop, const double thresh) : symop_(symop) {
+  assert(!symop_.empty());
+  // name of the group, determined by the number of the proper and improper rotations
+  int nproper = 0;
+  bool inversion = false;
+  for (auto& op : symop_) {
+    assert(op.size() == 9 && op[1] == 0.0 && op[2] == 0.0 && op[3] == 0.0 && op[5] == 0.0 && op[6] == 0.0 && op[7] == 0.0);
+    if (op[0]*op[4]*op[8] > 0.0) ++nproper;
+    if (op[0] < 0.0 && op[4] < 0.0 && op[8] < 0.0) inversion = true;
+  }
+  const int n = symop_.size();
+  if (n == 1)      sym_ = "c1";
+  else if (n == 2) sym_ = inversion ? "ci" : (nproper == 2 ? "c2" : "cs");
+  else if (n == 4) sym_ = inversion ? "c2h" : (nproper == 4 ? "d2" : "c2v");
+  else if (n == 8) sym_ = "d2h";
+  else throw logic_error("Petite constructor error: symmetry operations do not form a group");
+  init(atoms, thresh);
+}
+
+
+void Petite::init(const vector<shared_ptr<const Atom>>& atoms, const double thresh) {
   natom_ = atoms.size();
+  nsymop_ = symop_.size();
 
-  vector<shared_ptr<const Shell>> vbb;
   vector<int> offset;
   int cnt = 0;
+  int nbasis = 0;
   for (auto& a : atoms) {
-    vector<shared_ptr<const Shell>> tmp = a->shells();
-    vbb.insert(vbb.end(), tmp.begin(), tmp.end());
     offset.push_back(cnt);
-    cnt += tmp.size();
+    cnt += a->nshell();
+    for (auto& s : a->shells()) {
+      parity_.push_back(shell_parity(*s));
+      offset_.push_back(nbasis);
+      nbasis += s->nbasis();
+    }
   }
-  nshell_ = vbb.size();
+  nshell_ = cnt;
 
-  if (sym == c1) {
-    nirrep_ = 1;
-  } else {
-    if (sym == c2v){
-      SymC2v datc2v;
-      symop_ = datc2v.symop();
-      nirrep_ = datc2v.nirrep();
-    } else if (sym == d2h) {
-      SymD2h datd2h;
-      symop_ = datd2h.symop();
-      nirrep_ = datd2h.nirrep();
-    } else if (sym == cs) {
-      SymCs datcs;
-      symop_ = datcs.symop();
-      nirrep_ = datcs.nirrep();
-    } else if (sym == ci) {
-      SymCi datci;
-      symop_ = datci.symop();
-      nirrep_ = datci.nirrep();
-    } else if (sym == c2) {
-      SymC2 datc2;
-      symop_ = datc2.symop();
-      nirrep_ = datc2.nirrep();
-    } else if (sym == d2) {
-      SymD2 datd2;
-      symop_ = datd2.symop();
-      nirrep_ = datd2.nirrep();
-    } else if (sym == c2h) {
-      SymC2h datc2h;
-      symop_ = datc2h.symop();
-      nirrep_ = datc2h.nirrep();
-    } else {
-      assert(false);
-    }
-    nsymop_ = symop_.size();
+  // irreps are the distinct restrictions of the characters of D2h (labeled by the parities) onto this group
+  parity_irrep_.resize(8);
+  for (int p = 0; p != 8; ++p) {
+    vector<int> chi(nsymop_);
+    for (int iop = 0; iop != nsymop_; ++iop)
+      chi[iop] = sign(p, iop);
+    auto iter = find(character_.begin(), character_.end(), chi);
+    parity_irrep_[p] = iter - character_.begin();
+    if (iter == character_.end())
+      character_.push_back(chi);
+  }
+  nirrep_ = character_.size();
+  assert(nirrep_ == nsymop_);
 
+  if (nirrep_ > 1) {
     // making map for atoms
     for (int iatom = 0; iatom != natom_; ++iatom) {
-      const array<double,3> position = atoms[iatom]->position();
       vector<int> tmp(nsymop_);
-
       for (int iop = 0; iop != nsymop_; ++iop) {
-        const array<double,3> target = matmul33(symop_[iop], position);
-        bool found = false;
-        for (int jatom = 0; jatom != natom_; ++jatom) {
-          const array<double,3> current = atoms[jatom]->position();
-          if (current == target) {
-            found = true;
-            tmp[iop] = jatom;
-            break;
-          }
-        }
-        if (!found)
+        tmp[iop] = image(atoms, iatom, symop_[iop], thresh);
+        if (tmp[iop] < 0)
           throw logic_error("Petite constructor error");
       }
       sym_atommap_.push_back(tmp);
@@ -170,6 +238,96 @@ Petite::Petite(const vector<shared_ptr<const Atom>>& atoms, const string sym) :
 }
 
 
+vector<vector<double>> Petite::find_symop(const vector<vector<shared_ptr<const Atom>>>& atoms, const double thresh) {
+  vector<vector<double>> out;
+  for (auto& op : SymD2h().symop()) {
+    bool found = true;
+    for (auto& list : atoms)
+      for (size_t i = 0; found && i != list.size(); ++i)
+        found = image(list, i, op, thresh) >= 0;
+    if (found)
+      out.push_back(op);
+  }
+  return out;
+}
+
+
+vector<shared_ptr<const Matrix>> Petite::aotoso() const {
+  const int nbasis = offset_.empty() ? 0 : offset_.back() + parity_.back().size();
+  vector<vector<vector<double>>> columns(nirrep_);
+  for (int i = 0; i != nshell_; ++i) {
+    if (!in_p1(i)) continue;
+    for (size_t f = 0; f != parity_[i].size(); ++f) {
+      // projection of the function onto each irrep
+      for (int irrep = 0; irrep != nirrep_; ++irrep) {
+        vector<double> v(nbasis, 0.0);
+        for (int iop = 0; iop != nsymop_; ++iop) {
+          const int j = nirrep_ == 1 ? i : sym_shellmap_[i][iop];
+          v[offset_[j]+f] += character_[irrep][iop] * sign(parity_[i][f], iop);
+        }
+        const double norm = inner_product(v.begin(), v.end(), v.begin(), 0.0);
+        if (norm > 0.5) {
+          for (auto& k : v) k /= sqrt(norm);
+          columns[irrep].push_back(move(v));
+        }
+      }
+    }
+  }
+
+  vector<shared_ptr<const Matrix>> out;
+  for (auto& c : columns) {
+    auto mat = make_shared<Matrix>(nbasis, c.size(), true);
+    for (size_t j = 0; j != c.size(); ++j)
+      copy(c[j].begin(), c[j].end(), mat->element_ptr(0, j));
+    out.push_back(mat);
+  }
+  return out;
+}
+
+
+int Petite::product(const int a, const int b) const {
+  vector<int> chi(nsymop_);
+  for (int iop = 0; iop != nsymop_; ++iop)
+    chi[iop] = character_[a][iop] * character_[b][iop];
+  auto iter = find(character_.begin(), character_.end(), chi);
+  assert(iter != character_.end());
+  return iter - character_.begin();
+}
+
+
+int Petite::orbital_irrep(const double* coeff, const double thresh) const {
+  if (nirrep_ == 1)
+    return 0;
+  // each operation maps the orbital onto itself times its character (compared relative to the norm of the coefficients)
+  double norm = 0.0;
+  for (int i = 0; i != nshell_; ++i)
+    for (size_t f = 0; f != parity_[i].size(); ++f)
+      norm += coeff[offset_[i]+f] * coeff[offset_[i]+f];
+
+  vector<int> chi(nsymop_);
+  for (int iop = 0; iop != nsymop_; ++iop) {
+    double plus = 0.0;
+    double minus = 0.0;
+    for (int i = 0; i != nshell_; ++i) {
+      const int j = sym_shellmap_[i][iop];
+      for (size_t f = 0; f != parity_[i].size(); ++f) {
+        const double image = sign(parity_[i][f], iop) * coeff[offset_[i]+f];
+        plus  += pow(image - coeff[offset_[j]+f], 2);
+        minus += pow(image + coeff[offset_[j]+f], 2);
+      }
+    }
+    if (plus < thresh*norm)
+      chi[iop] = 1;
+    else if (minus < thresh*norm)
+      chi[iop] = -1;
+    else
+      return -1;
+  }
+  auto iter = find(character_.begin(), character_.end(), chi);
+  return iter == character_.end() ? -1 : iter - character_.begin();
+}
+
+
 Petite::~Petite() {
 
 }
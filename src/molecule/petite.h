@@ -28,6 +28,7 @@
 
 #include <tuple>
 #include <src/molecule/atom.h>
+#include <src/util/math/matrix.h>
 #include <src/util/serialization.h>
 
 namespace bagel {
@@ -47,6 +48,15 @@ class Petite {
     std::vector<int> p1_;
     std::vector<int> lambda_;
 
+    // parity (bit 0: x, bit 1: y, bit 2: z) of each basis function in each shell, and the offset of shells
+    std::vector<std::vector<int>> parity_;
+    std::vector<int> offset_;
+    // characters of the irreducible representations, and the irrep to which each parity belongs
+    std::vector<std::vector<int>> character_;
+    std::vector<int> parity_irrep_;
+
+    void init(const std::vector<std::shared_ptr<const Atom>>& atoms, const double thresh);
+
   private:
     // serialization
     friend class boost::serialization::access;
@@ -54,15 +64,22 @@ class Petite {
     template<class Archive>
     void serialize(Archive& ar, const unsigned int) {
       ar & natom_ & nshell_ & nirrep_ & nsymop_ & sym_ & symop_
-         & sym_atommap_ & sym_shellmap_ & p1_ & lambda_;
+         & sym_atommap_ & sym_shellmap_ & p1_ & lambda_ & parity_ & offset_ & character_ & parity_irrep_;
     }
 
   public:
     Petite() { }
     Petite(const std::vector<std::shared_ptr<const Atom>>&, const std::string);
+    // symmetry operations are given explicitly (diagonal matrices; e.g., those from find_symop)
+    Petite(const std::vector<std::shared_ptr<const Atom>>&, const std::vector<std::vector<double>>& symop, const double thresh = 1.0e-8);
     ~Petite();
 
+    // operations in D2h that map every atom in each list onto an equivalent atom (same element and basis)
+    static std::vector<std::vector<double>> find_symop(const std::vector<std::vector<std::shared_ptr<const Atom>>>& atoms, const double thresh = 1.0e-8);
+
     std::vector<double> symop(const int i) const { return symop_[i]; };
+    const std::vector<std::vector<double>>& symop() const { return symop_; }
+    const std::string& sym() const { return sym_; }
 
     std::vector<int> sym_shellmap(const int i) const { return sym_shellmap_[i]; };
     std::vector<int> sym_atommap(const int i) const { return sym_atommap_[i]; };
@@ -70,6 +87,22 @@ class Petite {
     int nirrep() const { return nirrep_; };
     int nsymop() const { return nsymop_; };
 
+    int shellmap(const int ishell, const int iop) const { return sym_shellmap_[ishell][iop]; }
+    const std::vector<int>& parity(const int ishell) const { return parity_[ishell]; }
+    // a basis function with the parity p is mapped by operation iop onto the equivalent function times this factor
+    int sign(const int p, const int iop) const {
+      return ((p & 1) && symop_[iop][0] < 0.0 ? -1 : 1) * ((p & 2) && symop_[iop][4] < 0.0 ? -1 : 1) * ((p & 4) && symop_[iop][8] < 0.0 ? -1 : 1);
+    }
+    int character(const int irrep, const int iop) const { return character_[irrep][iop]; }
+    int irrep(const int p) const { return parity_irrep_[p]; }
+    // irrep whose characters are the products of those of irreps a and b
+    int product(const int a, const int b) const;
+    // irrep of an orbital given by its AO coefficients; -1 if the orbital is not symmetry adapted
+    int orbital_irrep(const double* coeff, const double thresh = 1.0e-10) const;
+
+    // transformation from AOs to symmetry-adapted orbitals (nbasis x nso for each irrep)
+    std::vector<std::shared_ptr<const Matrix>> aotoso() const;
+
     bool in_p1(int i) const { return (nirrep_ == 1 || p1_[i]); };
     bool in_p2(int ij) const { return (nirrep_ == 1 || lambda_[ij]); };
     int  in_p4(int ij, int kl, int i, int j, int k, int l) const {
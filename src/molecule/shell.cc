@@ -219,6 +219,28 @@ void Shell::init_relativistic(const array<double,3> magnetic_field, bool london)
 }
 
 
+double Shell::grid_extent(const double thresh) const {
+  const int l = angular_number_;
+  double out = 0.0;
+  auto range = contraction_ranges_.begin();
+  for (auto& i : contractions_) {
+    const int nprim = range->second - range->first;
+    for (int j = range->first; j != range->second; ++j) {
+      const double a = exponents_[j];
+      const double c = fabs(i[j]) * nprim;
+      // |c| r^l (1 + 2ar) exp(-ar^2) bounds the function and its gradient, and decreases beyond sqrt((l+1)/2a)
+      const double step = 0.1 / sqrt(a);
+      double r = sqrt((l+1) / (2.0*a));
+      while (c * pow(r, l) * (1.0 + 2.0*a*r) * exp(-a*r*r) > thresh)
+        r += step;
+      out = max(out, r);
+    }
+    ++range;
+  }
+  return out;
+}
+
+
 // In DFT we want to compute values of basis functions on grid
 void Shell::compute_grid_value(double* b, double* dx, double* dy, double* dz, const double& x, const double& y, const double& z) const {
   const bool dogradient = dx != nullptr && dy != nullptr && dz != nullptr;
@@ -120,8 +120,12 @@ void CASSCF::common_init() {
   // nact from the input.
   nact_ = idata_->get<int>("nact", 0);
   // FCI algorithm
-  auto fci_algo = idata_->get<string>("fci_algorithm", ((nact_ > 9) && (mpi__->size() >= 8)) ? "parallel" : "knowles");
+  // the determinant space split by irreps ("symmetry") is only implemented in the Knowles-Handy algorithm
+  const bool symmetry = idata_->get<bool>("symmetry", false);
+  auto fci_algo = idata_->get<string>("fci_algorithm", ((nact_ > 9) && (mpi__->size() >= 8) && !symmetry) ? "parallel" : "knowles");
   fci_algorithm_ = make_shared<FCI_algorithms>(fci_algo);
+  if (symmetry && !fci_algorithm_->is_knowles())
+    throw runtime_error("CASSCF: \"symmetry\" is only available with the Knowles-Handy FCI algorithm");
 
   // nclosed from the input. If not present, full core space is generated.
   nclosed_ = idata_->get<int>("nclosed", -1);
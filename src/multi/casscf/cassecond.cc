@@ -239,35 +239,37 @@ shared_ptr<RotFile> CASSecond::compute_denom(shared_ptr<const DFHalfDist> half,
       for (int j = 0; j != nvirt_; ++j)
         denom->ele_va(j, i) += 2.0 * (*cfock)(j+nocc_, j+nocc_) * rdm1(i, i) - 2.0 * fcd(i, i);
 
-    const int nao = coeff_->ndim();
+    // (mn|D) v^D_ii for the diagonal elements of v. The AO integrals are streamed once (when they are kept on disk)
+    auto form_jop = [this](shared_ptr<const DFFullDist> v, const int n) {
+      shared_ptr<const DFBlock> blk = v->block(0);
+      vector<shared_ptr<const VectorB>> cd;
+      for (int i = 0; i != n; ++i) {
+        auto tmp = make_shared<VectorB>(v->naux());
+        copy_n(blk->data()+blk->asize()*(i+n*i), blk->asize(), tmp->data()+blk->astart());
+        cd.push_back(tmp);
+      }
+      return geom_->df()->compute_Jop_from_cd(cd);
+    };
     if (nclosed_) {
       auto vvc = half_1j->compute_second_transform(vcoeff)->form_4index_diagonal()->transpose();
       denom->ax_plus_y_vc(12.0, *vvc);
 
       shared_ptr<const DFFullDist> vgcc = half->compute_second_transform(ccoeff);
-      const int nri = vgcc->block(0)->asize();
-      Matrix tmp(nao, nao);
+      vector<shared_ptr<Matrix>> jop = form_jop(vgcc, nclosed_);
       for (int i = 0; i != nclosed_; ++i) {
-        dgemv_("T", nri, nao*nao, 1.0, geom_->df()->block(0)->data(), nri, vgcc->block(0)->data()+nri*(i+nclosed_*i), 1, 0.0, tmp.data(), 1);
-        if (!vgcc->serial())
-          tmp.allreduce();
-        Matrix tmp0 = vcoeff % tmp * vcoeff;
+        Matrix tmp0 = vcoeff % *jop[i] * vcoeff;
         blas::ax_plus_y_n(-4.0, tmp0.diag().data(), nvirt_, denom->ptr_vc()+nvirt_*i);
       }
     }
     shared_ptr<const DFFullDist> vaa  = halfa->compute_second_transform(acoeff);
-    const int nri = vaa->block(0)->asize();
     {
       shared_ptr<const DFFullDist> vgaa = vaa->apply_2rdm(*fci_->rdm2_av());
-      Matrix tmp(nao, nao);
+      vector<shared_ptr<Matrix>> jop = form_jop(vgaa, nact_);
       for (int i = 0; i != nact_; ++i) {
-        dgemv_("T", nri, nao*nao, 1.0, geom_->df()->block(0)->data(), nri, vgaa->block(0)->data()+nri*(i+nact_*i), 1, 0.0, tmp.data(), 1);
-        if (!vgaa->serial())
-          tmp.allreduce();
-        Matrix tmp0 = vcoeff % tmp * vcoeff;
+        Matrix tmp0 = vcoeff % *jop[i] * vcoeff;
         blas::ax_plus_y_n(2.0, tmp0.diag().data(), nvirt_, denom->ptr_va()+nvirt_*i);
         if (nclosed_) {
-          Matrix tmp1 = ccoeff % tmp * ccoeff;
+          Matrix tmp1 = ccoeff % *jop[i] * ccoeff;
           blas::ax_plus_y_n(2.0, tmp1.diag().data(), nclosed_, denom->ptr_ca()+nclosed_*i);
         }
       }
@@ -299,15 +301,12 @@ shared_ptr<RotFile> CASSecond::compute_denom(shared_ptr<const DFHalfDist> half,
       }
     }
     if (nclosed_) {
-      Matrix tmp(nao, nao);
       shared_ptr<DFFullDist> vgaa = vaa->copy();
       vgaa = vgaa->transform_occ1(make_shared<Matrix>(rdm1));
       vgaa->ax_plus_y(-1.0, vaa);
+      vector<shared_ptr<Matrix>> jop = form_jop(vgaa, nact_);
       for (int i = 0; i != nact_; ++i) {
-        dgemv_("T", nri, nao*nao, 1.0, geom_->df()->block(0)->data(), nri, vgaa->block(0)->data()+nri*(i+nact_*i), 1, 0.0, tmp.data(), 1);
-        if (!vgaa->serial())
-          tmp.allreduce();
-        Matrix tmp0 = ccoeff % tmp * ccoeff;
+        Matrix tmp0 = ccoeff % *jop[i] * ccoeff;
         blas::ax_plus_y_n(4.0, tmp0.diag().data(), nclosed_, denom->ptr_ca()+nclosed_*i);
       }
     }
@@ -442,7 +441,37 @@ void CASSecond::trans_natorb() {
   blas::ax_plus_y_n(-1.0, fci_->rdm1_av()->data(), nact_*nact_, trans->data());
 
   VectorB occup(nact_);
-  trans->diagonalize(occup);
+  const vector<int> irrep = fci_->orbital_irrep();
+  if (irrep.empty()) {
+    trans->diagonalize(occup);
+  } else {
+    // natural orbitals are formed within each irrep so that the active orbitals stay symmetry adapted
+    vector<pair<double, shared_ptr<const VectorB>>> natorb;
+    for (int g = 0; g != *max_element(irrep.begin(), irrep.end())+1; ++g) {
+      vector<int> orbitals;
+      for (int i = 0; i != nact_; ++i)
+        if (irrep[i] == g) orbitals.push_back(i);
+      if (orbitals.empty()) continue;
+      const int n = orbitals.size();
+      Matrix block(n, n);
+      for (int j = 0; j != n; ++j)
+        for (int i = 0; i != n; ++i)
+          block(i, j) = trans->element(orbitals[i], orbitals[j]);
+      VectorB eig(n);
+      block.diagonalize(eig);
+      for (int j = 0; j != n; ++j) {
+        auto vec = make_shared<VectorB>(nact_);
+        for (int i = 0; i != n; ++i)
+          (*vec)(orbitals[i]) = block(i, j);
+        natorb.emplace_back(eig(j), vec);
+      }
+    }
+    stable_sort(natorb.begin(), natorb.end(), [](const pair<double, shared_ptr<const VectorB>>& a, const pair<double, shared_ptr<const VectorB>>& b) { return a.first < b.first; });
+    for (int j = 0; j != nact_; ++j) {
+      occup(j) = natorb[j].first;
+      copy_n(natorb[j].second->data(), nact_, trans->element_ptr(0, j));
+    }
+  }
 
   if (natocc_) {
     cout << " " << endl;
@@ -26,7 +26,7 @@
 #include <src/scf/hf/rhf.h>
 #include <src/df/dfdistt.h>
 #include <src/pt2/mp2/mp2.h>
-#include <src/pt2/mp2/mp2cache.h>
+#include <src/pt2/mp2/mp2pairs.h>
 #include <src/util/f77.h>
 #include <src/util/taskqueue.h>
 #include <src/util/parallel/resources.h>
@@ -53,6 +53,24 @@ MP2::MP2(const shared_ptr<const PTree> input, const shared_ptr<const Geometry> g
   // if three is a aux_basis keyword, we use that basis
   abasis_ = to_lower(idata_->get<string>("aux_basis", ""));
 
+  sos_ = idata_->get<bool>("sos", false);
+  sos_scale_ = idata_->get<double>("sos_scale", 1.3);
+  laplace_ = to_lower(idata_->get<string>("laplace", "auto"));
+  laplace_thresh_ = idata_->get<double>("laplace_thresh", 1.0e-5);
+  prefetch_memory_ = idata_->get<double>("prefetch_memory", 0.0);
+  if (laplace_ != "auto" && laplace_ != "true" && laplace_ != "false")
+    throw runtime_error("laplace should be auto, true, or false");
+  if (sos_) cout << "    * SOS-MP2 with the opposite-spin scaling factor " << setprecision(3) << sos_scale_ << endl;
+
+}
+
+
+size_t MP2::prefetch_memory(const size_t minimum) const {
+  size_t out = prefetch_memory_ > 0.0 ? static_cast<size_t>(prefetch_memory_*1024*1024)
+                                      : resources__->available_memory() / (4*mpi__->node_size());
+  // the processes have to prefetch the same number of blocks
+  mpi__->broadcast(&out, 1, 0);
+  return max(out, minimum);
 }
 
 
@@ -87,7 +105,7 @@ void MP2::compute() {
       auto cgeom = make_shared<Geometry>(*geom_, info, false);
       half = cgeom->df()->compute_half_transform(ocoeff);
       // used later to determine the cache size
-      memory_size = cgeom->df()->block(0)->size();
+      memory_size = cgeom->df()->block_size();
       mpi__->broadcast(&memory_size, 1, 0);
     }
 
@@ -106,59 +124,95 @@ void MP2::compute() {
 
   cout << "    * 3-index integral transformation done" << endl;
 
-  // start communication (n fetch behind) - n is determined by memory size
-  MP2Cache cache(naux, nocc, nvirt, fullt);
-
-  const int nloop = cache.nloop();
-  const int ncache = min(memory_size/(nvirt*nvirt), size_t(20));
-  cout << "    * ncache = " << ncache << endl;
-  for (int n = 0; n != min(ncache, nloop); ++n)
-    cache.block(n, -1);
-
   // denominator info
   const vector<double> eig(ref_->eig().begin()+ncore_, ref_->eig().end());
 
-  // loop over tasks
-  energy_ = 0;
-  for (int n = 0; n != nloop; ++n) {
-    // take care of data. The communication should be hidden
-    if (n+ncache < nloop)
-      cache.block(n+ncache, n-1);
-
-    const int i = get<0>(cache.task(n));
-    const int j = get<1>(cache.task(n));
-    if (i < 0 || j < 0) continue;
-    cache.data_wait(n);
-
-    shared_ptr<const Matrix> iblock = cache(i);
-    shared_ptr<const Matrix> jblock = cache(j);
-    const Matrix mat(*iblock % *jblock);
-
-    // should thread
-    double en = 0.0;
-    for (int a = 0; a != nvirt; ++a) {
-      for (int b = a+1; b < nvirt; ++b) {
-        const double ab = mat(a, b);
-        const double ba = mat(b, a);
-        en += 2.0*(ba*ba + ab*ab - ba*ab) / (-eig[a+nocc]+eig[i]-eig[b+nocc]+eig[j]);
-      }
-      const double aa = mat(a, a);
-      en += aa*aa / (-eig[a+nocc]+eig[i]-eig[a+nocc]+eig[j]);
+  bool laplace = false;
+  if (sos_ && laplace_ != "false") {
+    // range of the denominators e_a + e_b - e_i - e_j
+    const double xmin = 2.0*(eig[nocc] - eig[nocc-1]);
+    const double xmax = 2.0*(eig.back() - eig.front());
+    LaplaceQuadrature quad(xmin, xmax, laplace_thresh_);
+    // operation counts of the two algorithms
+    const double laplace_cost = static_cast<double>(quad.size())*naux*naux*nocc*nvirt;
+    const double canonical_cost = 0.5*nocc*nocc*nvirt*nvirt*naux;
+    laplace = laplace_ == "true" || laplace_cost < canonical_cost;
+    if (laplace) {
+      cout << "    * Laplace transform with " << quad.size() << " quadrature points (max relative error "
+           << scientific << setprecision(2) << quad.error() << ")" << endl;
+      energy_ = compute_laplace(*fullt, quad, eig, nocc, nvirt);
     }
-    if (i != j) en *= 2.0;
-    energy_ += en;
   }
 
-  // just to double check that all the communition is done
-  cache.wait();
+  if (!laplace) {
+    // start communication (n fetch behind) - n is determined by memory size
+    MP2Cache cache(naux, nocc, nvirt, fullt);
+    MP2Pairs pairs(cache, prefetch_memory(memory_size*sizeof(double)));
+    cout << "    * ncache = " << pairs.ncache() << endl;
+
+    // pair energies are summed afterwards so that the result does not depend on the thread timing
+    vector<double> epair(nocc*nocc, 0.0);
+    if (sos_) {
+      pairs.run([&](const int i, const int j, const Matrix& mat) {
+        // opposite-spin part sum_ab V_ab^2 / (e_i + e_j - e_a - e_b)
+        Matrix tmp(mat);
+        MP2Pairs::denominator(i, j, tmp, eig.data(), nocc);
+        const double en = tmp.dot_product(mat);
+        epair[i*nocc+j] = i == j ? en : 2.0*en;
+      });
+    } else {
+      pairs.run([&](const int i, const int j, const Matrix& mat) {
+        epair[i*nocc+j] = MP2Pairs::energy(i, j, mat, eig.data(), nocc);
+      });
+    }
+    energy_ = accumulate(epair.begin(), epair.end(), 0.0);
+  }
+  if (sos_)
+    energy_ *= sos_scale_;
+
   // allreduce energy contributions
   mpi__->allreduce(&energy_, 1);
 
   cout << "    * assembly done" << endl << endl;
-  cout << "      MP2 correlation energy: " << fixed << setw(15) << setprecision(10) << energy_ << setw(10) << setprecision(2) << timer.tick() << endl << endl;
+  cout << "      " << (sos_ ? "SOS-" : "") << "MP2 correlation energy: " << fixed << setw(15) << setprecision(10) << energy_ << setw(10) << setprecision(2) << timer.tick() << endl << endl;
 
   energy_ += ref_->energy(0);
-  cout << "      MP2 total energy:       " << fixed << setw(15) << setprecision(10) << energy_ << endl << endl;
+  cout << "      " << (sos_ ? "SOS-" : "") << "MP2 total energy:       " << fixed << setw(15) << setprecision(10) << energy_ << endl << endl;
 }
 
 
+
+
+double MP2::compute_laplace(const DFDistT& fullt, const LaplaceQuadrature& quad, const vector<double>& eig, const size_t nocc, const size_t nvirt) const {
+  // E_os = -sum_q w_q sum_PQ Z_PQ^2 with Z_PQ = sum_ia B_ia^P B_ia^Q exp(-t_q (e_a - e_i)), which is O(N^4).
+  // Columns of fullt are compound indices a + nvirt*i and are distributed among the processes.
+  const size_t naux = fullt.naux();
+  const size_t bstart = fullt.bstart();
+  const size_t bsize = fullt.bsize();
+  const double* evirt = eig.data() + nocc;
+  // columns are processed in chunks to bound the memory of the scaled copy
+  const size_t chunk = min(bsize, max(static_cast<size_t>(1), static_cast<size_t>(1 << 24) / max(naux, static_cast<size_t>(1))));
+
+  Timer timer;
+  double energy = 0.0;
+  for (int q = 0; q != quad.size(); ++q) {
+    Matrix z(naux, naux, true);
+    for (size_t cstart = 0; cstart < bsize; cstart += chunk) {
+      const size_t csize = min(chunk, bsize - cstart);
+      Matrix bt(naux, csize, true);
+      copy_n(fullt.data() + naux*cstart, naux*csize, bt.data());
+      for (size_t c = 0; c != csize; ++c) {
+        const size_t ia = bstart + cstart + c;
+        const double x = evirt[ia%nvirt] - eig[ia/nvirt];
+        blas::scale_n(exp(-0.5*quad.t(q)*x), bt.element_ptr(0, c), naux);
+      }
+      dgemm_("N", "T", naux, naux, csize, 1.0, bt.data(), naux, bt.data(), naux, 1.0, z.data(), naux);
+    }
+    z.allreduce();
+    // the energy is allreduced by the caller
+    if (mpi__->rank() == 0)
+      energy -= quad.w(q) * z.dot_product(z);
+  }
+  timer.tick_print("Laplace quadrature");
+  return energy;
+}
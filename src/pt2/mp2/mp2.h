@@ -28,6 +28,8 @@
 
 #include <src/scf/hf/rhf.h>
 #include <src/wfn/method.h>
+#include <src/df/dfdistt.h>
+#include <src/util/math/laplace.h>
 
 namespace bagel {
 
@@ -40,6 +42,20 @@ class MP2 : public Method {
 
     double energy_;
 
+    // spin-component-scaled MP2 with the opposite-spin term only
+    bool sos_;
+    double sos_scale_;
+    // "auto", "true", or "false"; the Laplace-transformed O(N^4) algorithm is used for SOS-MP2 when it is cheaper
+    std::string laplace_;
+    double laplace_thresh_;
+
+    // memory (in MB per process) for prefetching the MO integrals; 0 means a quarter of the available memory of the node,
+    // divided by the number of processes on the node
+    double prefetch_memory_;
+
+    // opposite-spin correlation energy from the Laplace quadrature (local part; needs to be allreduced)
+    double compute_laplace(const DFDistT& fullt, const LaplaceQuadrature& quad, const std::vector<double>& eig, const size_t nocc, const size_t nvirt) const;
+
   public:
     MP2(const std::shared_ptr<const PTree>, const std::shared_ptr<const Geometry>, const std::shared_ptr<const Reference> = nullptr);
 
@@ -47,7 +63,10 @@ class MP2 : public Method {
     virtual std::shared_ptr<const Reference> conv_to_ref() const override { return ref_; }
 
     double energy() const { return energy_; }
+    // the prefetch budget in bytes (at least minimum), which is the same on all the processes
+    size_t prefetch_memory(const size_t minimum) const;
     int ncore() const { return ncore_; }
+    bool sos() const { return sos_; }
     std::string abasis() const { return abasis_; }
     std::shared_ptr<const RHF> scf() const { return scf_; }
 };
@@ -157,6 +157,20 @@ class MP2Cache_ {
     const std::vector<std::vector<std::tuple<int,int,MP2Tag<DataType>,MP2Tag<DataType>>>>& tasks() const { return tasks_; }
 
     int nloop() const { return nloop_; }
+    size_t naux() const { return naux_; }
+    size_t nocc() const { return nocc_; }
+    size_t nvirt() const { return nvirt_; }
+
+    // number of steps that are fetched ahead, such that the blocks in flight fit in the given memory (in bytes).
+    // Beyond a couple of rows of pairs there is nothing to gain. The value of the root process is used everywhere,
+    // since the bookkeeping of the cache on the other processes (cachetable_) relies on it.
+    int prefetch_depth(const size_t memory) const {
+      const size_t perstep = 2 * naux_ * nvirt_ * sizeof(DataType);
+      size_t depth = std::max(memory / perstep, size_t(1));
+      depth = std::min(std::min(depth, static_cast<size_t>(nloop_)), std::max(2*nocc_, size_t(20)));
+      mpi__->broadcast(&depth, 1, 0);
+      return depth;
+    }
 
     void block(const int nadd, const int ndrop) {
       assert(ndrop < nadd);
@@ -23,7 +23,7 @@
 //
 
 #include <src/pt2/mp2/mp2grad.h>
-#include <src/pt2/mp2/mp2cache.h>
+#include <src/pt2/mp2/mp2pairs.h>
 #include <src/pt2/mp2/mp2accum.h>
 #include <src/grad/cphf.h>
 #include <iostream>
@@ -39,7 +39,8 @@ using namespace bagel;
 using namespace btas;
 
 MP2Grad::MP2Grad(shared_ptr<const PTree> input, shared_ptr<const Geometry> g, shared_ptr<const Reference> ref) : MP2(input, g, ref) {
-
+  if (sos_)
+    throw runtime_error("SOS-MP2 gradients are not implemented");
 }
 
 
@@ -109,47 +110,30 @@ shared_ptr<GradFile> GradEval<MP2Grad>::compute(const string jobtitle, shared_pt
 
     size_t memory_size = half->block(0)->size() * 2;
     mpi__->broadcast(&memory_size, 1, 0);
-    const int nloop = cache.nloop();
-    const int ncache = min(memory_size/(nvirt*nvirt), size_t(20));
-    cout << "    * ncache = " << ncache << endl;
-    for (int n = 0; n != min(ncache, nloop); ++n)
-      cache.block(n, -1);
-
-    for (int n = 0; n != nloop; ++n) {
-      // take care of data. The communication should be hidden
-      if (n+ncache < nloop)
-        cache.block(n+ncache, n-1);
+    MP2Pairs pairs(cache, task_->prefetch_memory(memory_size*sizeof(double)));
+    cout << "    * ncache = " << pairs.ncache() << endl;
 
-      const int i = get<0>(cache.task(n));
-      const int j = get<1>(cache.task(n));
-      if (i < 0 || j < 0) continue;
-      cache.data_wait(n);
-
-      shared_ptr<const Matrix> iblock = cache(i);
-      shared_ptr<const Matrix> jblock = cache(j);
-      const Matrix mat(*iblock % *jblock); // V
+    vector<double> epair(nocc*nocc, 0.0);
+    mutex dmutex;
+    pairs.run([&](const int i, const int j, const Matrix& mat) { // V
       Matrix mat2 = mat; // 2T-T^t
       if (i != j) {
         mat2 *= 2.0;
         mat2 -= *mat.transpose();
       }
       Matrix mat3 = mat; // T
-
-      for (int a = 0; a != nvirt; ++a) {
-        for (int b = 0; b != nvirt; ++b) {
-          const double denom = -eig[a+nocc]+eig[i]-eig[b+nocc]+eig[j];
-          mat2(b,a) /= denom;
-          mat3(b,a) /= denom;
-        }
-      }
+      MP2Pairs::denominator(i, j, mat2, eig, nocc);
+      MP2Pairs::denominator(i, j, mat3, eig, nocc);
 
       const double fac = i == j ? 1.0 : 2.0;
-      ecorr += mat.dot_product(mat2) * fac;
-      dmp2->add_block(2.0, nocca, nocca, nvirt, nvirt, mat2 % mat3);
+      epair[i*nocc+j] = mat.dot_product(mat2) * fac;
+      Matrix d = mat2 % mat3;
       if (i != j)
-        dmp2->add_block(2.0, nocca, nocca, nvirt, nvirt, mat2 ^ mat3);
-    }
-    cache.wait();
+        d += mat2 ^ mat3;
+      lock_guard<mutex> lock(dmutex);
+      dmp2->add_block(2.0, nocca, nocca, nvirt, nvirt, d);
+    });
+    ecorr = accumulate(epair.begin(), epair.end(), 0.0);
     // allreduce energy contributions
     mpi__->allreduce(&ecorr, 1);
   }
@@ -170,7 +154,7 @@ shared_ptr<GradFile> GradEval<MP2Grad>::compute(const string jobtitle, shared_pt
     size_t memory_size = half->block(0)->size() * 2;
     mpi__->broadcast(&memory_size, 1, 0);
     const int nloop = cache.nloop();
-    const int ncache = min(memory_size/(nocc*nocc), size_t(30));
+    const int ncache = cache.prefetch_depth(task_->prefetch_memory(memory_size*sizeof(double)));
     cout << "    * ncache = " << ncache << endl;
     for (int n = 0; n != min(ncache, nloop); ++n)
       cache.block(n, -1);
@@ -0,0 +1,121 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: mp2pairs.cc
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#include <src/pt2/mp2/mp2pairs.h>
+
+using namespace std;
+using namespace bagel;
+
+void MP2Pairs::run(function<void(const int, const int, const Matrix&)> f) {
+
+  const int nloop = cache_.nloop();
+  const size_t naux = cache_.naux();
+  const size_t nvirt = cache_.nvirt();
+
+  for (int n = 0; n != min(ncache_, nloop); ++n)
+    cache_.block(n, -1);
+
+  for (int n0 = 0; n0 < nloop; n0 += nbatch_) {
+    const int n1 = min(n0+nbatch_, nloop);
+    for (int n = n0; n != n1; ++n)
+      cache_.data_wait(n);
+
+    // consecutive tasks share j; Vt = (bj|ai) for each of them is computed in one go
+    vector<tuple<int, int, shared_ptr<const Matrix>, int>> pairs;
+    for (int n = n0; n != n1; ) {
+      const int j = get<1>(cache_.task(n));
+      if (get<0>(cache_.task(n)) < 0 || j < 0) {
+        ++n;
+        continue;
+      }
+      vector<int> ilist;
+      for ( ; n != n1 && get<1>(cache_.task(n)) == j && get<0>(cache_.task(n)) >= 0; ++n)
+        ilist.push_back(get<0>(cache_.task(n)));
+
+      shared_ptr<const Matrix> jblock = cache_(j);
+      shared_ptr<const Matrix> vt;
+      if (ilist.size() == 1) {
+        vt = make_shared<const Matrix>(*jblock % *cache_(ilist.front()));
+      } else {
+        Matrix iblock(naux, nvirt*ilist.size(), true);
+        for (size_t k = 0; k != ilist.size(); ++k)
+          iblock.copy_block(0, k*nvirt, naux, nvirt, cache_(ilist[k]));
+        vt = make_shared<const Matrix>(*jblock % iblock);
+      }
+      for (size_t k = 0; k != ilist.size(); ++k)
+        pairs.push_back(make_tuple(ilist[k], j, vt, k*nvirt));
+    }
+
+    TaskQueue<function<void(void)>> tasks(pairs.size());
+    for (auto& p : pairs)
+      tasks.emplace_back(
+        [&f, &p, nvirt]() {
+          shared_ptr<const Matrix> v = get<2>(p)->get_submatrix(0, get<3>(p), nvirt, nvirt)->transpose();
+          f(get<0>(p), get<1>(p), *v);
+        }
+      );
+    tasks.compute();
+
+    for (int n = n0; n != n1; ++n)
+      if (n+ncache_ < nloop)
+        cache_.block(n+ncache_, n);
+  }
+
+  // just to double check that all the communition is done
+  cache_.wait();
+}
+
+
+double MP2Pairs::energy(const int i, const int j, const Matrix& v, const double* eig, const int nocc) {
+
+  const int nvirt = v.ndim();
+  const double* evirt = eig + nocc;
+  shared_ptr<const Matrix> vt = v.transpose();
+
+  double en = 0.0;
+  for (int b = 0; b != nvirt; ++b) {
+    const double* vb = v.element_ptr(0, b);
+    const double* tb = vt->element_ptr(0, b);
+    const double eijb = eig[i] + eig[j] - evirt[b];
+    double sum = 0.0;
+    for (int a = 0; a != nvirt; ++a)
+      sum += vb[a] * (2.0*vb[a] - tb[a]) / (eijb - evirt[a]);
+    en += sum;
+  }
+  return i == j ? en : 2.0*en;
+}
+
+
+void MP2Pairs::denominator(const int i, const int j, Matrix& v, const double* eig, const int nocc) {
+
+  const int nvirt = v.ndim();
+  const double* evirt = eig + nocc;
+  for (int b = 0; b != nvirt; ++b) {
+    double* vb = v.element_ptr(0, b);
+    const double eijb = eig[i] + eig[j] - evirt[b];
+    for (int a = 0; a != nvirt; ++a)
+      vb[a] /= eijb - evirt[a];
+  }
+}
@@ -0,0 +1,60 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: mp2pairs.h
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#ifndef __SRC_PT2_MP2_MP2PAIRS_H
+#define __SRC_PT2_MP2_MP2PAIRS_H
+
+#include <functional>
+#include <src/pt2/mp2/mp2cache.h>
+#include <src/util/taskqueue.h>
+
+namespace bagel {
+
+// Runs over the (i,j) pairs of MP2Cache in batches. The integral blocks V_ab = (ai|bj) of the pairs in a batch that share j
+// are formed by a single GEMM, and the pair function is then called in parallel. Blocks for later pairs are fetched meanwhile.
+class MP2Pairs {
+  protected:
+    MP2Cache& cache_;
+    const int ncache_;
+    const int nbatch_;
+
+  public:
+    MP2Pairs(MP2Cache& cache, const size_t memory)
+      : cache_(cache), ncache_(cache.prefetch_depth(memory)), nbatch_(std::min(ncache_, static_cast<int>(resources__->max_num_threads()))) { }
+
+    int ncache() const { return ncache_; }
+
+    // f(i, j, V) is called from multiple threads
+    void run(std::function<void(const int, const int, const Matrix&)> f);
+
+    // sum_ab V_ab (2 V_ab - V_ba) / (e_i + e_j - e_a - e_b), doubled when i != j. eig is occupied followed by virtual orbital energies
+    static double energy(const int i, const int j, const Matrix& v, const double* eig, const int nocc);
+    // divides V_ab by e_i + e_j - e_a - e_b in place
+    static void denominator(const int i, const int j, Matrix& v, const double* eig, const int nocc);
+};
+
+}
+
+#endif
@@ -84,6 +84,8 @@ void bagel::impl::run_bagel_(shared_ptr<const PTree> idata) {
     if (title.empty()) throw runtime_error("title is missing in one of the input blocks");
 
     if (title == "molecule") {
+      // collective; node-shared memory allocated before keeps its communicators
+      mpi__->set_shared_memory(itree->get<bool>("shared_memory", mpi__->shared_memory()));
       geom = geom ? make_shared<Geometry>(*geom, itree) : make_shared<Geometry>(itree);
       if (itree->get<bool>("restart", false))
         ref.reset();
@@ -146,7 +148,7 @@ void bagel::impl::run_bagel_(shared_ptr<const PTree> idata) {
 
     } else if (title == "save_ref") {
       const string name = itree->get<string>("file", "reference");
-      OArchive archive(name);
+      OArchive archive(name, name);
       archive << ref;
 #endif
     } else if (title == "dimerize") { // dimerize forms the dimer object, does a scf calculation, and then localizes
@@ -200,6 +202,8 @@ void bagel::impl::run_bagel_(shared_ptr<const PTree> idata) {
       }
       else if (localizemethod == "pm" || localizemethod == "pipek" || localizemethod == "mezey" || localizemethod == "pipek-mezey")
         localization = make_shared<PMLocalization>(itree, ref);
+      else if (localizemethod == "boys" || localizemethod == "foster-boys")
+        localization = make_shared<BoysLocalization>(itree, ref);
       else throw runtime_error("Unrecognized orbital localization method");
 
       shared_ptr<const Coeff> new_coeff = make_shared<const Coeff>(*localization->localize());
@@ -232,6 +236,7 @@ void bagel::impl::run_bagel_(shared_ptr<const PTree> idata) {
 
   }
 
+  Tracer::finalize();
   print_footer();
 }
 
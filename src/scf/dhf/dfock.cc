@@ -30,21 +30,44 @@ using namespace bagel;
 // TODO batch size should be automatically determined by the memory size etc.
 const static int batchsize = 250;
 
+namespace {
+  // time reversal of 4-component coefficients in the (L+, L-, S+, S-) blocks: (a, b) -> (-b^*, a^*) for L and S
+  shared_ptr<ZMatrix> time_reverse(const ZMatrix& c) {
+    const size_t n = c.ndim() / 4;
+    auto out = c.clone();
+    for (size_t i = 0; i != c.mdim(); ++i)
+      for (size_t k = 0; k != 4; k += 2) {
+        transform(c.element_ptr(n*(k+1), i), c.element_ptr(n*(k+2), i), out->element_ptr(n*k, i), [](const complex<double>& a) { return -conj(a); });
+        transform(c.element_ptr(n*k, i), c.element_ptr(n*(k+1), i), out->element_ptr(n*(k+1), i), [](const complex<double>& a) { return conj(a); });
+      }
+    return out;
+  }
+}
+
 DFock::DFock(shared_ptr<const Geometry> a,  shared_ptr<const ZMatrix> hc, const ZMatView coeff, const bool gaunt, const bool breit,
-             const bool store_half, const bool robust, const double scale_exch, const double scale_coulomb, const bool store_half_gaunt)
-  : ZMatrix(*hc), geom_(a), gaunt_(gaunt), breit_(breit), store_half_(store_half), store_half_gaunt_(store_half_gaunt), robust_(robust) {
+             const bool store_half, const bool robust, const double scale_exch, const double scale_coulomb, const bool store_half_gaunt, const bool kramers)
+  : ZMatrix(*hc), geom_(a), gaunt_(gaunt), breit_(breit), kramers_(kramers), store_half_(store_half), store_half_gaunt_(store_half_gaunt), robust_(robust) {
 
   assert(breit ? gaunt : true);
   two_electron_part(coeff, scale_exch, scale_coulomb);
 }
 
 
+// Constructing the Gaunt (and Breit) part only. Used in the incremental Fock build in Dirac.
+DFock::DFock(shared_ptr<const Geometry> a, shared_ptr<const ZMatrix> hc, shared_ptr<const ZMatrix> coeff, const bool breit, const bool robust, const double scale,
+             const bool kramers)
+  : ZMatrix(*hc), geom_(a), gaunt_(true), breit_(breit), kramers_(kramers), store_half_(false), store_half_gaunt_(false), robust_(robust) {
+
+  two_electron_part(*coeff, scale, scale, /*coulomb*/false);
+}
+
+
 // Constructing DFock from half-transformed integrals. It is assumed that int1 is multiplied by JJ, int2 is not multplied by J.
 // CAUTION! This only does Dirac-Coulomb
 DFock::DFock(shared_ptr<const Geometry> a, shared_ptr<const ZMatrix> hc, shared_ptr<const ZMatrix> coeff, shared_ptr<const ZMatrix> tcoeff,
              list<shared_ptr<const RelDFHalf>> int1c, list<shared_ptr<const RelDFHalf>> int2c,
              const double scale_exch, const double scale_coulomb)
-  : ZMatrix(*hc), geom_(a), gaunt_(false), breit_(false), store_half_(false), store_half_gaunt_(false), robust_(false) {
+  : ZMatrix(*hc), geom_(a), gaunt_(false), breit_(false), kramers_(false), store_half_(false), store_half_gaunt_(false), robust_(false) {
 
   // will use the zgemm3m-like algorithm
   for (auto& i : int1c)
@@ -64,27 +87,96 @@ DFock::DFock(shared_ptr<const Geometry> a, shared_ptr<const ZMatrix> hc, shared_
 }
 
 
-void DFock::two_electron_part(const ZMatView coeff, const double scale_exchange, const double scale_coulomb) {
+void DFock::two_electron_part(const ZMatView coeff, const double scale_exchange, const double scale_coulomb, const bool coulomb) {
 
   assert(geom_->nbasis()*4 == coeff.ndim());
 
   auto ocoeffall = make_shared<ZMatrix>(coeff);
   const int nocc = coeff.mdim();
-  const int nbatch = (nocc-1) / batchsize+1;
-  StaticDist dist(nocc, nbatch);
-  vector<pair<size_t, size_t>> table = dist.atable();
-
-  for (auto& itable : table) {
-    // slice of the coefficients
-    auto c = make_shared<ZMatrix>(ocoeffall->slice(itable.first, itable.first+itable.second));
-    driver(c, false, false, scale_exchange, scale_coulomb);
+
+  // Without a magnetic field, closed-shell orbitals come in Kramers pairs, and the half transforms of one orbital of each pair
+  // give those of the other. The stored half-transformed integrals have to be in the order of the input orbitals.
+  shared_ptr<const ZMatrix> kramers = kramers_ && !geom_->magnetism() && !store_half_ ? kramers_pairs(ocoeffall) : nullptr;
+
+  // slices of the coefficients; the two orbitals of a Kramers pair are in the same slice
+  vector<shared_ptr<const ZMatrix>> slices;
+  if (kramers) {
+    const int npair = nocc / 2;
+    const int nbatch = (npair-1) / (batchsize/2)+1;
+    StaticDist dist(npair, nbatch);
+    for (auto& itable : dist.atable()) {
+      auto c = make_shared<ZMatrix>(kramers->ndim(), itable.second*2);
+      c->copy_block(0,            0, c->ndim(), itable.second, kramers->slice(itable.first, itable.first+itable.second));
+      c->copy_block(0, itable.second, c->ndim(), itable.second, kramers->slice(npair+itable.first, npair+itable.first+itable.second));
+      slices.push_back(c);
+    }
+  } else {
+    const int nbatch = (nocc-1) / batchsize+1;
+    StaticDist dist(nocc, nbatch);
+    for (auto& itable : dist.atable())
+      slices.push_back(make_shared<ZMatrix>(ocoeffall->slice(itable.first, itable.first+itable.second)));
+  }
+
+  for (auto& c : slices) {
+    if (coulomb)
+      driver(c, false, false, scale_exchange, scale_coulomb, !!kramers);
     if (gaunt_) {
-      driver(c, gaunt_, breit_, scale_exchange, scale_coulomb);
+      driver(c, gaunt_, breit_, scale_exchange, scale_coulomb, !!kramers);
     }
   }
 }
 
 
+// The time reversal K maps C x onto C m x^* with m = (C^+ C)^-1 C^+ K C when the span of C is closed under K. Orbitals A = C X are then
+// chosen one at a time from what is orthogonal to the previous pairs, so that [X, m X^*] is unitary and [A, KA] = C [X, m X^*].
+shared_ptr<const ZMatrix> DFock::kramers_pairs(shared_ptr<const ZMatrix> coeff, const double thresh) {
+  const int nocc = coeff->mdim();
+  if (nocc == 0 || nocc % 2 != 0)
+    return nullptr;
+
+  shared_ptr<const ZMatrix> kcoeff = time_reverse(*coeff);
+
+  ZMatrix metric(*coeff % *coeff);
+  VectorB eig(nocc);
+  metric.diagonalize(eig);
+  if (eig(0) < thresh * eig(nocc-1))
+    return nullptr;
+  ZMatrix scaled(metric);
+  for (int i = 0; i != nocc; ++i)
+    blas::scale_n(1.0/eig(i), scaled.element_ptr(0, i), nocc);
+  const ZMatrix m((scaled ^ metric) * (*coeff % *kcoeff));
+
+  if ((*kcoeff - *coeff * m).rms() > thresh * kcoeff->rms())
+    return nullptr;
+
+  const int npair = nocc / 2;
+  ZMatrix proj(nocc, nocc);
+  proj.unit();
+  ZMatrix rot(nocc, nocc);
+  for (int p = 0; p != npair; ++p) {
+    // the column of the projector with the largest norm
+    int imax = 0;
+    for (int i = 1; i != nocc; ++i)
+      if (proj(i, i).real() > proj(imax, imax).real())
+        imax = i;
+    const double norm = proj(imax, imax).real();
+    if (norm < thresh)
+      return nullptr;
+
+    ZMatrix x(nocc, 1);
+    transform(proj.element_ptr(0, imax), proj.element_ptr(0, imax+1), x.data(), [&norm](const complex<double>& a) { return a / std::sqrt(norm); });
+    const ZMatrix y(m * *x.get_conjg());
+    rot.copy_block(0,       p, nocc, 1, x);
+    rot.copy_block(0, npair+p, nocc, 1, y);
+    proj -= (x ^ x) + (y ^ y);
+  }
+
+  if (!(rot % rot).is_identity(thresh))
+    return nullptr;
+  return make_shared<const ZMatrix>(*coeff * rot);
+}
+
+
 void DFock::add_Jop_block(shared_ptr<const RelDF> dfdata, list<shared_ptr<const RelCDMatrix>> cd, const double scale) {
 
   const int n = geom_->nbasis();
@@ -173,33 +265,68 @@ list<shared_ptr<RelDF>> DFock::make_dfdists(vector<shared_ptr<const DFDist>> dfs
 }
 
 
-list<shared_ptr<RelDFHalf>> DFock::make_half_complex(list<shared_ptr<RelDF>> dfdists, shared_ptr<const ZMatrix> coeff) {
+list<shared_ptr<RelDFHalf>> DFock::make_half_complex(list<shared_ptr<RelDF>> dfdists, shared_ptr<const ZMatrix> coeff, const bool skip_zero, const bool kramers) {
   // Separate Coefficients into real and imaginary
   array<shared_ptr<const Matrix>,4> rcoeff;
   array<shared_ptr<const Matrix>,4> icoeff;
   assert(coeff->ndim() % 4 == 0);
+  assert(!kramers || coeff->mdim() % 2 == 0);
   const size_t nbasis = coeff->ndim() / 4;
+  // with Kramers pairs [A, KA], only A is transformed
+  const int ntrans = kramers ? coeff->mdim()/2 : coeff->mdim();
   for (int i = 0; i != 4; ++i) {
-    shared_ptr<const ZMatrix> oc = coeff->get_submatrix(i*nbasis, 0, nbasis, coeff->mdim());
+    shared_ptr<const ZMatrix> oc = coeff->get_submatrix(i*nbasis, 0, nbasis, ntrans);
     rcoeff[i] = oc->get_real_part();
     icoeff[i] = oc->get_imag_part();
+    // blocks that are exactly zero (e.g., purely real or purely imaginary components) are not transformed
+    if (skip_zero) {
+      if (rcoeff[i]->rms() == 0.0) rcoeff[i].reset();
+      if (icoeff[i]->rms() == 0.0) icoeff[i].reset();
+    }
   }
 
   list<shared_ptr<RelDFHalf>> half_complex;
-  for (auto& i : dfdists) {
-    vector<shared_ptr<RelDFHalf>> dat = i->compute_half_transform(rcoeff, icoeff);
-    half_complex.insert(half_complex.end(), dat.begin(), dat.end());
-
-    if (i->not_diagonal()) {
-      vector<shared_ptr<RelDFHalf>> dat = i->swap()->compute_half_transform(rcoeff, icoeff);
+  auto transform = [&](shared_ptr<const RelDF> df) {
+    vector<shared_ptr<RelDFHalf>> dat = df->compute_half_transform(rcoeff, icoeff);
+    if (!kramers) {
       half_complex.insert(half_complex.end(), dat.begin(), dat.end());
+      return;
+    }
+    assert(!df->get_imag());
+    // the partners of the orbitals in component k are given by those in component k^1 (L+ <-> L-, S+ <-> S-)
+    array<shared_ptr<RelDFHalf>,4> half;
+    for (auto& i : dat)
+      half[i->basis().front()->basis(0)] = i;
+    for (int k = 0; k != 4; ++k) {
+      shared_ptr<const RelDFHalf> partner = half[k^1];
+      if (!half[k] && !partner)
+        continue;
+      vector<shared_ptr<const SpinorInfo>> bas;
+      for (auto& j : df->basis())
+        if (j->basis(0) == k)
+          bas.push_back(j);
+      if (bas.empty())
+        continue;
+      shared_ptr<RelDFHalf> first = half[k] ? half[k]
+                                            : make_shared<RelDFHalf>(array<shared_ptr<DFHalfDist>,2>{{partner->get_real()->clone(), partner->get_imag()->clone()}},
+                                                                     df->cartesian(), bas);
+      shared_ptr<RelDFHalf> second = partner ? partner->time_reversal(bas, k % 2 == 0 ? -1.0 : 1.0)
+                                             : make_shared<RelDFHalf>(array<shared_ptr<DFHalfDist>,2>{{first->get_real()->clone(), first->get_imag()->clone()}},
+                                                                      df->cartesian(), bas);
+      half_complex.push_back(first->merge_b1(second));
     }
+  };
+
+  for (auto& i : dfdists) {
+    transform(i);
+    if (i->not_diagonal())
+      transform(i->swap());
   }
   return half_complex;
 }
 
 
-void DFock::driver(shared_ptr<const ZMatrix> coeff, bool gaunt, bool breit, const double scale_exchange, const double scale_coulomb)  {
+void DFock::driver(shared_ptr<const ZMatrix> coeff, bool gaunt, bool breit, const double scale_exchange, const double scale_coulomb, const bool kramers)  {
 
   Timer timer(0);
 
@@ -214,7 +341,8 @@ void DFock::driver(shared_ptr<const ZMatrix> coeff, bool gaunt, bool breit, cons
 
   list<shared_ptr<RelDF>> dfdists = make_dfdists(dfs, gaunt);
   // Note that we are NOT using dagger-ed coefficients! -1 factor for imaginary will be compensated by RelCDMatrix and Exop
-  list<shared_ptr<RelDFHalf>> half_complex = make_half_complex(dfdists, coeff);
+  // Zero blocks of the coefficients are skipped unless all of the half-transformed integrals are needed later (Breit and gradients)
+  list<shared_ptr<RelDFHalf>> half_complex = make_half_complex(dfdists, coeff, kramers_ && !breit && !store_half_, kramers);
 
   const string printtag = !gaunt ? "Coulomb" : "Gaunt";
   timer.tick_print(printtag + ": half trans");
@@ -235,8 +363,8 @@ void DFock::driver(shared_ptr<const ZMatrix> coeff, bool gaunt, bool breit, cons
   }
   half_complex.clear();
 
-  assert(gaunt  || half_complex_exch.size() == 8);
-  assert(!gaunt || half_complex_exch.size() == 24);
+  assert(gaunt  || half_complex_exch.size() <= 8);
+  assert(!gaunt || half_complex_exch.size() <= 24);
 
   if (breit) {
 
@@ -361,11 +489,14 @@ void DFock::build_j(list<shared_ptr<const RelDFHalf>> dummy, list<shared_ptr<con
   const double gscale = gaunt ? (breit ? -0.5 : -1.0) : 1.0;
 
   if (scale_coulomb != 0.0) {
+    // null if the block is zero (only when kramers_ is set)
     array<shared_ptr<const Matrix>,4> trocoeff, tiocoeff;
     for (int i = 0; i != 4; ++i) {
       shared_ptr<const ZMatrix> c = coeff->cut(i*geom_->nbasis(), (i+1)*geom_->nbasis());
-      trocoeff[i] = c->get_real_part()->transpose();
-      tiocoeff[i] = c->get_imag_part()->transpose();
+      shared_ptr<const Matrix> r = c->get_real_part();
+      shared_ptr<const Matrix> im = c->get_imag_part();
+      if (!kramers_ || r->rms() != 0.0)  trocoeff[i] = r->transpose();
+      if (!kramers_ || im->rms() != 0.0) tiocoeff[i] = im->transpose();
     }
 
     vector<shared_ptr<const DFDist>> dfs;
@@ -382,9 +513,11 @@ void DFock::build_j(list<shared_ptr<const RelDFHalf>> dummy, list<shared_ptr<con
     // compute J operators
     for (auto& j : half_complex_exch2)
       for (auto& i : j->basis())
-        cd.push_back(make_shared<RelCDMatrix>(j, i, trocoeff, tiocoeff, geom_->df()->data2(), number_of_j));
-    for (auto& i : dfdists)
-      add_Jop_block(i, cd, gscale);
+        if (trocoeff[i->basis(1)] || tiocoeff[i->basis(1)])
+          cd.push_back(make_shared<RelCDMatrix>(j, i, trocoeff, tiocoeff, geom_->df()->data2(), number_of_j));
+    if (!cd.empty())
+      for (auto& i : dfdists)
+        add_Jop_block(i, cd, gscale);
     timer.tick_print(printtag + ": J operator");
   }
 }
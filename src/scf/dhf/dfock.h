@@ -35,13 +35,16 @@ class DFock : public ZMatrix {
     std::shared_ptr<const Geometry> geom_;
     const bool gaunt_;
     const bool breit_;
+    // if true, closed-shell orbitals are half transformed as Kramers pairs and zero blocks of the coefficients are skipped
+    const bool kramers_;
 
-    void two_electron_part(const ZMatView coeff, const double scale_ex, const double scale_coulomb);
+    void two_electron_part(const ZMatView coeff, const double scale_ex, const double scale_coulomb, const bool coulomb = true);
 
 
     void add_Jop_block(std::shared_ptr<const RelDF>, std::list<std::shared_ptr<const RelCDMatrix>>, const double scale);
     void add_Exop_block(std::shared_ptr<const RelDFHalf>, std::shared_ptr<const RelDFHalf>, const double scale, const bool diag = false);
-    void driver(std::shared_ptr<const ZMatrix> coeff, bool gaunt, bool breit, const double scale_exchange, const double scale_coulomb);
+    // if kramers is true, coeff is [A, KA] (see kramers_pairs)
+    void driver(std::shared_ptr<const ZMatrix> coeff, bool gaunt, bool breit, const double scale_exchange, const double scale_coulomb, const bool kramers = false);
 
     // when gradient is requested, we store half-transformed integrals
     // TODO want to avoid "mutable" but this lets us discard integrals later to free up memory
@@ -56,12 +59,17 @@ class DFock : public ZMatrix {
 
   public:
     DFock(std::shared_ptr<const Geometry> a,  std::shared_ptr<const ZMatrix> hc, const ZMatView coeff, const bool gaunt, const bool breit,
-          const bool store_half, const bool robust = false, const double scale_exch = 1.0, const double scale_coulomb = 1.0, const bool store_half_gaunt = false);
+          const bool store_half, const bool robust = false, const double scale_exch = 1.0, const double scale_coulomb = 1.0, const bool store_half_gaunt = false,
+          const bool kramers = false);
     // same as above
     DFock(std::shared_ptr<const Geometry> a, std::shared_ptr<const ZMatrix> hc, std::shared_ptr<const ZMatrix> coeff, const bool gaunt, const bool breit,
-          const bool store_half, const bool robust = false, const double scale_exch = 1.0, const double scale_coulomb = 1.0, const bool store_half_gaunt = false)
-     : DFock(a, hc, *coeff, gaunt, breit, store_half, robust, scale_exch, scale_coulomb, store_half_gaunt) {
+          const bool store_half, const bool robust = false, const double scale_exch = 1.0, const double scale_coulomb = 1.0, const bool store_half_gaunt = false,
+          const bool kramers = false)
+     : DFock(a, hc, *coeff, gaunt, breit, store_half, robust, scale_exch, scale_coulomb, store_half_gaunt, kramers) {
     }
+    // Gaunt (and Breit) part only (added to hc), scaled by scale
+    DFock(std::shared_ptr<const Geometry> a, std::shared_ptr<const ZMatrix> hc, std::shared_ptr<const ZMatrix> coeff, const bool breit, const bool robust,
+          const double scale, const bool kramers = false);
     // DFock from half-transformed integrals
     DFock(std::shared_ptr<const Geometry> a, std::shared_ptr<const ZMatrix> hc, std::shared_ptr<const ZMatrix> coeff, std::shared_ptr<const ZMatrix> tcoeff,
           std::list<std::shared_ptr<const RelDFHalf>> int1c, std::list<std::shared_ptr<const RelDFHalf>> int2c,
@@ -81,7 +89,12 @@ class DFock : public ZMatrix {
         }
     }
     static std::list<std::shared_ptr<RelDF>> make_dfdists(std::vector<std::shared_ptr<const DFDist>>, bool);
-    static std::list<std::shared_ptr<RelDFHalf>> make_half_complex(std::list<std::shared_ptr<RelDF>>, std::shared_ptr<const ZMatrix>);
+    // if kramers is true, only the first half of the coefficients is transformed and the rest is obtained by time reversal
+    static std::list<std::shared_ptr<RelDFHalf>> make_half_complex(std::list<std::shared_ptr<RelDF>>, std::shared_ptr<const ZMatrix>, const bool skip_zero = false,
+                                                                    const bool kramers = false);
+    // rotates the occupied orbitals into Kramers pairs [A, KA] with the same density matrix (K is time reversal);
+    // returns nullptr if the orbitals do not span a space that is closed under time reversal
+    static std::shared_ptr<const ZMatrix> kramers_pairs(std::shared_ptr<const ZMatrix> coeff, const double thresh = 1.0e-10);
 
     std::list<std::shared_ptr<RelDFHalf>> half_coulomb() const { assert(store_half_); return half_coulomb_; }
     std::list<std::shared_ptr<RelDFHalf>> half_gaunt() const { assert(store_half_gaunt_); return half_gaunt_; }
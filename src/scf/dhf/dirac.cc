@@ -102,6 +102,12 @@ void Dirac::common_init(const shared_ptr<const PTree> idata) {
   assert(s12_->mdim() % 2 == 0);
 
   if (breit_ && !gaunt_) throw runtime_error("Breit cannot be turned on if Gaunt is off");
+
+  kramers_ = idata->get<bool>("kramers_fock", false);
+  gaunt_incremental_ = idata->get<bool>("gaunt_incremental", false);
+  thresh_incremental_ = idata->get<double>("thresh_incremental", 1.0e-8);
+  incremental_reset_ = idata->get<int>("incremental_reset", 10);
+  nincremental_ = 0;
 }
 
 
@@ -126,11 +132,19 @@ void Dirac::compute() {
   cout << indent << "=== Dirac RHF iteration (" + geom_->basisfile() + ", " << (geom_->magnetism() ? "RMB" : "RKB") << ") ===" << endl << indent << endl;
 
   DIIS<DistZMatrix, ZMatrix> diis(5);
+  gaunt_fock_.reset();
 
   for (int iter = 0; iter != max_iter_; ++iter) {
     Timer ptime(1);
 
-    auto fock = make_shared<DFock>(geom_, hcore_, coeff->matrix()->slice_copy(nneg_, nele_+nneg_), gaunt_, breit_, do_grad_, robust_);
+    shared_ptr<const ZMatrix> ocoeff = coeff->matrix()->slice_copy(nneg_, nele_+nneg_);
+    shared_ptr<DFock> fock;
+    if (gaunt_ && gaunt_incremental_) {
+      fock = make_shared<DFock>(geom_, hcore_, ocoeff, false, false, do_grad_, robust_, 1.0, 1.0, false, kramers_);
+      *fock += *gaunt_part(ocoeff);
+    } else {
+      fock = make_shared<DFock>(geom_, hcore_, ocoeff, gaunt_, breit_, do_grad_, robust_, 1.0, 1.0, false, kramers_);
+    }
     shared_ptr<const DistZMatrix> distfock = fock->distmatrix();
 
     // compute energy here
@@ -241,6 +255,57 @@ shared_ptr<const Reference> Dirac::conv_to_ref() const {
 }
 
 
+shared_ptr<const ZMatrix> Dirac::gaunt_part(shared_ptr<const ZMatrix> ocoeff) {
+  auto zero = make_shared<const ZMatrix>(ocoeff->ndim(), ocoeff->ndim());
+  auto density = make_shared<ZMatrix>(*ocoeff ^ *ocoeff);
+
+  // The change in the density matrix is written as C+ C+^dagger - C- C-^dagger using its eigenvectors. Eigenvalues smaller than
+  // thresh_incremental_ are neglected. Since gaunt_density_ keeps track of the density used so far, they are carried over to the next iteration.
+  if (gaunt_fock_ && nincremental_ < incremental_reset_) {
+    ZMatrix ddensity(*density - *gaunt_density_);
+    VectorB eig(ddensity.ndim());
+    ddensity.diagonalize(eig);
+
+    vector<int> pos, neg;
+    for (int i = 0; i != eig.size(); ++i) {
+      if (eig(i) > thresh_incremental_)
+        pos.push_back(i);
+      else if (eig(i) < -thresh_incremental_)
+        neg.push_back(i);
+    }
+
+    // only when it is cheaper than the full build
+    if (pos.size() + neg.size() < ocoeff->mdim()) {
+      auto dcoeff = [&](const vector<int>& index) {
+        auto out = make_shared<ZMatrix>(ddensity.ndim(), index.size());
+        for (int i = 0; i != index.size(); ++i) {
+          const double fac = sqrt(fabs(eig(index[i])));
+          transform(ddensity.element_ptr(0, index[i]), ddensity.element_ptr(0, index[i]+1), out->element_ptr(0, i), [&fac](const complex<double>& a) { return a*fac; });
+        }
+        return out;
+      };
+      if (!pos.empty()) {
+        shared_ptr<const ZMatrix> c = dcoeff(pos);
+        *gaunt_fock_ += DFock(geom_, zero, c, breit_, robust_, 1.0, kramers_);
+        *gaunt_density_ += *c ^ *c;
+      }
+      if (!neg.empty()) {
+        shared_ptr<const ZMatrix> c = dcoeff(neg);
+        *gaunt_fock_ += DFock(geom_, zero, c, breit_, robust_, -1.0, kramers_);
+        *gaunt_density_ -= *c ^ *c;
+      }
+      ++nincremental_;
+      return gaunt_fock_;
+    }
+  }
+
+  gaunt_fock_ = make_shared<DFock>(geom_, zero, ocoeff, breit_, robust_, 1.0, kramers_);
+  gaunt_density_ = density;
+  nincremental_ = 0;
+  return gaunt_fock_;
+}
+
+
 shared_ptr<const DistZMatrix> Dirac::initial_guess(const shared_ptr<const DistZMatrix> s12, const shared_ptr<const DistZMatrix> hcore) const {
   const int n = geom_->nbasis();
   VectorB eig(hcore->ndim());
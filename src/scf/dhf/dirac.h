@@ -51,6 +51,17 @@ class Dirac : public Method {
 
     // for Fock build
     bool robust_;
+    // Kramers pairs and zero blocks in the half transformation (see DFock)
+    bool kramers_;
+
+    // the Gaunt and Breit terms are updated using the change in the density matrix
+    bool gaunt_incremental_;
+    double thresh_incremental_;
+    int incremental_reset_;
+    int nincremental_;
+    std::shared_ptr<ZMatrix> gaunt_fock_;
+    std::shared_ptr<ZMatrix> gaunt_density_;
+    std::shared_ptr<const ZMatrix> gaunt_part(std::shared_ptr<const ZMatrix> ocoeff);
 
     int multipole_print_;
     bool conv_ignore_;
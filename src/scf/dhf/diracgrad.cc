@@ -324,8 +324,7 @@ shared_ptr<GradFile> GradEval<Dirac>::compute(const string jobtitle, shared_ptr<
   }
 
   // compute
-  TaskQueue<shared_ptr<GradTask>> tq(move(task));
-  tq.compute();
+  compute_tasks(move(task));
 
   // adds nuclear contributions
   *grad_ += *geom_->compute_grad_vnuc();
@@ -87,6 +87,9 @@ void Box::init() {
   nmult_ = (lmax_ + 1) * (lmax_ + 1);
   olm_ = make_shared<ZVectorB>(nmult_);
   mlm_ = make_shared<ZVectorB>(nmult_);
+  m2l_lmax_ = -1;
+  m2l_.clear();
+  m2l_k_.clear();
 
   nshell0_ = 0;
   int cnt = 0;
@@ -339,15 +342,83 @@ void Box::compute_L2L() {
 }
 
 
+void Box::build_M2L(const int lmax) {
+
+  if (!cache_m2l_ || lmax <= m2l_lmax_) return;
+
+  m2l_.resize(ninter_);
+  for (int i = 0; i != ninter_; ++i)
+    m2l_[i] = compute_M2L_factor(i, lmax);
+  m2l_lmax_ = lmax;
+}
+
+
+shared_ptr<const ZVectorB> Box::compute_M2L_factor(const int i, const int lmax) const {
+
+  // T(a, b) = (-1)^b P_a^|b|(cos theta) (a-|b|)! / r^(a+1) exp(i b phi), stored at a*a+a+b
+  const int amax = 2*lmax;
+  shared_ptr<const Box> it = inter_[i].lock();
+  const array<double, 3> r12 = {{centre_[0] - it->centre(0), centre_[1] - it->centre(1), centre_[2] - it->centre(2)}};
+  const double r = sqrt(r12[0]*r12[0] + r12[1]*r12[1] + r12[2]*r12[2]);
+  const double ctheta = (r > numerical_zero__) ? r12[2]/r : 0.0;
+  const double phi = atan2(r12[1], r12[0]);
+
+  auto m2l = make_shared<ZVectorB>((amax+1)*(amax+1));
+  for (int a = 0; a <= amax; ++a) {
+    const double rr = 1.0 / pow(r, a + 1);
+    for (int b = -a; b <= a; ++b) {
+      const double sign = (b >= 0) ? 1.0 : (1-((b&1)<<1));
+      const double prefactor = sign * plm.compute(a, abs(b), ctheta) * rr * f(a-abs(b));
+      (*m2l)(a*a+a+b) = complex<double>(prefactor*cos(b*phi), prefactor*sin(b*phi));
+    }
+  }
+  return m2l;
+}
+
+
+void Box::compress_M2L_X() {
+
+  // the uncompressed operators are only kept if they are cached for J anyway
+  const int nmult_k = (lmax_k_+1)*(lmax_k_+1);
+  m2l_k_.resize(ninter_);
+  for (int i = 0; i != ninter_; ++i) {
+    shared_ptr<const ZVectorB> m2l = lmax_k_ <= m2l_lmax_ ? m2l_[i] : compute_M2L_factor(i, lmax_k_);
+    shared_ptr<ZMatrix> lmjk = form_M2L(lmax_k_, *m2l);
+    VectorB sing(nmult_k);
+    shared_ptr<ZMatrix> u, vt;
+    tie(u, vt) = lmjk->svd(sing.data());
+
+    int rank = 1;
+    while (rank < nmult_k && sing(rank) > m2l_thresh_k_*sing(0))
+      ++rank;
+
+    // two thin products only pay off below half the rank; otherwise the square operator is kept
+    if (2*rank >= nmult_k) {
+      m2l_k_[i] = make_pair(lmjk, nullptr);
+      continue;
+    }
+    shared_ptr<ZMatrix> a = u->slice_copy(0, rank);
+    for (int j = 0; j != rank; ++j)
+      blas::scale_n(sing(j), a->element_ptr(0, j), nmult_k);
+    m2l_k_[i] = make_pair(a, vt->get_submatrix(0, 0, rank, nmult_k));
+  }
+}
+
+
 void Box::compute_M2L_X() {
 
   mlm_ji_ = olm_ji_->clone();
+  // the compressed operators are a cache themselves, and are not used when the operators are formed on the fly
+  const bool compress = m2l_thresh_k_ > 0.0 && cache_m2l_;
+  if (compress && m2l_k_.empty())
+    compress_M2L_X();
+  else if (!compress)
+    build_M2L(lmax_k_);
 
   // from interaction list
   for (int i = 0; i != ninter_; ++i) {
     shared_ptr<const Box> it = inter_[i].lock();
-    const array<double, 3> r12 = {{centre_[0] - it->centre(0), centre_[1] - it->centre(1), centre_[2] - it->centre(2)}};
-    shared_ptr<const ZMatrix> slocal = shift_localMX(lmax_k_, it->olm_ji(), r12);
+    shared_ptr<const ZMatrix> slocal = compress ? shift_localMX(it->olm_ji(), m2l_k_[i]) : shift_localMX(lmax_k_, it->olm_ji(), *m2l_op(i, lmax_k_));
     blas::ax_plus_y_n(1.0, slocal->data(), mlm_ji_->size(), mlm_ji_->data());
   }
 }
@@ -356,16 +427,26 @@ void Box::compute_M2L_X() {
 void Box::compute_M2L() {
 
   mlm_->fill(0.0);
-  // from interaction list
+  build_M2L(lmax_);
+
+  // from interaction list; the translation is applied directly to the multipole vector
   for (int i = 0; i != ninter_; ++i) {
     shared_ptr<const Box> it = inter_[i].lock();
-    const array<double, 3> r12 = {{centre_[0] - it->centre(0), centre_[1] - it->centre(1), centre_[2] - it->centre(2)}};
-    auto imultipole = make_shared<ZMatrix>(1, nmult_);
-    copy_n(it->olm()->data(), nmult_, imultipole->data());
-    shared_ptr<const ZMatrix> tmp = shift_localMX(lmax_, imultipole, r12);
-    auto slocal = make_shared<ZVectorB>(nmult_);
-    copy_n(tmp->data(), nmult_, slocal->data());
-    blas::ax_plus_y_n(1.0, slocal->data(), nmult_, mlm_->data());
+    const complex<double>* olm = it->olm()->data();
+    shared_ptr<const ZVectorB> op = m2l_op(i, lmax_);
+    const complex<double>* m2l = op->data();
+    for (int l = 0; l <= lmax_; ++l) {
+      const double phase_l = (1-((l&1)<<1));
+      for (int m = 0; m <= 2 * l; ++m) {
+        complex<double> sum = 0.0;
+        for (int j = 0; j <= lmax_; ++j) {
+          const int a = l + j;
+          for (int k = 0; k <= 2 * j; ++k)
+            sum += m2l[a*a+a+m-l+k-j] * olm[j*j+k];
+        }
+        (*mlm_)(l*l+m) += phase_l * sum;
+      }
+    }
   }
 }
 
@@ -801,42 +882,61 @@ shared_ptr<const ZMatrix> Box::shift_localLX(const int lmax, const shared_ptr<co
 }
 
 
-// M2L for X
-shared_ptr<const ZMatrix> Box::shift_localMX(const int lmax, shared_ptr<const ZMatrix> olm, array<double, 3> r12) const {
+// M2L operator in the matrix form, (lm|jk)
+shared_ptr<ZMatrix> Box::form_M2L(const int lmax, const ZVectorB& m2l) const {
 
-  const double r = sqrt(r12[0]*r12[0] + r12[1]*r12[1] + r12[2]*r12[2]);
-  const double ctheta = (r > numerical_zero__) ? r12[2]/r : 0.0;
-  const double phi = atan2(r12[1], r12[0]);
+  // m2l is either cached (up to m2l_lmax_) or formed on the fly for this lmax
+  assert(m2l.size() >= static_cast<size_t>((2*lmax+1)*(2*lmax+1)));
   const int nmult = (lmax+1)*(lmax+1);
-  const int olm_size_block = olm->ndim();
-
-  shared_ptr<ZMatrix> mb = olm->clone();
-  unique_ptr<double[]> plm0(new double[(2*lmax+1)*(2*lmax+1)]);
-  for (int l = 0; l != 2*lmax+1; ++l)
-    for (int m = 0; m <= 2 * l; ++m) {
-      const int b = m-l;
-      const double sign = (b >= 0) ? 1.0 : (1-((b&1)<<1));
-      plm0[l*l+m] = sign * plm.compute(l, abs(b), ctheta);
-    }
-
-  ZMatrix lmjk(nmult, nmult);
+  auto lmjk = make_shared<ZMatrix>(nmult, nmult, true);
   for (int l = 0; l <= lmax; ++l) {
     const double phase_l = (1-((l&1)<<1));
     for (int j = 0; j <= lmax; ++j) {
       const int a = l + j;
-      const double rr = 1.0 / pow(r, a + 1);
       for (int m = 0; m <= 2 * l; ++m) {
         for (int k = 0; k <= 2 * j; ++k) {
           const int b = m - l + k - j;
-          double prefactor = plm0[a*a+a+b] * rr * f(a-abs(b));
-          const complex<double> Mab = phase_l * polar(prefactor, b*phi);
-          lmjk.element(l*l+m, j*j+k) = Mab;
+          lmjk->element(l*l+m, j*j+k) = phase_l * m2l(a*a+a+b);
         }
       }
     }
   }
+  return lmjk;
+}
+
+
+// M2L for X
+shared_ptr<const ZMatrix> Box::shift_localMX(const int lmax, shared_ptr<const ZMatrix> olm, const ZVectorB& m2l) const {
 
-  zgemm_("N", "T", olm_size_block, nmult, nmult, 1.0, olm->data(), olm_size_block, lmjk.data(), nmult, 0.0, mb->data(), olm_size_block);
+  const int nmult = (lmax+1)*(lmax+1);
+  const int olm_size_block = olm->ndim();
+
+  shared_ptr<ZMatrix> mb = olm->clone();
+  shared_ptr<const ZMatrix> lmjk = form_M2L(lmax, m2l);
+
+  zgemm_("N", "T", olm_size_block, nmult, nmult, 1.0, olm->data(), olm_size_block, lmjk->data(), nmult, 0.0, mb->data(), olm_size_block);
+  return mb;
+}
+
+
+// M2L for X with the compressed operator: olm (AB)^T = (olm B^T) A^T, or olm A^T when B is null (not truncated)
+shared_ptr<const ZMatrix> Box::shift_localMX(shared_ptr<const ZMatrix> olm, const pair<shared_ptr<const ZMatrix>, shared_ptr<const ZMatrix>>& m2l) const {
+
+  const int nmult = m2l.first->ndim();
+  const int rank = m2l.first->mdim();
+  const int olm_size_block = olm->ndim();
+
+  if (!m2l.second) {
+    shared_ptr<ZMatrix> mb = olm->clone();
+    zgemm_("N", "T", olm_size_block, nmult, nmult, 1.0, olm->data(), olm_size_block, m2l.first->data(), nmult, 0.0, mb->data(), olm_size_block);
+    return mb;
+  }
+
+  ZMatrix tmp(olm_size_block, rank, true);
+  zgemm_("N", "T", olm_size_block, rank, nmult, 1.0, olm->data(), olm_size_block, m2l.second->data(), rank, 0.0, tmp.data(), olm_size_block);
+
+  shared_ptr<ZMatrix> mb = olm->clone();
+  zgemm_("N", "T", olm_size_block, nmult, rank, 1.0, tmp.data(), olm_size_block, m2l.first->data(), nmult, 0.0, mb->data(), olm_size_block);
   return mb;
 }
 
@@ -70,6 +70,23 @@ class Box {
     std::shared_ptr<ZVectorB> olm_;
     std::shared_ptr<ZVectorB> mlm_;
 
+    // M2L translation operators from the boxes in inter_. They only depend on the box centres, which are fixed
+    // during SCF iterations, so they are computed once and kept in the factored form T(a, b) with a <= 2*m2l_lmax_.
+    // When cache_m2l_ is false (set by FMM when the cache would exceed its memory limit), they are formed on the fly.
+    bool cache_m2l_;
+    int m2l_lmax_;
+    std::vector<std::shared_ptr<const ZVectorB>> m2l_;
+    void build_M2L(const int lmax);
+    std::shared_ptr<const ZVectorB> compute_M2L_factor(const int i, const int lmax) const;
+    std::shared_ptr<const ZVectorB> m2l_op(const int i, const int lmax) const { return cache_m2l_ ? m2l_[i] : compute_M2L_factor(i, lmax); }
+
+    // optional low-rank form of the FMM-K translation operators, M2L = A B, truncated at the relative singular value
+    // m2l_thresh_k_ (0 means uncompressed). Operators that keep half their rank or more are stored as (M2L, nullptr)
+    double m2l_thresh_k_;
+    std::vector<std::pair<std::shared_ptr<const ZMatrix>, std::shared_ptr<const ZMatrix>>> m2l_k_;
+    void compress_M2L_X();
+    std::shared_ptr<ZMatrix> form_M2L(const int lmax, const ZVectorB& m2l) const;
+
     void compute_M2M(std::shared_ptr<const Matrix> density);
     void compute_M2M_X(std::shared_ptr<const Matrix> ocoeff_sj, std::shared_ptr<const Matrix> ocoeff_ui);
     void compute_M2L();
@@ -78,7 +95,9 @@ class Box {
     void compute_L2L_X();
     std::shared_ptr<const ZMatrix> shift_multipolesX(const int lmax, std::shared_ptr<const ZMatrix> oa, std::array<double, 3> rab) const;
     std::shared_ptr<const ZMatrix> shift_localLX(const int lmax, std::shared_ptr<const ZMatrix> mr, std::array<double, 3> rb) const;
-    std::shared_ptr<const ZMatrix> shift_localMX(const int lmax, std::shared_ptr<const ZMatrix> olm, std::array<double, 3> r12) const;
+    std::shared_ptr<const ZMatrix> shift_localMX(const int lmax, std::shared_ptr<const ZMatrix> olm, const ZVectorB& m2l) const;
+    std::shared_ptr<const ZMatrix> shift_localMX(std::shared_ptr<const ZMatrix> olm,
+                                                 const std::pair<std::shared_ptr<const ZMatrix>, std::shared_ptr<const ZMatrix>>& m2l) const;
 
     std::shared_ptr<const Matrix> compute_exact_ff(std::shared_ptr<const Matrix> density) const; //debug
     std::shared_ptr<const Matrix> compute_Fock_nf(std::shared_ptr<const Matrix> density, std::shared_ptr<const VectorB> max_den) const;
@@ -93,7 +112,8 @@ class Box {
     Box(int n, double size, const std::array<double, 3>& c, const int id, const std::array<int, 3>& v, const int lmax = 10,
         const int lmax_k = 10, const std::vector<std::shared_ptr<const ShellPair>>& sp = std::vector<std::shared_ptr<const ShellPair>>(),
         const double schwarz = 0.0)
-     : rank_(n), boxsize_(size), centre_(c), boxid_(id), tvec_(v), lmax_(lmax), lmax_k_(lmax_k), sp_(sp), schwarz_thresh_(schwarz) { }
+     : rank_(n), boxsize_(size), centre_(c), boxid_(id), tvec_(v), lmax_(lmax), lmax_k_(lmax_k), sp_(sp), schwarz_thresh_(schwarz),
+       cache_m2l_(true), m2l_thresh_k_(0.0) { }
 
     ~Box() { }
 
@@ -61,6 +61,8 @@ FMM::FMM(std::shared_ptr<const PTree> idata, shared_ptr<const Geometry> geom, co
   centre_ = geom->charge_center();
   nbasis_ = geom->nbasis();
   thresh_ = geom->schwarz_thresh();
+  compress_thresh_k_ = idata->get<bool>("compress_exchange", false) ? idata->get<double>("compress_thresh_exchange", 1.0e-4) : 0.0;
+  m2l_memory_ = idata->get<double>("m2l_cache_memory", 1024.0);
   init();
 }
 
@@ -220,8 +222,10 @@ void FMM::get_boxes() {
   assert(accumulate(nbranch_.begin(), nbranch_.end(), 0) == nbox);
   nbox_ = nbox;
 
-  for (auto& b : box_)
+  for (auto& b : box_) {
+    b->m2l_thresh_k_ = compress_thresh_k_;
     b->init();
+  }
 
   int icnt = 0;
   for (int ir = ns_; ir > -1; --ir) {
@@ -237,11 +241,30 @@ void FMM::get_boxes() {
     icnt += nbranch_[ir];
   }
 
+  // the M2L operators are cached in the boxes unless they exceed m2l_memory_. The compressed FMM-K operators
+  // replace the full ones at lmax_k_; they never take more than one (lmax_k_+1)^2 square matrix
+  const bool compress = do_exchange_ && compress_thresh_k_ > 0.0;
+  const int lcache = do_exchange_ && !compress ? max(lmax_, lmax_k_) : lmax_;
+  size_t ncache = 0;
+  for (auto& b : box_)
+    ncache += b->ninter_;
+  double cache_size = pow(2*lcache+1, 2);
+  if (compress)
+    cache_size += pow(lmax_k_+1, 4);
+  const double cache_memory = ncache * cache_size * sizeof(complex<double>) / (1024.0*1024.0);
+  if (cache_memory > m2l_memory_) {
+    cout << "    * M2L operators (" << setprecision(1) << fixed << cache_memory << " MB) exceed m2l_cache_memory and are formed on the fly" << endl;
+    for (auto& b : box_)
+      b->cache_m2l_ = false;
+  }
+
+  partition();
+
   if (debug_) {
     cout << "Centre of Charge: " << setprecision(3) << centre_[0] << "  " << centre_[1] << "  " << centre_[2] << endl;
     cout << "ns_ = " << ns_ << " nbox = " << nbox_ << "  nleaf = " << nleaf << " nsp = " << nsp_ << " ws = " << ws_ << " lmaxJ " << lmax_;
     if (do_exchange_)
-      cout << " *** BATCHSIZE " << xbatchsize_ << " lmax_k " << lmax_k_;
+      cout << " *** BATCHSIZE " << xbatchsize_ << " lmax_k " << lmax_k_ << " compression " << compress_thresh_k_;
     cout << " boxsize = " << boxsize_ << " leafsize = " << unitsize_ << endl;
     int i = 0;
     for (auto& b : box_) {
@@ -256,7 +279,7 @@ void FMM::get_boxes() {
         shared_ptr<const Box> inter = b->inter_[j].lock();
         nsp_inter += inter->nsp_;
       }
-      cout << i << " rank = " << b->rank() << "  boxsize = " << b->boxsize() << " extent = " << b->extent() << " nsp = " << b->nsp_
+      cout << i << " rank = " << b->rank() << " owner = " << owner_[i] << "  boxsize = " << b->boxsize() << " extent = " << b->extent() << " nsp = " << b->nsp_
            << " nchild = " << b->nchild_ << " nneigh = " << b->nneigh_ << " nsp " << nsp_neigh
            << " ninter = " << b->ninter_ << " nsp " << nsp_inter
            << " centre = " << b->centre(0) << " " << b->centre(1) << " " << b->centre(2)
@@ -269,22 +292,73 @@ void FMM::get_boxes() {
 }
 
 
+void FMM::partition() {
+
+  // boxes at each level are ordered along the Morton (Z-order) curve of their indices and divided into
+  // contiguous pieces with similar numbers of shell pairs, so that each process handles a compact region.
+  auto morton = [](const array<int, 3>& v) {
+    uint64_t key = 0;
+    for (int b = 0; b != 21; ++b)
+      for (int i = 0; i != 3; ++i)
+        key |= static_cast<uint64_t>((v[i] >> b) & 1) << (3*b+i);
+    return key;
+  };
+
+  owner_.resize(nbox_);
+  int offset = 0;
+  for (int ir = 0; ir != ns_+1; ++ir) {
+    vector<pair<uint64_t, int>> keys;
+    double total = 0.0;
+    for (int i = offset; i != offset+nbranch_[ir]; ++i) {
+      keys.push_back(make_pair(morton(box_[i]->tvec()), i));
+      total += box_[i]->nsp_;
+    }
+    sort(keys.begin(), keys.end());
+    // levels without shell pairs are split by the number of boxes
+    const bool uniform = total == 0.0;
+    if (uniform)
+      total = keys.size();
+
+    double done = 0.0;
+    for (auto& k : keys) {
+      const double weight = uniform ? 1.0 : box_[k.second]->nsp_;
+      owner_[k.second] = min(mpi__->size()-1, static_cast<int>((done + 0.5*weight) / total * mpi__->size()));
+      done += weight;
+    }
+    offset += nbranch_[ir];
+  }
+}
+
+
 void FMM::M2M(shared_ptr<const Matrix> density, const bool dox) const {
 
   Timer m2mtime;
+  const int nmult = (lmax_+1)*(lmax_+1);
+
+  // leaves are computed by their owners and summed in a single reduction
+  ZMatrix olm(nmult, nbranch_[0], true);
   for (int i = 0; i != nbranch_[0]; ++i)
-    if (i % mpi__->size() == mpi__->rank())
+    if (owner_[i] == mpi__->rank()) {
       box_[i]->compute_M2M(density);
-
+      copy_n(box_[i]->olm()->data(), nmult, olm.element_ptr(0, i));
+    }
+  mpi__->allreduce(olm.data(), olm.size());
   for (int i = 0; i != nbranch_[0]; ++i)
-    mpi__->broadcast(box_[i]->olm()->data(), box_[i]->olm()->size(), i % mpi__->size());
+    copy_n(olm.element_ptr(0, i), nmult, box_[i]->olm()->data());
 
   m2mtime.tick_print("Compute multipoles");
 
+  // boxes in the same level are independent of each other
   int icnt = nbranch_[0];
   for (int i = 1; i != ns_+1; ++i) {
-    for (int j = 0; j != nbranch_[i]; ++j, ++icnt)
-      box_[icnt]->compute_M2M(density);
+    TaskQueue<function<void(void)>> tasks(nbranch_[i]);
+    for (int j = 0; j != nbranch_[i]; ++j, ++icnt) {
+      shared_ptr<Box> b = box_[icnt];
+      tasks.emplace_back(
+        [b, &density]() { b->compute_M2M(density); }
+      );
+    }
+    tasks.compute();
   }
   m2mtime.tick_print("M2M pass");
   assert(icnt == nbox_);
@@ -295,12 +369,21 @@ void FMM::M2M_X(shared_ptr<const Matrix> ocoeff_sj, shared_ptr<const Matrix> oco
 
   Timer m2mtime;
 
-  int icnt = 0;
-  for (int i = 0; i != ns_+1; ++i) {
+  // leaves are threaded internally
+  for (int i = 0; i != nbranch_[0]; ++i)
+    box_[i]->compute_M2M_X(ocoeff_sj, ocoeff_ui);
+
+  int icnt = nbranch_[0];
+  for (int i = 1; i != ns_+1; ++i) {
+    TaskQueue<function<void(void)>> tasks(nbranch_[i]);
     for (int j = 0; j != nbranch_[i]; ++j, ++icnt) {
-      box_[icnt]->compute_M2M_X(ocoeff_sj, ocoeff_ui);
       if (icnt >= nbox_) throw logic_error("Trying to access beyond nbox in M2M_X");
+      shared_ptr<Box> b = box_[icnt];
+      tasks.emplace_back(
+        [b, ocoeff_sj, ocoeff_ui]() { b->compute_M2M_X(ocoeff_sj, ocoeff_ui); }
+      );
     }
+    tasks.compute();
   }
   m2mtime.tick_print("M2M-X pass");
   assert(icnt == nbox_);
@@ -311,18 +394,33 @@ void FMM::M2L(const bool dox) const {
 
   Timer m2ltime;
 
-  TaskQueue<function<void(void)>> tasks(nbox_);
   if (!dox) {
-    for (auto& b : box_)
-      tasks.emplace_back(
-        [this, b]() { b->compute_M2L(); }
-      );
+    // each process translates the boxes it owns; the local expansions are then summed in a single reduction
+    const int nmult = (lmax_+1)*(lmax_+1);
+    TaskQueue<function<void(void)>> tasks(nbox_);
+    for (int i = 0; i != nbox_; ++i)
+      if (owner_[i] == mpi__->rank()) {
+        shared_ptr<Box> b = box_[i];
+        tasks.emplace_back(
+          [b]() { b->compute_M2L(); }
+        );
+      }
     tasks.compute();
+
+    ZMatrix mlm(nmult, nbox_, true);
+    for (int i = 0; i != nbox_; ++i)
+      if (owner_[i] == mpi__->rank())
+        copy_n(box_[i]->mlm()->data(), nmult, mlm.element_ptr(0, i));
+    mpi__->allreduce(mlm.data(), mlm.size());
+    for (int i = 0; i != nbox_; ++i)
+      copy_n(mlm.element_ptr(0, i), nmult, box_[i]->mlm()->data());
     m2ltime.tick_print("M2L pass");
   } else {
+    // exchange batches are already distributed over processes (see compute_K_ff)
+    TaskQueue<function<void(void)>> tasks(nbox_);
     for (auto& b : box_)
       tasks.emplace_back(
-        [this, b]() { b->compute_M2L_X(); }
+        [b]() { b->compute_M2L_X(); }
       );
     tasks.compute();
     m2ltime.tick_print("M2L-X pass");
@@ -334,28 +432,23 @@ void FMM::L2L(const bool dox) const {
 
   Timer l2ltime;
 
+  // from the top of the tree; boxes in the same level are independent of each other
   int icnt = 0;
-  if (!dox) {
-    for (int ir = ns_; ir > -1; --ir) {
-      for (int ib = 0; ib != nbranch_[ir]; ++ib)
-        box_[nbox_-icnt-nbranch_[ir]+ib]->compute_L2L();
-
-      icnt += nbranch_[ir];
-    }
-
-    l2ltime.tick_print("L2L pass");
-  } else {
-    for (int ir = ns_; ir > -1; --ir) {
-      for (int ib = 0; ib != nbranch_[ir]; ++ib) {
-        const int ibox = nbox_-icnt-nbranch_[ir]+ib;
-        box_[ibox]->compute_L2L_X();
-        if (icnt >= nbox_) throw logic_error("Trying to access beyond nbox in M2M_X");
-      }
-
-      icnt += nbranch_[ir];
+  for (int ir = ns_; ir > -1; --ir) {
+    TaskQueue<function<void(void)>> tasks(nbranch_[ir]);
+    for (int ib = 0; ib != nbranch_[ir]; ++ib) {
+      const int ibox = nbox_-icnt-nbranch_[ir]+ib;
+      if (ibox >= nbox_) throw logic_error("Trying to access beyond nbox in L2L");
+      shared_ptr<Box> b = box_[ibox];
+      if (!dox)
+        tasks.emplace_back([b]() { b->compute_L2L(); });
+      else
+        tasks.emplace_back([b]() { b->compute_L2L_X(); });
     }
-    l2ltime.tick_print("L2L-X pass");
+    tasks.compute();
+    icnt += nbranch_[ir];
   }
+  l2ltime.tick_print(dox ? "L2L-X pass" : "L2L pass");
 }
 
 
@@ -395,7 +488,7 @@ shared_ptr<const Matrix> FMM::compute_Fock_FMM(shared_ptr<const Matrix> density)
 
     auto ff = make_shared<Matrix>(nbasis_, nbasis_);
     for (int i = 0; i != nbranch_[0]; ++i)
-      if (i % mpi__->size() == mpi__->rank()) {
+      if (owner_[i] == mpi__->rank()) {
         auto ei = box_[i]->compute_Fock_nf(density, maxden);
         blas::ax_plus_y_n(1.0, ei->data(), nbasis_*nbasis_, out->data());
         auto ffi = box_[i]->compute_Fock_ff(density);
@@ -520,7 +613,7 @@ shared_ptr<const Matrix> FMM::compute_Fock_FMM_K(shared_ptr<const Matrix> densit
     }
 
     for (int i = 0; i != nbranch_[0]; ++i)
-      if (i % mpi__->size() == mpi__->rank()) {
+      if (owner_[i] == mpi__->rank()) {
         auto ei = box_[i]->compute_Fock_nf_K(density, maxden);
         blas::ax_plus_y_n(1.0, ei->data(), nbasis_*nbasis_, out->data());
       }
@@ -572,7 +665,7 @@ shared_ptr<const Matrix> FMM::compute_Fock_FMM_J(shared_ptr<const Matrix> densit
 
     auto ff = make_shared<Matrix>(nbasis_, nbasis_);
     for (int i = 0; i != nbranch_[0]; ++i)
-      if (i % mpi__->size() == mpi__->rank()) {
+      if (owner_[i] == mpi__->rank()) {
         auto ffi = box_[i]->compute_Fock_ff(density);
         blas::ax_plus_y_n(1.0, ffi->data(), nbasis_*nbasis_, ff->data());
       }
@@ -580,7 +673,7 @@ shared_ptr<const Matrix> FMM::compute_Fock_FMM_J(shared_ptr<const Matrix> densit
     fmmtime.tick_print("FMM-J");
 
     for (int i = 0; i != nbranch_[0]; ++i)
-      if (i % mpi__->size() == mpi__->rank()) {
+      if (owner_[i] == mpi__->rank()) {
         auto ei = box_[i]->compute_Fock_nf_J(density, maxden);
         blas::ax_plus_y_n(1.0, ei->data(), nbasis_*nbasis_, out->data());
       }
@@ -47,15 +47,22 @@ class FMM {
     std::shared_ptr<const FMMInfo> geomdata_;
 
     std::vector<std::shared_ptr<Box>> box_;
+    // MPI process that handles each box
+    std::vector<int> owner_;
     double ws_;
     bool do_exchange_;
     int lmax_k_;
     bool debug_;
     int xbatchsize_;
     double thresh_;
+    // relative SVD threshold for the FMM-K translation operators (0 means uncompressed)
+    double compress_thresh_k_;
+    // memory limit (in MB) for the cached M2L operators; above it they are formed on the fly
+    double m2l_memory_;
 
     void init();
     void get_boxes();
+    void partition();
     void M2M(std::shared_ptr<const Matrix> mat, const bool do_exchange = false) const;
     void M2M_X(std::shared_ptr<const Matrix> ocoeff_sj, std::shared_ptr<const Matrix> ocoeff_ui) const;
     void M2L(const bool do_exchange = false) const;
@@ -66,13 +73,16 @@ class FMM {
     template<class Archive>
     void save(Archive& ar, const unsigned int) const {
       ar << ns_ << lmax_ << ws_ << do_exchange_ << lmax_k_ << debug_ << xbatchsize_ << geomdata_
-         << centre_ << nbasis_ << thresh_;
+         << centre_ << nbasis_ << thresh_ << compress_thresh_k_ << m2l_memory_;
     }
 
     template<class Archive>
-    void load(Archive& ar, const unsigned int) {
+    void load(Archive& ar, const unsigned int version) {
       ar >> ns_ >> lmax_ >> ws_ >> do_exchange_ >> lmax_k_ >> debug_ >> xbatchsize_ >> geomdata_
          >> centre_ >> nbasis_ >> thresh_;
+      // archives written before version 1 do not store the compression threshold and the M2L cache limit
+      if (version > 0)
+        ar >> compress_thresh_k_ >> m2l_memory_;
       init();
     }
 
@@ -83,7 +93,7 @@ class FMM {
 
 
   public:
-    FMM() { }
+    FMM() : compress_thresh_k_(0.0), m2l_memory_(1024.0) { }
     FMM(std::shared_ptr<const PTree> idata, std::shared_ptr<const Geometry> geom, const bool kbuild = false);
     ~FMM() { }
 
@@ -95,4 +105,8 @@ class FMM {
 };
 
 }
+
+#include <boost/serialization/version.hpp>
+BOOST_CLASS_VERSION(bagel::FMM, 1)
+
 #endif
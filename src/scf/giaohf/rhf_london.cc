@@ -117,7 +117,7 @@ void RHF_London::compute() {
 #ifndef DISABLE_SERIALIZATION
     if (restart_) {
       stringstream ss; ss << "scf_" << iter;
-      OArchive archive(ss.str());
+      OArchive archive(ss.str(), ss.str());
       archive << static_cast<Method*>(this);
     }
 #endif
@@ -23,12 +23,16 @@
 //
 
 #include <src/scf/hf/fock.h>
+#include <src/util/taskqueue.h>
 
 using namespace std;
 using namespace bagel;
 
 
-// Non-DF Fock matrix, standard basis
+// Non-DF Fock matrix, standard basis.
+// The density matrix may be a density change (incremental Fock build in RHF); quartets are screened by the Schwarz
+// bound weighted by the largest relevant density element, so the cost decreases as the SCF converges.
+// Shell pairs (i0, i1) are distributed over processes and threads; each thread accumulates into its own matrix.
 template <>
 void Fock<0>::fock_two_electron_part(shared_ptr<const Matrix> den) {
   const vector<shared_ptr<const Atom>> atoms = geom_->atoms();
@@ -42,7 +46,6 @@ void Fock<0>::fock_two_electron_part(shared_ptr<const Matrix> den) {
     offset.insert(offset.end(), tmpoff.begin(), tmpoff.end());
   }
 
-  const int shift = sizeof(int) * 4;
   const int size = basis.size();
 
   // first make max_density_change vector for each batch pair.
@@ -69,113 +72,143 @@ void Fock<0>::fock_two_electron_part(shared_ptr<const Matrix> den) {
       max_density_change[ji] = cmax;
     }
   }
+  const double max_density = *max_element(max_density_change.begin(), max_density_change.end()) * 4.0;
+  const double max_schwarz = *max_element(schwarz_.begin(), schwarz_.end());
+
+  // thread-local accumulators (obtained in the same way as StackMem in Resources)
+  const int nacc = resources__->max_num_threads();
+  vector<shared_ptr<Matrix>> accum(nacc);
+  unique_ptr<atomic_flag[]> inuse(new atomic_flag[nacc]);
+  for (int i = 0; i != nacc; ++i) inuse[i].clear();
 
   ////////////////////////////////////////////
   // starting 2-e Fock matrix evaluation!
   ////////////////////////////////////////////
-  //////////////// ONLY FOR REFERENCES. //////////////////
 
-  for (int i0 = 0; i0 != size; ++i0) {
+  auto compute_pair = [&](const int i0, const int i1) {
+    const unsigned int i01 = i0 *size + i1;
+    if (max_density * schwarz_[i01] * max_schwarz < schwarz_thresh_) return;
+
+    int iacc = 0;
+    while (inuse[iacc].test_and_set()) iacc = (iacc+1) % nacc;
+    if (!accum[iacc])
+      accum[iacc] = make_shared<Matrix>(ndim(), ndim(), true);
+    Matrix& out = *accum[iacc];
+
+    const int shift = sizeof(int) * 4;
+    const ptrdiff_t nd = ndim();
+
     const shared_ptr<const Shell>  b0 = basis[i0];
     const int b0offset = offset[i0];
     const int b0size = b0->nbasis();
-    for (int i1 = i0; i1 != size; ++i1) {
-      const unsigned int i01 = i0 *size + i1;
 
-      const shared_ptr<const Shell>  b1 = basis[i1];
-      const int b1offset = offset[i1];
-      const int b1size = b1->nbasis();
+    const shared_ptr<const Shell>  b1 = basis[i1];
+    const int b1offset = offset[i1];
+    const int b1size = b1->nbasis();
 
-      const double density_change_01 = max_density_change[i01] * 4.0;
+    const double density_change_01 = max_density_change[i01] * 4.0;
 
-      for (int i2 = i0; i2 != size; ++i2) {
-        const shared_ptr<const Shell>  b2 = basis[i2];
-        const int b2offset = offset[i2];
-        const int b2size = b2->nbasis();
+    for (int i2 = i0; i2 != size; ++i2) {
+      const shared_ptr<const Shell>  b2 = basis[i2];
+      const int b2offset = offset[i2];
+      const int b2size = b2->nbasis();
 
-        const double density_change_02 = max_density_change[i0 * size + i2];
-        const double density_change_12 = max_density_change[i1 * size + i2];
+      const double density_change_02 = max_density_change[i0 * size + i2];
+      const double density_change_12 = max_density_change[i1 * size + i2];
 
-        for (int i3 = i2; i3 != size; ++i3) {
-          const unsigned int i23 = i2 * size + i3;
-          if (i23 < i01) continue;
+      for (int i3 = i2; i3 != size; ++i3) {
+        const unsigned int i23 = i2 * size + i3;
+        if (i23 < i01) continue;
 
-          const double density_change_23 = max_density_change[i2 * size + i3] * 4.0;
-          const double density_change_03 = max_density_change[i0 * size + i2];
-          const double density_change_13 = max_density_change[i0 * size + i2];
+        const double density_change_23 = max_density_change[i2 * size + i3] * 4.0;
+        const double density_change_03 = max_density_change[i0 * size + i3];
+        const double density_change_13 = max_density_change[i1 * size + i3];
 
-          const bool eqli01i23 = (i01 == i23);
+        const bool eqli01i23 = (i01 == i23);
 
-          const shared_ptr<const Shell>  b3 = basis[i3];
-          const int b3offset = offset[i3];
-          const int b3size = b3->nbasis();
+        const shared_ptr<const Shell>  b3 = basis[i3];
+        const int b3offset = offset[i3];
+        const int b3size = b3->nbasis();
 
-          const double mulfactor = max(max(max(density_change_01, density_change_02),
-                                           max(density_change_12, density_change_23)),
-                                           max(density_change_03, density_change_13));
-          const double integral_bound = mulfactor * schwarz_[i01] * schwarz_[i23];
-          const bool skip_schwarz = integral_bound < schwarz_thresh_;
-          if (skip_schwarz) continue;
+        const double mulfactor = max(max(max(density_change_01, density_change_02),
+                                         max(density_change_12, density_change_23)),
+                                         max(density_change_03, density_change_13));
+        const double integral_bound = mulfactor * schwarz_[i01] * schwarz_[i23];
+        const bool skip_schwarz = integral_bound < schwarz_thresh_;
+        if (skip_schwarz) continue;
 
-          array<shared_ptr<const Shell>,4> input = {{b3, b2, b1, b0}};
+        array<shared_ptr<const Shell>,4> input = {{b3, b2, b1, b0}};
 #ifdef LIBINT_INTERFACE
-          Libint eribatch(input);
+        Libint eribatch(input);
 #else
-          ERIBatch eribatch(input, mulfactor);
+        ERIBatch eribatch(input, mulfactor);
 #endif
-          eribatch.compute();
-          const double* eridata = eribatch.data();
-          for (int j0 = b0offset; j0 != b0offset + b0size; ++j0) {
-            const int j0n = j0 * ndim();
-
-            for (int j1 = b1offset; j1 != b1offset + b1size; ++j1) {
-              const unsigned int nj01 = (j0 << shift) + j1;
-              const bool skipj0j1 = (j0 > j1);
-              if (skipj0j1) {
-                eridata += b2size * b3size;
-                continue;
-              }
+        eribatch.compute();
+        const double* eridata = eribatch.data();
+        for (int j0 = b0offset; j0 != b0offset + b0size; ++j0) {
+          const int j0n = j0 * nd;
+
+          for (int j1 = b1offset; j1 != b1offset + b1size; ++j1) {
+            const unsigned int nj01 = (j0 << shift) + j1;
+            const bool skipj0j1 = (j0 > j1);
+            if (skipj0j1) {
+              eridata += b2size * b3size;
+              continue;
+            }
 
-              const bool eqlj0j1 = (j0 == j1);
-              const double scal01 = (eqlj0j1 ? 0.5 : 1.0);
-              const int j1n = j1 * ndim();
+            const bool eqlj0j1 = (j0 == j1);
+            const double scal01 = (eqlj0j1 ? 0.5 : 1.0);
+            const int j1n = j1 * nd;
 
-              for (int j2 = b2offset; j2 != b2offset + b2size; ++j2) {
-                const int maxj1j2 = max(j1, j2);
-                const int minj1j2 = min(j1, j2);
+            for (int j2 = b2offset; j2 != b2offset + b2size; ++j2) {
+              const int maxj1j2 = max(j1, j2);
+              const int minj1j2 = min(j1, j2);
 
-                const int maxj0j2 = max(j0, j2);
-                const int minj0j2 = min(j0, j2);
-                const int j2n = j2 * ndim();
+              const int maxj0j2 = max(j0, j2);
+              const int minj0j2 = min(j0, j2);
+              const int j2n = j2 * nd;
 
-                for (int j3 = b3offset; j3 != b3offset + b3size; ++j3, ++eridata) {
-                  const bool skipj2j3 = (j2 > j3);
-                  const unsigned int nj23 = (j2 << shift) + j3;
-                  const bool skipj01j23 = (nj01 > nj23) && eqli01i23;
+              for (int j3 = b3offset; j3 != b3offset + b3size; ++j3, ++eridata) {
+                const bool skipj2j3 = (j2 > j3);
+                const unsigned int nj23 = (j2 << shift) + j3;
+                const bool skipj01j23 = (nj01 > nj23) && eqli01i23;
 
-                  if (skipj2j3 || skipj01j23) continue;
+                if (skipj2j3 || skipj01j23) continue;
 
-                  const int maxj1j3 = max(j1, j3);
-                  const int minj1j3 = min(j1, j3);
+                const int maxj1j3 = max(j1, j3);
+                const int minj1j3 = min(j1, j3);
 
-                  double intval = *eridata * scal01 * (j2 == j3 ? 0.5 : 1.0) * (nj01 == nj23 ? 0.25 : 0.5); // 1/2 in the Hamiltonian absorbed here
-                  const double intval4 = 4.0 * intval;
+                double intval = *eridata * scal01 * (j2 == j3 ? 0.5 : 1.0) * (nj01 == nj23 ? 0.25 : 0.5); // 1/2 in the Hamiltonian absorbed here
+                const double intval4 = 4.0 * intval;
 
-                  element(j1, j0) += density_data[j2n + j3] * intval4;
-                  element(j3, j2) += density_data[j0n + j1] * intval4;
-                  element(j3, j0) -= density_data[j1n + j2] * intval;
-                  element(maxj1j2, minj1j2) -= density_data[j0n + j3] * intval;
-                  element(maxj0j2, minj0j2) -= density_data[j1n + j3] * intval;
-                  element(maxj1j3, minj1j3) -= density_data[j0n + j2] * intval;
-                }
+                out.element(j1, j0) += density_data[j2n + j3] * intval4;
+                out.element(j3, j2) += density_data[j0n + j1] * intval4;
+                out.element(j3, j0) -= density_data[j1n + j2] * intval;
+                out.element(maxj1j2, minj1j2) -= density_data[j0n + j3] * intval;
+                out.element(maxj0j2, minj0j2) -= density_data[j1n + j3] * intval;
+                out.element(maxj1j3, minj1j3) -= density_data[j0n + j2] * intval;
               }
             }
           }
-
         }
+
       }
     }
-  }
+    inuse[iacc].clear();
+  };
+
+  TaskQueue<function<void(void)>> tasks(size*(size+1)/2);
+  int itask = 0;
+  for (int i0 = 0; i0 != size; ++i0)
+    for (int i1 = i0; i1 != size; ++i1, ++itask)
+      if (itask % mpi__->size() == mpi__->rank())
+        tasks.emplace_back([&compute_pair, i0, i1]() { compute_pair(i0, i1); });
+  tasks.compute();
+
+  for (auto& i : accum)
+    if (i) *this += *i;
+  allreduce();
+
   for (int i = 0; i != ndim(); ++i) element(i, i) *= 2.0;
   fill_upper();
 }
@@ -47,6 +47,98 @@ RHF::RHF(const shared_ptr<const PTree> idata, const shared_ptr<const Geometry> g
     cout << "  level shift : " << setprecision(3) << lshift_ << endl << endl;
     levelshift_ = make_shared<ShiftVirtual<DistMatrix>>(nocc_, lshift_);
   }
+
+  symmetry_ = idata->get<bool>("symmetry", false) && geom_->plist()->nirrep() > 1;
+  if (symmetry_ && geom_->external()) {
+    cout << "  Symmetry is not used in the presence of an external field" << endl << endl;
+    symmetry_ = false;
+  }
+  if (symmetry_)
+    init_symmetry();
+}
+
+
+void RHF::init_symmetry() {
+  shared_ptr<const Petite> plist = geom_->plist();
+  vector<shared_ptr<const Matrix>> aotoso = plist->aotoso();
+
+  // orthogonalization within each irrep
+  vector<shared_ptr<const Matrix>> blocks;
+  int nmo = 0;
+  for (auto& so : aotoso) {
+    shared_ptr<const Matrix> x = so->mdim() ? make_shared<Matrix>(*so % *overlap_ * *so)->tildex(thresh_overlap_) : nullptr;
+    blocks.push_back(x ? make_shared<const Matrix>(*so * *x) : nullptr);
+    nmo += x ? x->mdim() : 0;
+  }
+
+  auto tildex = make_shared<Matrix>(geom_->nbasis(), nmo);
+  so_irrep_.clear();
+  cout << "  Symmetry-adapted orbitals (" << plist->sym() << "):";
+  for (int irrep = 0, offset = 0; irrep != static_cast<int>(blocks.size()); ++irrep) {
+    const int n = blocks[irrep] ? blocks[irrep]->mdim() : 0;
+    if (n)
+      tildex->copy_block(0, offset, geom_->nbasis(), n, blocks[irrep]);
+    so_irrep_.insert(so_irrep_.end(), n, irrep);
+    offset += n;
+    cout << " " << n;
+  }
+  cout << endl << endl;
+  tildex_ = tildex;
+}
+
+
+vector<int> RHF::nocc_irrep() const {
+  vector<int> out;
+  if (symmetry_) {
+    out.resize(geom_->plist()->nirrep(), 0);
+    for (int i = 0; i != nocc_; ++i)
+      ++out[irrep_[i]];
+  }
+  return out;
+}
+
+
+// The Fock matrix in the basis of symmetry-adapted orbitals is diagonalized in each irrep (elements between irreps are zero
+// by symmetry). The eigenvectors are then sorted by the eigenvalues so that the orbitals are occupied in the aufbau order.
+void RHF::diagonalize_symmetry(DistMatrix& intermediate) {
+  // copies (matrix() and distmatrix() require a shared_ptr when DistMatrix is Matrix)
+  const Matrix mat(intermediate);
+  const int n = mat.ndim();
+  assert(irrep_.size() == static_cast<size_t>(n));
+
+  vector<tuple<double, int, vector<pair<int,double>>>> orbitals;
+  for (int irrep = 0; irrep != geom_->plist()->nirrep(); ++irrep) {
+    vector<int> index;
+    for (int i = 0; i != n; ++i)
+      if (irrep_[i] == irrep)
+        index.push_back(i);
+    const int m = index.size();
+    if (!m) continue;
+
+    Matrix sub(m, m);
+    for (int j = 0; j != m; ++j)
+      for (int i = 0; i != m; ++i)
+        sub(i, j) = mat.element(index[i], index[j]);
+    VectorB e(m);
+    sub.diagonalize(e);
+    for (int j = 0; j != m; ++j) {
+      vector<pair<int,double>> vec(m);
+      for (int i = 0; i != m; ++i)
+        vec[i] = make_pair(index[i], sub(i, j));
+      orbitals.emplace_back(e(j), irrep, move(vec));
+    }
+  }
+  stable_sort(orbitals.begin(), orbitals.end(), [](const tuple<double, int, vector<pair<int,double>>>& a, const tuple<double, int, vector<pair<int,double>>>& b)
+                                                   { return get<0>(a) < get<0>(b); });
+
+  Matrix out(n, n);
+  for (int j = 0; j != n; ++j) {
+    eig()(j) = get<0>(orbitals[j]);
+    irrep_[j] = get<1>(orbitals[j]);
+    for (auto& i : get<2>(orbitals[j]))
+      out(i.first, j) = i.second;
+  }
+  intermediate = DistMatrix(out);
 }
 
 
@@ -81,7 +173,12 @@ void RHF::compute() {
         fock = focka->distmatrix();
       }
       DistMatrix intermediate = *tildex % *fock * *tildex;
-      intermediate.diagonalize(eig());
+      if (symmetry_) {
+        irrep_ = so_irrep_;
+        diagonalize_symmetry(intermediate);
+      } else {
+        intermediate.diagonalize(eig());
+      }
       coeff = make_shared<const DistMatrix>(*tildex * intermediate);
     } else {
       shared_ptr<const Matrix> focka;
@@ -97,7 +194,12 @@ void RHF::compute() {
         focka = compute_Fock_FMM(aodensity_, make_shared<const Matrix>(coeff_->slice(0, nocc_)));
       }
       DistMatrix intermediate = *tildex % *focka->distmatrix() * *tildex;
-      intermediate.diagonalize(eig());
+      if (symmetry_) {
+        irrep_ = so_irrep_;
+        diagonalize_symmetry(intermediate);
+      } else {
+        intermediate.diagonalize(eig());
+      }
       coeff = make_shared<const DistMatrix>(*tildex * intermediate);
     }
     coeff_ = make_shared<const Coeff>(*coeff->matrix());
@@ -119,6 +221,8 @@ void RHF::compute() {
 
   // starting SCF iteration
   shared_ptr<const Matrix> densitychange = aodensity_;
+  // in the incremental (non-DF) Fock build, the Fock matrix is rebuilt from the full density periodically to avoid error accumulation
+  const int fock_rebuild = idata_->get<int>("fock_rebuild", 8);
 
   for (int iter = 0; iter != max_iter_; ++iter) {
     Timer pdebug(1);
@@ -126,14 +230,17 @@ void RHF::compute() {
 #ifndef DISABLE_SERIALIZATION
     if (restart_) {
       stringstream ss; ss << "scf_" << iter;
-      OArchive archive(ss.str());
+      OArchive archive(ss.str(), ss.str());
       archive << static_cast<Method*>(this);
     }
 #endif
 
     if (!dofmm_) {
       if (!dodf_) {
-        previous_fock = make_shared<Fock<0>>(geom_, previous_fock, densitychange, schwarz_);
+        if (fock_rebuild > 0 && iter > 0 && iter % fock_rebuild == 0)
+          previous_fock = make_shared<Fock<0>>(geom_, hcore_, aodensity_, schwarz_);
+        else
+          previous_fock = make_shared<Fock<0>>(geom_, previous_fock, densitychange, schwarz_);
         mpi__->broadcast(const_pointer_cast<Matrix>(previous_fock)->data(), previous_fock->size(), 0);
       } else {
         previous_fock = make_shared<Fock<1>>(geom_, hcore_, nullptr, coeff_->slice(0, nocc_), do_grad_, true/*rhf*/);
@@ -156,6 +263,12 @@ void RHF::compute() {
     if (error < thresh_scf_) {
       cout << indent << endl << indent << "  * SCF iteration converged." << endl << endl;
       if (do_grad_) half_ = dynamic_pointer_cast<const Fock<1>>(previous_fock)->half();
+      if (symmetry_) {
+        cout << indent << "  * Doubly occupied orbitals in each irrep:";
+        for (auto& i : nocc_irrep())
+          cout << " " << i;
+        cout << endl << endl;
+      }
 
       break;
     } else if (iter == max_iter_-1) {
@@ -173,7 +286,10 @@ void RHF::compute() {
     if (levelshift_)
       levelshift_->shift(intermediate);
 
-    intermediate.diagonalize(eig());
+    if (symmetry_)
+      diagonalize_symmetry(intermediate);
+    else
+      intermediate.diagonalize(eig());
     pdebug.tick_print("Diag");
 
     coeff = make_shared<const DistMatrix>(*coeff * intermediate);
@@ -40,6 +40,14 @@ class RHF : public SCF_base {
     bool dodf_;
     bool restarted_;
 
+    // if true, tildex_ consists of orthogonalized symmetry-adapted orbitals, and the Fock matrix is diagonalized in each irrep
+    bool symmetry_;
+    // irreps of the columns of tildex_ and of the current orbitals
+    std::vector<int> so_irrep_;
+    std::vector<int> irrep_;
+    void init_symmetry();
+    void diagonalize_symmetry(DistMatrix& intermediate);
+
     std::shared_ptr<DIIS<DistMatrix>> diis_;
     std::shared_ptr<const Matrix> compute_Fock_FMM(std::shared_ptr<const Matrix> density, std::shared_ptr<const Matrix> coeff = nullptr);
 
@@ -50,13 +58,16 @@ class RHF : public SCF_base {
     template<class Archive>
     void save(Archive& ar, const unsigned int) const {
       ar << boost::serialization::base_object<SCF_base>(*this);
-      ar << lshift_ << dodf_ << diis_;
+      ar << lshift_ << dodf_ << diis_ << symmetry_ << so_irrep_ << irrep_;
     }
 
     template<class Archive>
-    void load(Archive& ar, const unsigned int) {
+    void load(Archive& ar, const unsigned int version) {
       ar >> boost::serialization::base_object<SCF_base>(*this);
       ar >> lshift_ >> dodf_ >> diis_;
+      // archives written before version 1 are without symmetry
+      if (version > 0)
+        ar >> symmetry_ >> so_irrep_ >> irrep_;
       if (lshift_ != 0.0)
         levelshift_ = std::make_shared<ShiftVirtual<DistMatrix>>(nocc_, lshift_);
       restarted_ = true;
@@ -68,7 +79,7 @@ class RHF : public SCF_base {
     }
 
   public:
-    RHF() { }
+    RHF() : symmetry_(false) { }
     RHF(const std::shared_ptr<const PTree> idata_, const std::shared_ptr<const Geometry> geom, const std::shared_ptr<const Reference> re = nullptr);
     virtual ~RHF() { }
 
@@ -78,11 +89,16 @@ class RHF : public SCF_base {
 
     bool dodf() const { return dodf_; }
 
+    // number of doubly occupied orbitals in each irrep (empty unless symmetry is used)
+    std::vector<int> nocc_irrep() const;
+
 };
 
 }
 
 #include <src/util/archive.h>
+#include <boost/serialization/version.hpp>
 BOOST_CLASS_EXPORT_KEY(bagel::RHF)
+BOOST_CLASS_VERSION(bagel::RHF, 1)
 
 #endif
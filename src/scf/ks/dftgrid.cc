@@ -22,7 +22,9 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <atomic>
 #include <numeric>
+#include <functional>
 #include <src/scf/ks/dftgrid.h>
 #include <src/scf/ks/lebedevlist.h>
 #include <src/scf/ks/xcfunc.h>
@@ -39,22 +41,59 @@ using namespace bagel;
 const static LebedevList lebedev;
 
 
-vector<shared_ptr<const Matrix>> DFTGrid_base::compute_rho_sigma(shared_ptr<const XCFunc> func, shared_ptr<const Matrix> mat,
-                                                         unique_ptr<double[]>& rho, unique_ptr<double[]>& sigma,
-                                                         unique_ptr<double[]>& rhox, unique_ptr<double[]>& rhoy, unique_ptr<double[]>& rhoz) const {
+namespace {
+// A set of accumulators. Each running task takes a free one, so that there are as many accumulators as threads and no locks
+// are needed when adding contributions. The accumulators are summed up at the end.
+template<class T>
+class Accumulators {
+  protected:
+    std::vector<std::shared_ptr<T>> data_;
+    std::unique_ptr<std::atomic_flag[]> used_;
+  public:
+    Accumulators(const size_t n, std::function<std::shared_ptr<T>()> init) : used_(new std::atomic_flag[n]) {
+      for (size_t i = 0; i != n; ++i) {
+        data_.push_back(init());
+        used_[i].clear();
+      }
+    }
+    size_t acquire() {
+      while (true)
+        for (size_t i = 0; i != data_.size(); ++i)
+          if (!used_[i].test_and_set()) return i;
+    }
+    void release(const size_t i) { used_[i].clear(); }
+    std::shared_ptr<T>& operator[](const size_t i) { return data_[i]; }
+    std::shared_ptr<T> sum() {
+      for (size_t i = 1; i < data_.size(); ++i)
+        *data_.front() += *data_[i];
+      return data_.front();
+    }
+};
+}
+
+
+DFTGrid_base::DFTGrid_base(shared_ptr<const Molecule> mol, shared_ptr<const PTree> idata) : mol_(mol), print_(!!idata) {
+  if (!idata)
+    idata = make_shared<const PTree>();
+  max_block_ = idata->get<size_t>("grid_max_block", 128);
+  box_edge_ = idata->get<double>("grid_box_edge", 2.0);
+  basis_thresh_ = idata->get<double>("grid_basis_thresh", 1.0e-12);
+}
+
+
+vector<shared_ptr<const Matrix>> DFTGrid_base::compute_rho_sigma(shared_ptr<const XCFunc> func, shared_ptr<const Matrix> cmat, shared_ptr<const GridBlock> block,
+                                                                 double* rho, double* sigma, double* rhox, double* rhoy, double* rhoz) const {
   vector<shared_ptr<const Matrix>> out;
-  auto orb = make_shared<Matrix>(*mat % *grid_->basis());
+  auto orb = make_shared<Matrix>(*cmat % *block->basis());
   if (func->lda()) {
-    assert(orb->mdim() == grid_->size());
-    for (size_t i = 0; i != orb->mdim(); ++i) {
+    for (size_t i = 0; i != block->size(); ++i)
       rho[i] = 2*ddot_(orb->ndim(), orb->element_ptr(0, i), 1, orb->element_ptr(0, i), 1);
-    }
     out = vector<shared_ptr<const Matrix>>{orb};
   } else {
-    auto orbx = make_shared<Matrix>(*mat % *grid_->gradx());
-    auto orby = make_shared<Matrix>(*mat % *grid_->grady());
-    auto orbz = make_shared<Matrix>(*mat % *grid_->gradz());
-    for (size_t i = 0; i != orb->mdim(); ++i) {
+    auto orbx = make_shared<Matrix>(*cmat % *block->gradx());
+    auto orby = make_shared<Matrix>(*cmat % *block->grady());
+    auto orbz = make_shared<Matrix>(*cmat % *block->gradz());
+    for (size_t i = 0; i != block->size(); ++i) {
       rho[i] = 2*ddot_(orb->ndim(), orb->element_ptr(0, i), 1, orb->element_ptr(0, i), 1);
       const double sigx = 2*ddot_(orb->ndim(), orb->element_ptr(0, i), 1, orbx->element_ptr(0, i), 1);
       const double sigy = 2*ddot_(orb->ndim(), orb->element_ptr(0, i), 1, orby->element_ptr(0, i), 1);
@@ -70,187 +109,164 @@ vector<shared_ptr<const Matrix>> DFTGrid_base::compute_rho_sigma(shared_ptr<cons
 }
 
 
-namespace bagel {
-class ExcVxcTask {
-  protected:
-    const size_t size;
-    const double* rho;
-    const double* sigma;
-    double* exc;
-    double* vxc;
-    double* vxc2;
-    shared_ptr<const XCFunc> func;
-  public:
-    ExcVxcTask(const size_t n, const double* r, const double* s, double* e, double* v, double* v2, shared_ptr<const XCFunc> f)
-     : size(n), rho(r), sigma(s), exc(e), vxc(v), vxc2(v2), func(f) { }
-    void compute() {
-      func->compute_exc_vxc(size, rho, sigma, exc, vxc, vxc2);
-    }
-};
-class VxcTask {
-  protected:
-    const size_t size;
-    const double* rho;
-    const double* sigma;
-    double* vxc;
-    double* vxc2;
-    shared_ptr<const XCFunc> func;
-  public:
-    VxcTask(const size_t n, const double* r, const double* s, double* v, double* v2, shared_ptr<const XCFunc> f)
-     : size(n), rho(r), sigma(s), vxc(v), vxc2(v2), func(f) { }
-    void compute() {
-      func->compute_vxc(size, rho, sigma, vxc, vxc2);
-    }
-};
-}
-
-
 tuple<shared_ptr<const Matrix>,double> DFTGrid_base::compute_xc(shared_ptr<const XCFunc> func, shared_ptr<const Matrix> mat) const {
   Timer time;
 
-  unique_ptr<double[]> rho(new double[grid_->size()]);
-  unique_ptr<double[]> sigma, rhox, rhoy, rhoz;
-  if (!func->lda()) {
-    sigma = unique_ptr<double[]>(new double[grid_->size()]);
-    rhox  = unique_ptr<double[]>(new double[grid_->size()]);
-    rhoy  = unique_ptr<double[]>(new double[grid_->size()]);
-    rhoz  = unique_ptr<double[]>(new double[grid_->size()]);
-  }
-
-  compute_rho_sigma(func, mat, rho, sigma, rhox, rhoy, rhoz);
-
-  time.tick_print("rho, sigma");
-
-  unique_ptr<double[]> exc(new double[grid_->size()]);
-  unique_ptr<double[]> vxc(new double[grid_->size()*(func->lda()?1:2)]);
-
-  StaticDist dist(grid_->size(), min(resources__->max_num_threads()*100, grid_->size()));
-  vector<pair<size_t, size_t>> table = dist.atable();
-
-  TaskQueue<ExcVxcTask> tasks(table.size());
-  for (auto& i : table) {
-    const size_t n = i.first;
-    tasks.emplace_back(i.second, rho.get()+n, (!func->lda() ? sigma.get()+n : nullptr),
-                               exc.get()+n, vxc.get()+n, (!func->lda() ? vxc.get()+n+grid_->size() : nullptr), func);
-  }
+  // density, the XC functional, and the Vxc contraction are done block by block; only O(block) intermediates are allocated
+  const size_t nthreads = resources__->max_num_threads();
+  Accumulators<Matrix> acc(nthreads, [this]() { return make_shared<Matrix>(mol_->nbasis(), mol_->nbasis()); });
+  vector<double> energy(grid_->blocks().size(), 0.0);
+
+  TaskQueue<function<void(void)>> tasks(grid_->blocks().size());
+  for (size_t iblock = 0; iblock != grid_->blocks().size(); ++iblock)
+    tasks.emplace_back([&, iblock]() {
+      shared_ptr<const GridBlock> block = grid_->blocks()[iblock];
+      const size_t n = block->size();
+      unique_ptr<double[]> buf(new double[n*(func->lda() ? 3 : 8)]);
+      double* const rho = buf.get();
+      double* const exc = rho + n;
+      double* const vxc = exc + n;
+      double* const vxc2 = func->lda() ? nullptr : vxc + n;
+      double* const sigma = func->lda() ? nullptr : vxc2 + n;
+      double* const rhox = func->lda() ? nullptr : sigma + n;
+      double* const rhoy = func->lda() ? nullptr : rhox + n;
+      double* const rhoz = func->lda() ? nullptr : rhoy + n;
+
+      shared_ptr<const Matrix> cmat = block->gather(*mat);
+      compute_rho_sigma(func, cmat, block, rho, sigma, rhox, rhoy, rhoz);
+      func->compute_exc_vxc(n, rho, sigma, exc, vxc, vxc2);
+
+      auto scal = make_shared<Matrix>(block->nfunc(), n, true);
+      for (size_t i = 0; i != n; ++i) {
+        const double w = grid_->weight(block->point(i));
+        energy[iblock] += exc[i] * rho[i] * w;
+        daxpy_(scal->ndim(), vxc[i]*w, block->basis()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
+        if (!func->lda()) {
+          daxpy_(scal->ndim(), 4*vxc2[i]*w*rhox[i], block->gradx()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
+          daxpy_(scal->ndim(), 4*vxc2[i]*w*rhoy[i], block->grady()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
+          daxpy_(scal->ndim(), 4*vxc2[i]*w*rhoz[i], block->gradz()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
+        }
+      }
+      const Matrix sub = *scal ^ *block->basis();
+      const size_t a = acc.acquire();
+      block->scatter_add(sub, *acc[a]);
+      acc.release(a);
+    });
   tasks.compute();
-  time.tick_print("exc+vxc");
-
-  auto out = make_shared<Matrix>(mol_->nbasis(), mol_->nbasis());
-  double en = 0.0;
 
-  auto scal = make_shared<Matrix>(mol_->nbasis(), grid_->size());
-  if (func->lda()) {
-    for (size_t i = 0; i != scal->mdim(); ++i) {
-      daxpy_(scal->ndim(), vxc[i]*grid_->weight(i), grid_->basis()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
-      en += exc[i] * rho[i] * grid_->weight(i);
-    }
-  } else {
-    for (size_t i = 0; i != scal->mdim(); ++i) {
-      daxpy_(scal->ndim(), vxc[i]*grid_->weight(i), grid_->basis()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
-      daxpy_(scal->ndim(), 4*vxc[i+grid_->size()]*grid_->weight(i)*rhox[i], grid_->gradx()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
-      daxpy_(scal->ndim(), 4*vxc[i+grid_->size()]*grid_->weight(i)*rhoy[i], grid_->grady()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
-      daxpy_(scal->ndim(), 4*vxc[i+grid_->size()]*grid_->weight(i)*rhoz[i], grid_->gradz()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
-      en += exc[i] * rho[i] * grid_->weight(i);
-    }
-  }
-  *out += *scal ^ *grid_->basis();
+  shared_ptr<Matrix> out = acc.sum();
   out->symmetrize();
+  // summed in the order of the blocks so that the result does not depend on the scheduling
+  const double en = accumulate(energy.begin(), energy.end(), 0.0);
 
-  time.tick_print("contraction");
+  time.tick_print("xc integration");
   return make_tuple(out, en);
 }
 
 
 shared_ptr<const GradFile> DFTGrid_base::compute_xcgrad(shared_ptr<const XCFunc> func, shared_ptr<const Matrix> mat) const {
-  auto out = make_shared<GradFile>(mol_->natom());
-
-  unique_ptr<double[]> rho(new double[grid_->size()]);
-  unique_ptr<double[]> sigma, rhox, rhoy, rhoz;
-  if (!func->lda()) {
-    sigma = unique_ptr<double[]>(new double[grid_->size()]);
-    rhox  = unique_ptr<double[]>(new double[grid_->size()]);
-    rhoy  = unique_ptr<double[]>(new double[grid_->size()]);
-    rhoz  = unique_ptr<double[]>(new double[grid_->size()]);
-  }
-  unique_ptr<double[]> vxc(new double[grid_->size()*(func->lda()?1:2)]);
-
-  vector<shared_ptr<const Matrix>> orb = compute_rho_sigma(func, mat, rho, sigma, rhox, rhoy, rhoz);
-
-  StaticDist dist(grid_->size(), min(resources__->max_num_threads()*100, grid_->size()));
-  vector<pair<size_t, size_t>> table = dist.atable();
-
-  TaskQueue<VxcTask> tasks(table.size());
-  for (auto& i : table) {
-    const size_t n = i.first;
-    tasks.emplace_back(i.second, rho.get()+n, (!func->lda() ? sigma.get()+n : nullptr),
-                            vxc.get()+n, (!func->lda() ? vxc.get()+n+grid_->size() : nullptr), func);
-  }
-  tasks.compute();
-
-  // in GGA, we need nabla^2 basis // TODO I guess this should be more efficient..
-  array<shared_ptr<Matrix>,6> grad2;
-  if (!func->lda())
-    grad2 = grid_->compute_grad2();
-
-  // loop over target atom
+  // AO offsets of the atoms
+  vector<size_t> atom_offsets;
   size_t offset = 0;
-  int n = 0;
   for (auto& b : mol_->atoms()) {
-    shared_ptr<const Matrix> bmat = mat->cut(offset, offset+b->nbasis());
-    array<shared_ptr<const Matrix>,3> d1mat;
-    d1mat[0] = make_shared<const Matrix>(*bmat % *grid_->gradx()->cut(offset, offset+b->nbasis()));
-    d1mat[1] = make_shared<const Matrix>(*bmat % *grid_->grady()->cut(offset, offset+b->nbasis()));
-    d1mat[2] = make_shared<const Matrix>(*bmat % *grid_->gradz()->cut(offset, offset+b->nbasis()));
-
-    double sum[3] = {0.0};
-    for (size_t i = 0; i != grid_->size(); ++i) {
-      for (int x = 0; x != 3; ++x)
-        sum[x] += ddot_(mat->mdim(), d1mat[x]->element_ptr(0,i), 1, orb[0]->element_ptr(0,i), 1) * grid_->weight(i) * vxc[i];
-    }
+    atom_offsets.push_back(offset);
+    offset += b->nbasis();
+  }
+  atom_offsets.push_back(offset);
+
+  const size_t nthreads = resources__->max_num_threads();
+  Accumulators<GradFile> acc(nthreads, [this]() { return make_shared<GradFile>(mol_->natom()); });
+
+  TaskQueue<function<void(void)>> tasks(grid_->blocks().size());
+  for (auto& block : grid_->blocks())
+    tasks.emplace_back([&, block]() {
+      const size_t n = block->size();
+      unique_ptr<double[]> buf(new double[n*(func->lda() ? 2 : 7)]);
+      double* const rho = buf.get();
+      double* const vxc = rho + n;
+      double* const vxc2 = func->lda() ? nullptr : vxc + n;
+      double* const sigma = func->lda() ? nullptr : vxc2 + n;
+      double* const rhox = func->lda() ? nullptr : sigma + n;
+      double* const rhoy = func->lda() ? nullptr : rhox + n;
+      double* const rhoz = func->lda() ? nullptr : rhoy + n;
+
+      shared_ptr<const Matrix> cmat = block->gather(*mat);
+      vector<shared_ptr<const Matrix>> orb = compute_rho_sigma(func, cmat, block, rho, sigma, rhox, rhoy, rhoz);
+      func->compute_vxc(n, rho, sigma, vxc, vxc2);
+
+      // in GGA, we need nabla^2 basis, which is computed for this block only
+      array<shared_ptr<Matrix>,6> grad2;
+      if (!func->lda())
+        grad2 = block->compute_grad2(grid_->data());
+
+      const size_t a = acc.acquire();
+      GradFile& out = *acc[a];
+
+      // loop over target atoms that have significant functions on this block (they are contiguous in the block)
+      size_t lo = 0;
+      for (size_t k = 0; k != block->shells().size(); ) {
+        const int iatom = upper_bound(atom_offsets.begin(), atom_offsets.end(), block->offsets()[k]) - atom_offsets.begin() - 1;
+        size_t hi = lo;
+        for ( ; k != block->shells().size() && block->offsets()[k] < atom_offsets[iatom+1]; ++k)
+          hi += block->shells()[k]->nbasis();
+
+        shared_ptr<const Matrix> bmat = cmat->cut(lo, hi);
+        array<shared_ptr<const Matrix>,3> d1mat;
+        d1mat[0] = make_shared<const Matrix>(*bmat % *block->gradx()->cut(lo, hi));
+        d1mat[1] = make_shared<const Matrix>(*bmat % *block->grady()->cut(lo, hi));
+        d1mat[2] = make_shared<const Matrix>(*bmat % *block->gradz()->cut(lo, hi));
+
+        const size_t nocc = cmat->mdim();
+        double sum[3] = {0.0};
+        for (size_t i = 0; i != n; ++i) {
+          const double w = grid_->weight(block->point(i));
+          for (int x = 0; x != 3; ++x)
+            sum[x] += ddot_(nocc, d1mat[x]->element_ptr(0,i), 1, orb[0]->element_ptr(0,i), 1) * w * vxc[i];
+        }
+
+        if (!func->lda()) {
+          array<shared_ptr<const Matrix>,6> d2mat;
+          for (int i = 0; i != 6; ++i)
+            d2mat[i] = make_shared<const Matrix>(*bmat % *grad2[i]->cut(lo, hi));
+
+          unique_ptr<double[]> tmp2(new double[nocc]);
+          for (size_t i = 0; i != n; ++i) {
+            const double fac = grid_->weight(block->point(i)) * (2*vxc2[i]);
+            // first term
+            fill_n(tmp2.get(), nocc, 0.0);
+            daxpy_(nocc, rhox[i], d2mat[0]->element_ptr(0,i), 1, tmp2.get(), 1);
+            daxpy_(nocc, rhoy[i], d2mat[1]->element_ptr(0,i), 1, tmp2.get(), 1);
+            daxpy_(nocc, rhoz[i], d2mat[3]->element_ptr(0,i), 1, tmp2.get(), 1);
+            sum[0] += ddot_(nocc, tmp2.get(), 1, orb[0]->element_ptr(0,i), 1) * fac;
+            fill_n(tmp2.get(), nocc, 0.0);
+            daxpy_(nocc, rhox[i], d2mat[1]->element_ptr(0,i), 1, tmp2.get(), 1);
+            daxpy_(nocc, rhoy[i], d2mat[2]->element_ptr(0,i), 1, tmp2.get(), 1);
+            daxpy_(nocc, rhoz[i], d2mat[4]->element_ptr(0,i), 1, tmp2.get(), 1);
+            sum[1] += ddot_(nocc, tmp2.get(), 1, orb[0]->element_ptr(0,i), 1) * fac;
+            fill_n(tmp2.get(), nocc, 0.0);
+            daxpy_(nocc, rhox[i], d2mat[3]->element_ptr(0,i), 1, tmp2.get(), 1);
+            daxpy_(nocc, rhoy[i], d2mat[4]->element_ptr(0,i), 1, tmp2.get(), 1);
+            daxpy_(nocc, rhoz[i], d2mat[5]->element_ptr(0,i), 1, tmp2.get(), 1);
+            sum[2] += ddot_(nocc, tmp2.get(), 1, orb[0]->element_ptr(0,i), 1) * fac;
+            // second term
+            fill_n(tmp2.get(), nocc, 0.0);
+            daxpy_(nocc, rhox[i], orb[1]->element_ptr(0,i), 1, tmp2.get(), 1);
+            daxpy_(nocc, rhoy[i], orb[2]->element_ptr(0,i), 1, tmp2.get(), 1);
+            daxpy_(nocc, rhoz[i], orb[3]->element_ptr(0,i), 1, tmp2.get(), 1);
+            for (int x = 0; x != 3; ++x)
+              sum[x] += ddot_(nocc, tmp2.get(), 1, d1mat[x]->element_ptr(0,i), 1) * fac;
+          }
+        }
 
-    if (!func->lda()) {
-      array<shared_ptr<const Matrix>,6> d2mat;
-      for (int i = 0; i != 6; ++i)
-        d2mat[i] = make_shared<const Matrix>(*bmat % *grad2[i]->cut(offset, offset+b->nbasis()));
-
-      unique_ptr<double[]> tmp2(new double[mat->mdim()]);
-      for (size_t i = 0; i != grid_->size(); ++i) {
-        // first term
-        fill_n(tmp2.get(), mat->mdim(), 0.0);
-        daxpy_(mat->mdim(), rhox[i], d2mat[0]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoy[i], d2mat[1]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoz[i], d2mat[3]->element_ptr(0,i), 1, tmp2.get(), 1);
-        sum[0] += ddot_(mat->mdim(), tmp2.get(), 1, orb[0]->element_ptr(0,i), 1) * grid_->weight(i) * (2*vxc[i+grid_->size()]);
-        fill_n(tmp2.get(), mat->mdim(), 0.0);
-        daxpy_(mat->mdim(), rhox[i], d2mat[1]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoy[i], d2mat[2]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoz[i], d2mat[4]->element_ptr(0,i), 1, tmp2.get(), 1);
-        sum[1] += ddot_(mat->mdim(), tmp2.get(), 1, orb[0]->element_ptr(0,i), 1) * grid_->weight(i) * (2*vxc[i+grid_->size()]);
-        fill_n(tmp2.get(), mat->mdim(), 0.0);
-        daxpy_(mat->mdim(), rhox[i], d2mat[3]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoy[i], d2mat[4]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoz[i], d2mat[5]->element_ptr(0,i), 1, tmp2.get(), 1);
-        sum[2] += ddot_(mat->mdim(), tmp2.get(), 1, orb[0]->element_ptr(0,i), 1) * grid_->weight(i) * (2*vxc[i+grid_->size()]);
-        // second term
-        fill_n(tmp2.get(), mat->mdim(), 0.0);
-        daxpy_(mat->mdim(), rhox[i], orb[1]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoy[i], orb[2]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoz[i], orb[3]->element_ptr(0,i), 1, tmp2.get(), 1);
         for (int x = 0; x != 3; ++x)
-          sum[x] += ddot_(mat->mdim(), tmp2.get(), 1, d1mat[x]->element_ptr(0,i), 1) * grid_->weight(i) * (2*vxc[i+grid_->size()]);
+          out.element(x, iatom) += -4.0*sum[x];
+        lo = hi;
       }
-    }
-
-    out->element(0, n) += -4.0*sum[0];
-    out->element(1, n) += -4.0*sum[1];
-    out->element(2, n) += -4.0*sum[2];
-
-    offset += b->nbasis();
-    ++n;
-  }
+      acc.release(a);
+    });
+  tasks.compute();
 
-  return out;
+  return acc.sum();
 }
 
 
@@ -364,7 +380,7 @@ void DFTGrid_base::add_grid(const int nrad, const int nang, const unique_ptr<dou
   tasks.compute();
 
   shared_ptr<const Matrix> o = combined;
-  grid_ = make_shared<Grid>(mol_, o);
+  grid_ = make_shared<Grid>(mol_, o, max_block_, box_edge_, basis_thresh_);
 
 }
 
@@ -376,7 +392,7 @@ void DFTGrid_base::remove_redgrid() {
       ++size;
   auto out = make_shared<Matrix>(4, size);
 
-  if (size < grid_->size())
+  if (print_ && size < static_cast<int>(grid_->size()))
     cout << "    * Removing " << grid_->size()-size << " points whose weight is below " << scientific << setprecision(2) << grid_thresh_ << endl << fixed;
 
   size = 0;
@@ -385,14 +401,15 @@ void DFTGrid_base::remove_redgrid() {
       copy_n(grid_->data()->element_ptr(0, i), 4, out->element_ptr(0,size++));
 
   shared_ptr<const Matrix> o = out;
-  grid_ = make_shared<Grid>(mol_, o);
+  grid_ = make_shared<Grid>(mol_, o, max_block_, box_edge_, basis_thresh_);
 
-  cout <<  "    * Grid points: " << size << endl << endl;
+  if (print_)
+    cout <<  "    * Grid points: " << size << endl << endl;
 }
 
 
 // grid without 'pruning'. Becke's original mapping
-BLGrid::BLGrid(const size_t nrad, const size_t nang, shared_ptr<const Molecule> mol) : DFTGrid_base(mol) {
+BLGrid::BLGrid(const size_t nrad, const size_t nang, shared_ptr<const Molecule> mol, shared_ptr<const PTree> idata) : DFTGrid_base(mol, idata) {
   // construct Lebedev grid
   unique_ptr<double[]> x(new double[nang]);
   unique_ptr<double[]> y(new double[nang]);
@@ -413,11 +430,11 @@ BLGrid::BLGrid(const size_t nrad, const size_t nang, shared_ptr<const Molecule>
 
   add_grid(nrad, nang, r_ch, w_ch, x, y, z, w);
   remove_redgrid();
-  grid_->init();
+  grid_->init(print_);
 }
 
 
-TALGrid::TALGrid(const size_t nrad, const size_t nang, shared_ptr<const Molecule> mol) : DFTGrid_base(mol) {
+TALGrid::TALGrid(const size_t nrad, const size_t nang, shared_ptr<const Molecule> mol, shared_ptr<const PTree> idata) : DFTGrid_base(mol, idata) {
   // construct Lebedev grid
   unique_ptr<double[]> x(new double[nang]);
   unique_ptr<double[]> y(new double[nang]);
@@ -438,11 +455,11 @@ TALGrid::TALGrid(const size_t nrad, const size_t nang, shared_ptr<const Molecule
 
   add_grid(nrad, nang, r_ch, w_ch, x, y, z, w);
   remove_redgrid();
-  grid_->init();
+  grid_->init(print_);
 }
 
 
-DefaultGrid::DefaultGrid(shared_ptr<const Molecule> mol) : DFTGrid_base(mol) {
+DefaultGrid::DefaultGrid(shared_ptr<const Molecule> mol, shared_ptr<const PTree> idata) : DFTGrid_base(mol, idata) {
   // the default radial grid has 75 points
   const int nrad = 75;
   // construct Chebyshev grid
@@ -482,5 +499,5 @@ DefaultGrid::DefaultGrid(shared_ptr<const Molecule> mol) : DFTGrid_base(mol) {
   }
 
   remove_redgrid();
-  grid_->init();
+  grid_->init(print_);
 }
@@ -27,6 +27,7 @@
 
 #include <src/scf/ks/xcfunc.h>
 #include <src/scf/ks/grid.h>
+#include <src/util/input/input.h>
 
 namespace bagel {
 
@@ -38,15 +39,21 @@ class DFTGrid_base {
     // TODO to be controlled by the input deck
     constexpr static double grid_thresh_ = 1.0e-10;
 
+    // parameters of the grid blocks (see Grid), read from the input. Grids that are made without input are not printed
+    size_t max_block_;
+    double box_edge_;
+    double basis_thresh_;
+    bool print_;
+
     void add_grid(const int nrad, const int nang, const std::unique_ptr<double[]>& r_ch, const std::unique_ptr<double[]>& w_ch,
                   const std::unique_ptr<double[]>& x, const std::unique_ptr<double[]>& y, const std::unique_ptr<double[]>& z, const std::unique_ptr<double[]>& w);
     void remove_redgrid();
 
-    std::vector<std::shared_ptr<const Matrix>> compute_rho_sigma(std::shared_ptr<const XCFunc> func, std::shared_ptr<const Matrix> mat,
-                                                    std::unique_ptr<double[]>& rho, std::unique_ptr<double[]>& sigma,
-                                                    std::unique_ptr<double[]>& rhox, std::unique_ptr<double[]>& rhoy, std::unique_ptr<double[]>& rhoz) const;
+    // densities on the points of a block. cmat is the significant part of the coefficient matrix. Returns the orbitals (and their gradients)
+    std::vector<std::shared_ptr<const Matrix>> compute_rho_sigma(std::shared_ptr<const XCFunc> func, std::shared_ptr<const Matrix> cmat, std::shared_ptr<const GridBlock> block,
+                                                                 double* rho, double* sigma, double* rhox, double* rhoy, double* rhoz) const;
   public:
-    DFTGrid_base(std::shared_ptr<const Molecule> mol) : mol_(mol) { }
+    DFTGrid_base(std::shared_ptr<const Molecule> mol, std::shared_ptr<const PTree> idata = nullptr);
 
     std::tuple<std::shared_ptr<const Matrix>,double> compute_xc(std::shared_ptr<const XCFunc> func, std::shared_ptr<const Matrix> mat) const;
     std::shared_ptr<const GradFile> compute_xcgrad(std::shared_ptr<const XCFunc> func, std::shared_ptr<const Matrix> mat) const;
@@ -59,19 +66,19 @@ class DFTGrid_base {
 // Becke-Chebyshev-Lebedev
 class BLGrid : public DFTGrid_base {
   public:
-    BLGrid(const size_t nrad, const size_t nang, std::shared_ptr<const Molecule> mol);
+    BLGrid(const size_t nrad, const size_t nang, std::shared_ptr<const Molecule> mol, std::shared_ptr<const PTree> idata = nullptr);
 };
 
 // Treutler-Ahlrichs-Chebyshev-Lebedev
 class TALGrid : public DFTGrid_base {
   public:
-    TALGrid(const size_t nrad, const size_t nang, std::shared_ptr<const Molecule> mol);
+    TALGrid(const size_t nrad, const size_t nang, std::shared_ptr<const Molecule> mol, std::shared_ptr<const PTree> idata = nullptr);
 };
 
 // Pruned Grid
 class DefaultGrid : public DFTGrid_base {
   public:
-    DefaultGrid(std::shared_ptr<const Molecule> mol);
+    DefaultGrid(std::shared_ptr<const Molecule> mol, std::shared_ptr<const PTree> idata = nullptr);
 };
 
 }
@@ -22,102 +22,177 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <map>
 #include <src/scf/ks/grid.h>
 #include <src/util/taskqueue.h>
 #include <src/util/parallel/resources.h>
 
-namespace bagel {
-class GridBasisTask {
-  protected:
-    double* const a;
-    double* const b;
-    double* const c;
-    double* const d;
-    const double x;
-    const double y;
-    const double z;
-    std::shared_ptr<const Molecule> mol_;
-  public:
-    GridBasisTask(double* aa, double* bb, double* cc, double* dd, const double xx, const double yy, const double zz, std::shared_ptr<const Molecule> g)
-    : a(aa), b(bb), c(cc), d(dd), x(xx), y(yy), z(zz), mol_(g) { }
-    void compute() {
-      int pos = 0;
-      for (auto& i : mol_->atoms()) {
-        // xyz coordinate relative to the atom i
-        const double rx = x - i->position(0);
-        const double ry = y - i->position(1);
-        const double rz = z - i->position(2);
-        for (auto& j : i->shells()) {
-          j->compute_grid_value(a+pos, b+pos, c+pos, d+pos, rx, ry, rz);
-          pos += j->nbasis();
-        }
-      }
-    }
-};
-class GridDeriv2Task {
-  protected:
-    double* const a;
-    double* const b;
-    double* const c;
-    double* const d;
-    double* const e;
-    double* const f;
-    const double x;
-    const double y;
-    const double z;
-    std::shared_ptr<const Molecule> mol_;
-  public:
-    GridDeriv2Task(double* aa, double* bb, double* cc, double* dd, double* ee, double* ff,
-                   const double xx, const double yy, const double zz, std::shared_ptr<const Molecule> g)
-    : a(aa), b(bb), c(cc), d(dd), e(ee), f(ff), x(xx), y(yy), z(zz), mol_(g) { }
-    void compute() {
-      int pos = 0;
-      for (auto& i : mol_->atoms()) {
-        // xyz coordinate relative to the atom i
-        const double rx = x - i->position(0);
-        const double ry = y - i->position(1);
-        const double rz = z - i->position(2);
-        for (auto& j : i->shells()) {
-          j->compute_grid_value_deriv2(a+pos, b+pos, c+pos, d+pos, e+pos, f+pos, rx, ry, rz);
-          pos += j->nbasis();
-        }
-      }
-    }
-};
+using namespace std;
+using namespace bagel;
+
+GridBlock::GridBlock(vector<size_t>&& points, const vector<pair<shared_ptr<const Shell>, size_t>>& shells) : points_(move(points)), nfunc_(0) {
+  for (auto& i : shells) {
+    shells_.push_back(i.first);
+    offsets_.push_back(i.second);
+    const size_t n = i.first->nbasis();
+    if (!ranges_.empty() && ranges_.back().first + ranges_.back().second == i.second)
+      ranges_.back().second += n;
+    else
+      ranges_.emplace_back(i.second, n);
+    nfunc_ += n;
+  }
 }
 
 
-using namespace std;
-using namespace bagel;
+void GridBlock::allocate(shared_ptr<SharedMemory> mem, const size_t offset) {
+  const size_t n = nfunc_ * size() * sizeof(double);
+  basis_ = make_shared<Matrix>(nfunc_, size(), mem, offset, true);
+  gradx_ = make_shared<Matrix>(nfunc_, size(), mem, offset + n, true);
+  grady_ = make_shared<Matrix>(nfunc_, size(), mem, offset + 2*n, true);
+  gradz_ = make_shared<Matrix>(nfunc_, size(), mem, offset + 3*n, true);
+}
+
 
-void Grid::init() {
-  const int ngrid = size();
-  basis_ = make_shared<Matrix>(mol_->nbasis(), ngrid);
-  gradx_ = make_shared<Matrix>(mol_->nbasis(), ngrid);
-  grady_ = make_shared<Matrix>(mol_->nbasis(), ngrid);
-  gradz_ = make_shared<Matrix>(mol_->nbasis(), ngrid);
-
-  // TODO I guess this should be more efficient..
-  TaskQueue<GridBasisTask> tasks(ngrid);
-  for (size_t g = 0; g != ngrid; ++g) {
-    tasks.emplace_back(basis_->element_ptr(0,g), gradx_->element_ptr(0,g), grady_->element_ptr(0,g), gradz_->element_ptr(0,g),
-                                  data_->element(0,g), data_->element(1,g), data_->element(2,g), mol_);
+void GridBlock::compute(shared_ptr<const Matrix> data) {
+  if (!basis_) {
+    basis_ = make_shared<Matrix>(nfunc_, size(), true);
+    gradx_ = make_shared<Matrix>(nfunc_, size(), true);
+    grady_ = make_shared<Matrix>(nfunc_, size(), true);
+    gradz_ = make_shared<Matrix>(nfunc_, size(), true);
+  } else {
+    // memory given to allocate() is not initialized
+    basis_->zero();
+    gradx_->zero();
+    grady_->zero();
+    gradz_->zero();
+  }
+
+  for (size_t i = 0; i != size(); ++i) {
+    const double x = data->element(0, points_[i]);
+    const double y = data->element(1, points_[i]);
+    const double z = data->element(2, points_[i]);
+    size_t pos = 0;
+    for (auto& j : shells_) {
+      // xyz coordinate relative to the center of the shell
+      j->compute_grid_value(basis_->element_ptr(pos, i), gradx_->element_ptr(pos, i), grady_->element_ptr(pos, i), gradz_->element_ptr(pos, i),
+                            x - j->position(0), y - j->position(1), z - j->position(2));
+      pos += j->nbasis();
+    }
   }
-  tasks.compute();
 }
 
 
-array<shared_ptr<Matrix>,6> Grid::compute_grad2() const {
+array<shared_ptr<Matrix>,6> GridBlock::compute_grad2(shared_ptr<const Matrix> data) const {
   array<shared_ptr<Matrix>,6> out;
   for (auto& i : out)
-   i = make_shared<Matrix>(mol_->nbasis(), size());
+    i = make_shared<Matrix>(nfunc_, size(), true);
 
-  TaskQueue<GridDeriv2Task> tasks(size());
-  for (size_t g = 0; g != size(); ++g) {
-    tasks.emplace_back(out[0]->element_ptr(0,g), out[1]->element_ptr(0,g), out[2]->element_ptr(0,g),
-                                   out[3]->element_ptr(0,g), out[4]->element_ptr(0,g), out[5]->element_ptr(0,g),
-                                   data_->element(0,g), data_->element(1,g), data_->element(2,g), mol_);
+  for (size_t i = 0; i != size(); ++i) {
+    const double x = data->element(0, points_[i]);
+    const double y = data->element(1, points_[i]);
+    const double z = data->element(2, points_[i]);
+    size_t pos = 0;
+    for (auto& j : shells_) {
+      j->compute_grid_value_deriv2(out[0]->element_ptr(pos, i), out[1]->element_ptr(pos, i), out[2]->element_ptr(pos, i),
+                                   out[3]->element_ptr(pos, i), out[4]->element_ptr(pos, i), out[5]->element_ptr(pos, i),
+                                   x - j->position(0), y - j->position(1), z - j->position(2));
+      pos += j->nbasis();
+    }
+  }
+  return out;
+}
+
+
+shared_ptr<Matrix> GridBlock::gather(const Matrix& mat) const {
+  auto out = make_shared<Matrix>(nfunc_, mat.mdim(), true);
+  for (size_t j = 0; j != mat.mdim(); ++j) {
+    size_t pos = 0;
+    for (auto& r : ranges_) {
+      copy_n(mat.element_ptr(r.first, j), r.second, out->element_ptr(pos, j));
+      pos += r.second;
+    }
   }
-  tasks.compute();
   return out;
 }
+
+
+void GridBlock::scatter_add(const Matrix& sub, Matrix& out) const {
+  assert(sub.ndim() == nfunc_ && sub.mdim() == nfunc_);
+  size_t jpos = 0;
+  for (auto& rj : ranges_) {
+    for (size_t j = 0; j != rj.second; ++j) {
+      size_t ipos = 0;
+      for (auto& ri : ranges_) {
+        blas::ax_plus_y_n(1.0, sub.element_ptr(ipos, jpos+j), ri.second, out.element_ptr(ri.first, rj.first+j));
+        ipos += ri.second;
+      }
+    }
+    jpos += rj.second;
+  }
+}
+
+
+void Grid::init(const bool print) {
+  // sort the points into boxes, each of which is split into blocks of at most max_block_ points
+  map<array<long,3>, vector<size_t>> boxes;
+  for (size_t g = 0; g != size(); ++g)
+    boxes[array<long,3>{{lround(floor(data_->element(0,g)/box_edge_)), lround(floor(data_->element(1,g)/box_edge_)),
+                         lround(floor(data_->element(2,g)/box_edge_))}}].push_back(g);
+
+  // radial extent of the shells (and offsets in the AO basis)
+  vector<tuple<shared_ptr<const Shell>, size_t, double>> shells;
+  size_t offset = 0;
+  for (auto& i : mol_->atoms())
+    for (auto& j : i->shells()) {
+      shells.emplace_back(j, offset, j->grid_extent(basis_thresh_));
+      offset += j->nbasis();
+    }
+
+  blocks_.clear();
+  size_t nstored = 0;
+  for (auto& box : boxes) {
+    const vector<size_t>& points = box.second;
+    for (size_t start = 0; start < points.size(); start += max_block_) {
+      vector<size_t> bpoints(points.begin()+start, points.begin()+min(start+max_block_, points.size()));
+
+      // bounding sphere of the block
+      array<double,3> center{{0.0, 0.0, 0.0}};
+      for (auto& g : bpoints)
+        for (int k = 0; k != 3; ++k)
+          center[k] += data_->element(k, g) / bpoints.size();
+      double radius = 0.0;
+      for (auto& g : bpoints)
+        radius = max(radius, sqrt(pow(data_->element(0,g)-center[0], 2) + pow(data_->element(1,g)-center[1], 2) + pow(data_->element(2,g)-center[2], 2)));
+
+      vector<pair<shared_ptr<const Shell>, size_t>> sig;
+      for (auto& s : shells) {
+        const shared_ptr<const Shell>& sh = get<0>(s);
+        const double dist = sqrt(pow(sh->position(0)-center[0], 2) + pow(sh->position(1)-center[1], 2) + pow(sh->position(2)-center[2], 2));
+        if (dist - radius < get<2>(s))
+          sig.emplace_back(sh, get<1>(s));
+      }
+      if (sig.empty()) continue;
+      blocks_.push_back(make_shared<GridBlock>(move(bpoints), sig));
+      nstored += blocks_.back()->nfunc() * blocks_.back()->size();
+    }
+  }
+
+  // basis functions are stored once per node; the processes on a node evaluate them for different blocks
+  auto mem = make_shared<SharedMemory>(4 * nstored * sizeof(double));
+  size_t moffset = 0;
+  for (auto& b : blocks_) {
+    b->allocate(mem, moffset);
+    moffset += 4 * b->nfunc() * b->size() * sizeof(double);
+  }
+
+  TaskQueue<function<void(void)>> tasks(blocks_.size());
+  for (size_t i = 0; i != blocks_.size(); ++i)
+    if (i % mem->node_size() == static_cast<size_t>(mem->node_rank()))
+      tasks.emplace_back([this, i]() { blocks_[i]->compute(data_); });
+  tasks.compute();
+  mem->fence();
+
+  if (print)
+    cout << "    * " << blocks_.size() << " grid blocks; " << setprecision(1) << fixed
+         << 100.0 * nstored / max(mol_->nbasis() * size(), static_cast<size_t>(1)) << "% of the basis values are significant" << endl << endl;
+}
@@ -27,37 +27,85 @@
 
 #include <array>
 #include <memory>
+#include <vector>
 #include <src/molecule/molecule.h>
 #include <src/util/math/xyzfile.h>
 
 namespace bagel {
 
-class Grid {
+// A batch of spatially close grid points. Basis functions (and their gradients) are stored only for the shells
+// whose radial extent reaches the batch, so that the storage and the contractions scale linearly with the system size.
+class GridBlock {
   protected:
-    const std::shared_ptr<const Molecule> mol_;
-    const std::shared_ptr<const Matrix> data_; // x,y,z,weight
+    // indices of the points in the parent grid
+    std::vector<size_t> points_;
+    // significant shells in the AO order, the same functions given as contiguous (offset, size) ranges in the AO basis,
+    // and their total number
+    std::vector<std::shared_ptr<const Shell>> shells_;
+    std::vector<size_t> offsets_;
+    std::vector<std::pair<size_t, size_t>> ranges_;
+    size_t nfunc_;
 
-    // basis functions and derivaties on this grid
+    // values on the points (nfunc x npoint)
     std::shared_ptr<Matrix> basis_;
     std::shared_ptr<Matrix> gradx_;
     std::shared_ptr<Matrix> grady_;
     std::shared_ptr<Matrix> gradz_;
 
   public:
-    Grid(std::shared_ptr<const Molecule> g, std::shared_ptr<const Matrix>& o)
-      : mol_(g), data_(o) { assert(data_->ndim() == 4); }
+    // shells are given with their offsets in the AO basis
+    GridBlock(std::vector<size_t>&& points, const std::vector<std::pair<std::shared_ptr<const Shell>, size_t>>& shells);
+
+    const std::vector<size_t>& points() const { return points_; }
+    size_t point(const size_t i) const { return points_[i]; }
+    size_t size() const { return points_.size(); }
+    const std::vector<std::shared_ptr<const Shell>>& shells() const { return shells_; }
+    const std::vector<size_t>& offsets() const { return offsets_; }
+    const std::vector<std::pair<size_t, size_t>>& ranges() const { return ranges_; }
+    size_t nfunc() const { return nfunc_; }
 
     std::shared_ptr<const Matrix> basis() const { return basis_; }
     std::shared_ptr<const Matrix> gradx() const { return gradx_; }
     std::shared_ptr<const Matrix> grady() const { return grady_; }
     std::shared_ptr<const Matrix> gradz() const { return gradz_; }
+
+    // places the basis functions and gradients in memory shared by the processes on a node (4*nfunc*size elements at offset)
+    void allocate(std::shared_ptr<SharedMemory> mem, const size_t offset);
+    // evaluates basis functions and gradients on the points
+    void compute(std::shared_ptr<const Matrix> data);
+    // second derivatives (xx, xy, yy, xz, yz, zz) on the points
+    std::array<std::shared_ptr<Matrix>,6> compute_grad2(std::shared_ptr<const Matrix> data) const;
+
+    // significant rows of a matrix whose row index runs over AOs
+    std::shared_ptr<Matrix> gather(const Matrix& mat) const;
+    // adds a (nfunc x nfunc) matrix to the corresponding elements of an AO matrix
+    void scatter_add(const Matrix& sub, Matrix& out) const;
+};
+
+
+class Grid {
+  protected:
+    const std::shared_ptr<const Molecule> mol_;
+    const std::shared_ptr<const Matrix> data_; // x,y,z,weight
+
+    // batches of grid points with basis functions and derivatives on them
+    std::vector<std::shared_ptr<GridBlock>> blocks_;
+
+    // maximum number of points in a block, edge of the boxes into which points are sorted, and screening threshold of basis functions
+    const size_t max_block_;
+    const double box_edge_;
+    const double basis_thresh_;
+
+  public:
+    Grid(std::shared_ptr<const Molecule> g, std::shared_ptr<const Matrix>& o, const size_t max_block = 128, const double box_edge = 2.0, const double basis_thresh = 1.0e-12)
+      : mol_(g), data_(o), max_block_(max_block), box_edge_(box_edge), basis_thresh_(basis_thresh) { assert(data_->ndim() == 4); }
+
+    const std::vector<std::shared_ptr<GridBlock>>& blocks() const { return blocks_; }
     const double& weight(const size_t i) const { return data_->element(3,i); }
     size_t size() const { return data_->mdim(); }
     std::shared_ptr<const Matrix> data() const { return data_; }
 
-    std::array<std::shared_ptr<Matrix>,6> compute_grad2() const;
-
-    void init();
+    void init(const bool print = true);
 
 };
 
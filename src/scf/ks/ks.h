@@ -51,7 +51,7 @@ class KS : public SCF_base {
       func_ = std::make_shared<XCFunc>(name_);
 
       Timer preptime;
-      grid_ = std::make_shared<DefaultGrid>(geom);
+      grid_ = std::make_shared<DefaultGrid>(geom, idata);
       preptime.tick_print("DFT grid generation");
 
       std::cout << std::endl;
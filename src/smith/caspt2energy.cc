@@ -28,6 +28,7 @@
 #include <src/grad/cpcasscf.h>
 #include <src/grad/gradeval.h>
 #include <src/grad/finite.h>
+#include <src/grad/finitediff.h>
 #include <src/multi/casscf/cassecond.h>
 #include <src/multi/casscf/casnoopt.h>
 #include <src/multi/casscf/qvec.h>
@@ -126,7 +127,6 @@ shared_ptr<GradFile> FiniteNacm<CASPT2Energy>::compute() {
   const int nclosed = ref_->nclosed();
   const int nocc = ref_->nocc();
 
-  Timer timer;
   muffle_ = make_shared<Muffle>("finite.log");
 
   auto grad = make_shared<GradFile>(natom);
@@ -141,96 +141,55 @@ shared_ptr<GradFile> FiniteNacm<CASPT2Energy>::compute() {
   auto idata_out = std::make_shared<PTree>(*idata_);
   idata_out->put("_target", target_state1_);
   idata_out->put("_target2", target_state2_);
-
-  const int ncomm = mpi__->size() / nproc_;
-  const int npass = (natom * 3 - 1) / ncomm + 1;
-
-  for (int ipass = 0; ipass != npass; ++ipass) {
-    const int ncolor = min(ncomm, natom*3-ncomm*ipass);
-    const int icomm = mpi__->rank() % ncolor;
-    mpi__->split(ncolor);
-
-    const int counter = icomm + ncomm * ipass;
-    const int i = counter / 3;
-    const int j = counter % 3;
-
-    muffle_->mute();
-    shared_ptr<Dvec> civ_plus;
-    shared_ptr<Matrix> coeff_plus;
-    {
-      auto displ = make_shared<XYZFile>(natom);
-      displ->element(j,i) = dx_;
-      auto geom_plus = make_shared<Geometry>(*geom_, displ, idata_, false, false);
-      geom_plus->print_atoms();
-
-      shared_ptr<const Reference> ref_plus;
-      if (ref_)
-        ref_plus = ref_->project_coeff(geom_plus);
-
-      task_ = std::make_shared<CASPT2Energy>(idata_out, geom_plus, ref_plus);
+  // CI vectors of the neighbouring geometry are used as a guess
+  idata_out->put("_ci_guess", true);
+
+  // quantities to be differentiated: CI coefficients of target_state2_ and MO coefficients, both phase-matched to the reference
+  const int lena = civ_ref->det()->lena();
+  const int lenb = civ_ref->det()->lenb();
+  const size_t cisize = lena*lenb;
+  const size_t nvalue = cisize + coeff_ref->size();
+
+  FiniteDiff fd(geom_, ref_, idata_, dx_, nproc_, npoint_);
+  shared_ptr<const Matrix> deriv = fd.compute(
+    [&](shared_ptr<const Geometry> geom, shared_ptr<const Reference> ref) {
+      task_ = std::make_shared<CASPT2Energy>(idata_out, geom, ref);
       task_->compute();
-      ref_plus  = task_->conv_to_ref();
-
-      coeff_plus = make_shared<Matrix>(*task_->coeff());
+      ref = task_->conv_to_ref();
 
+      auto coeff = make_shared<Matrix>(*task_->coeff());
       for (int im = 0; im != coeff_ref->mdim(); ++im) {
-        double dmatch = blas::dot_product(coeff_ref->element_ptr(0, im), coeff_ref->ndim(), coeff_plus->element_ptr(0,im));
+        double dmatch = blas::dot_product(coeff_ref->element_ptr(0, im), coeff_ref->ndim(), coeff->element_ptr(0,im));
         if (dmatch < 0.0) {
-          blas::scale_n(-1.0, coeff_plus->element_ptr(0, im), coeff_ref->ndim());
+          blas::scale_n(-1.0, coeff->element_ptr(0, im), coeff_ref->ndim());
         }
       }
 
-      civ_plus = ref_plus->civectors()->copy();
-      civ_plus->rotate(task_->msrot());
-      civ_plus->match(civ_ref);
-    }
-
-    shared_ptr<Dvec> civ_minus;
-    shared_ptr<Matrix> coeff_minus;
-    {
-      auto displ = make_shared<XYZFile>(natom);
-      displ->element(j,i) = -dx_;
-      auto geom_minus = make_shared<Geometry>(*geom_, displ, idata_, false, false);
-      geom_minus->print_atoms();
+      shared_ptr<Dvec> civ = ref->civectors()->copy();
+      civ->rotate(task_->msrot());
+      civ->match(civ_ref);
 
-      shared_ptr<const Reference> ref_minus;
-      if (ref_)
-        ref_minus = ref_->project_coeff(geom_minus);
+      vector<double> values(nvalue);
+      copy_n(civ->data(target_state2_)->data(), cisize, values.begin());
+      copy_n(coeff->data(), coeff->size(), values.begin()+cisize);
+      return make_pair(ref, values);
+    }, nvalue, muffle_);
 
-      task_ = std::make_shared<CASPT2Energy>(idata_out, geom_minus, ref_minus);
-      task_->compute();
-      ref_minus  = task_->conv_to_ref();
-
-      coeff_minus = make_shared<Matrix>(*task_->coeff());
-
-      for (int im = 0; im != coeff_ref->mdim(); ++im) {
-        double dmatch = blas::dot_product(coeff_ref->element_ptr(0, im), coeff_ref->ndim(), coeff_minus->element_ptr(0,im));
-        if (dmatch < 0.0) {
-          blas::scale_n(-1.0, coeff_minus->element_ptr(0, im), coeff_ref->ndim());
-        }
-      }
-
-      civ_minus = ref_minus->civectors()->copy();
-      civ_minus->rotate(task_->msrot());
-      civ_minus->match(civ_ref);
-    }
+  auto Smn = make_shared<Overlap>(geom_);
+  for (int counter = 0; counter != natom*3; ++counter) {
+    const int i = counter / 3;
+    const int j = counter % 3;
 
-    auto civ_diff = civ_plus->copy();
-    *civ_diff -= *civ_minus;
-    civ_diff->scale(1.0 / (2.0 * dx_));
-    civ_diff->print(/*sort=*/false);
-    auto coeff_diff = make_shared<Matrix>(*coeff_plus - *coeff_minus);
-    coeff_diff->scale(1.0 / (2.0 * dx_));
+    const double* civ_diff = deriv->element_ptr(0, counter);
+    auto coeff_diff = make_shared<Matrix>(coeff_ref->ndim(), coeff_ref->mdim());
+    copy_n(deriv->element_ptr(cisize, counter), coeff_diff->size(), coeff_diff->data());
     auto acoeff_diff = make_shared<Matrix>(coeff_diff->slice(nclosed, nocc));
 
-    auto Smn = make_shared<Overlap>(geom_);
     auto Uij = make_shared<Matrix>(*acoeff_ref % *Smn * *acoeff_diff);
     if (mpi__->rank() == 0) {
-      grad->element(j,i) = civ_ref->data(target_state1_)->dot_product(civ_diff->data(target_state2_));
+      grad->element(j,i) = blas::dot_product(civ_ref->data(target_state1_)->data(), cisize, civ_diff);
       for (int ii = 0; ii != norb; ++ii) {
         for (int ij = 0; ij != norb; ++ij) {
-          const int lena = civ_ref->det()->lena();
-          const int lenb = civ_ref->det()->lenb();
           if (ii != ij) {
             for (auto& iter : civ_ref->det()->phia(ii, ij)) {
               size_t iaA = iter.source;
@@ -269,10 +228,6 @@ shared_ptr<GradFile> FiniteNacm<CASPT2Energy>::compute() {
         }
       }
     }
-    muffle_->unmute();
-    mpi__->merge();
-    stringstream ss; ss << "Finite difference evaluation (" << setw(2) << i*3+j+1 << " / " << geom_->natom() * 3 << ")";
-    timer.tick_print(ss.str());
   }
 
   grad->allreduce();
@@ -80,7 +80,7 @@ void K2ext<complex<double>>::init() {
 
   // Aux index blocking
   const IndexRange aux(info_->geom()->df()->adist_now());
-  const size_t astart = info_->geom()->df()->block(0)->astart();
+  const size_t astart = info_->geom()->df()->block_astart();
 
   auto compute = [&, this](const bool gaunt, const bool breit) {
     // create an intermediate array
@@ -209,7 +209,7 @@ void K2ext<double>::init() {
       copy_n(df_full->block(0)->data(), bufsize, buf.get());
 
       for (auto& a : aux)
-        if (a.offset() == df->block(0)->astart())
+        if (a.offset() == df->block_astart())
           ext.put_block(buf, a, i0, i1);
     }
   }
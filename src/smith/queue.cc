@@ -32,23 +32,45 @@ using namespace std;
 using namespace bagel;
 using namespace bagel::SMITH;
 
-shared_ptr<Task> Queue::next_compute() {
-  auto i = tasklist_.begin();
-  for ( ; i != tasklist_.end(); ++i)
-    if ((*i)->ready()) break;
+void Queue::next_wave() {
+  assert(wave_.empty() && finished_.empty());
+  for (auto i = tasklist_.begin(); i != tasklist_.end(); )
+    if ((*i)->ready()) {
+      wave_.push_back(*i);
+      i = tasklist_.erase(i);
+    } else {
+      ++i;
+    }
+  TileCache::begin_phase();
+}
 
-  assert(i != tasklist_.end());
-  shared_ptr<Task> out = *i;
-  // execute
-  out->compute();
 
-  // synchronize. This only works because add_block is local...
+void Queue::finish_wave() {
+  // send the accumulated remote updates and invalidate the tile cache before synchronizing
+  TileCache::end_phase();
   mpi__->barrier();
 
   // delete dependency (to remove intermediate storages)
-  for (auto& j : tasklist_) j->delete_dep(out);
-  // delete this task from the queue
-  tasklist_.erase(i);
+  for (auto& i : finished_)
+    for (auto& j : tasklist_)
+      j->delete_dep(i);
+  finished_.clear();
+}
+
+
+shared_ptr<Task> Queue::next_compute() {
+  if (wave_.empty())
+    next_wave();
+
+  assert(!wave_.empty());
+  shared_ptr<Task> out = wave_.front();
+  wave_.pop_front();
+  // execute
+  out->compute();
+  finished_.push_back(out);
+
+  if (wave_.empty())
+    finish_wave();
   return out;
 }
 
@@ -41,9 +41,19 @@
 namespace bagel {
 namespace SMITH {
 
+// Tasks are executed in waves: all the tasks that are ready at the beginning of a wave do not depend on each other,
+// so that they are computed one after another without synchronization. Processes are synchronized once per wave
+// (instead of once per task), after which the dependencies on the finished tasks are released. Remote tiles are
+// cached during a wave (see TileCache in storage.h).
 class Queue {
   protected:
     std::list<std::shared_ptr<Task>> tasklist_;
+    // tasks in the current wave, and those that have been computed in this wave
+    std::list<std::shared_ptr<Task>> wave_;
+    std::list<std::shared_ptr<Task>> finished_;
+
+    void next_wave();
+    void finish_wave();
 
   public:
     Queue() {}
@@ -58,7 +68,7 @@ class Queue {
         tasklist_.push_back(i);
     }
 
-    bool done() const { return tasklist_.empty(); }
+    bool done() const { return tasklist_.empty() && wave_.empty(); }
 
     void initialize() {
       for (auto& i : tasklist_) i->initialize();
@@ -255,13 +255,11 @@ vector<shared_ptr<MultiTensor_<complex<double>>>> RelCASA::RelCASA::solve_linear
 
 #ifndef DISABLE_SERIALIZATION
       if (info_->restart() && (conv || (info_->restart_each_iter() && iter > 0))) {
-        string arch = "RelCASA_";
-        if (mpi__->rank() == 0)
-          arch += "t2_" + to_string(i) + (conv ? "_converged" : "_iter_" + to_string(iter));
-        else
-          arch += "temp_trash";
+        // the amplitudes are written by all the processes into a single binary container
+        const string binary = "RelCASA_t2_" + to_string(i) + (conv ? "_converged" : "_iter_" + to_string(iter));
+        const string arch = mpi__->rank() == 0 ? binary : "RelCASA_temp_trash";
         {
-          OArchive archive(arch);
+          OArchive archive(arch, binary);
           archive << t2all_[i];
         }
         mpi__->barrier();
@@ -285,13 +285,11 @@ vector<shared_ptr<MultiTensor_<complex<double>>>> RelCASPT2::RelCASPT2::solve_li
 
 #ifndef DISABLE_SERIALIZATION
       if (info_->restart() && (conv || (info_->restart_each_iter() && iter > 0))) {
-        string arch = "RelCASPT2_";
-        if (mpi__->rank() == 0)
-          arch += "t2_" + to_string(i) + (conv ? "_converged" : "_iter_" + to_string(iter));
-        else
-          arch += "temp_trash";
+        // the amplitudes are written by all the processes into a single binary container
+        const string binary = "RelCASPT2_t2_" + to_string(i) + (conv ? "_converged" : "_iter_" + to_string(iter));
+        const string arch = mpi__->rank() == 0 ? binary : "RelCASPT2_temp_trash";
         {
-          OArchive archive(arch);
+          OArchive archive(arch, binary);
           archive << t2all_[i];
         }
         mpi__->barrier();
@@ -50,6 +50,8 @@ SMITH_Info<DataType>::SMITH_Info(shared_ptr<const Reference> o, const shared_ptr
   maxiter_ = idata->get<int>("maxiter", 50);
   maxtile_ = idata->get<int>("maxtile", 10);
   cimaxchunk_ = idata->get<int>("cimaxchunk", 317520001);
+  // in MB
+  tile_cache_ = idata->get<double>("tile_cache", 256.0) * (1lu << 20);
 
   do_ms_   = idata->get<bool>("ms",  true);
   do_xms_  = idata->get<bool>("xms", true);
@@ -119,7 +121,7 @@ template<typename DataType>
 SMITH_Info<DataType>::SMITH_Info(shared_ptr<const Reference> o, shared_ptr<const SMITH_Info> info)
   : ref_(o), method_(info->method_), ncore_(info->ncore_), nfrozenvirt_(info->nfrozenvirt_), thresh_(info->thresh_), shift_(info->shift_),
     maxiter_(info->maxiter_), maxtile_(info->maxtile_),
-    cimaxchunk_(info->cimaxchunk_), davidson_subspace_(info->davidson_subspace_), grad_(info->grad_),
+    cimaxchunk_(info->cimaxchunk_), davidson_subspace_(info->davidson_subspace_), tile_cache_(info->tile_cache_), grad_(info->grad_),
     do_ms_(info->do_ms_), do_xms_(info->do_xms_), sssr_(info->sssr_),
     shift_diag_(info->shift_diag_), shift_imag_(info->shift_imag_), block_diag_fock_(info->block_diag_fock_), orthogonal_basis_(info->orthogonal_basis_), restart_(info->restart_),
     restart_each_iter_(info->restart_each_iter_), convergence_throw_(info->convergence_throw_), thresh_overlap_(info->thresh_overlap_),
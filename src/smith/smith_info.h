@@ -48,6 +48,8 @@ class SMITH_Info {
     int maxtile_;
     size_t cimaxchunk_;
     int davidson_subspace_;
+    // memory budget for the remote tile cache in bytes
+    size_t tile_cache_;
 
     bool grad_;
 
@@ -77,15 +79,18 @@ class SMITH_Info {
     // serialization
     friend class boost::serialization::access;
     template<class Archive>
-    void serialize(Archive& ar, const unsigned int) {
+    void serialize(Archive& ar, const unsigned int version) {
       ar & ref_ & method_ & ncore_ & nfrozenvirt_ & thresh_ & shift_ & maxiter_;
       ar & maxtile_ & cimaxchunk_ & davidson_subspace_ & grad_;
       ar & do_ms_ & do_xms_ & sssr_ & shift_diag_ & shift_imag_ & block_diag_fock_ & orthogonal_basis_ & restart_ & restart_each_iter_ & convergence_throw_;
       ar & thresh_overlap_ & state_begin_ & restart_iter_ & aniso_data_ & external_rdm_;
+      // archives written before version 1 do not store the tile cache size
+      if (version > 0)
+        ar & tile_cache_;
     }
 
   public:
-    SMITH_Info() { }
+    SMITH_Info() : tile_cache_(256lu << 20) { }
     SMITH_Info(std::shared_ptr<const Reference> o, const std::shared_ptr<const PTree> idata);
     SMITH_Info(std::shared_ptr<const Reference> o, std::shared_ptr<const SMITH_Info> info);
 
@@ -111,6 +116,7 @@ class SMITH_Info {
     int maxiter() const { return maxiter_; }
     int maxtile() const { return maxtile_; }
     int cimaxchunk() const { return cimaxchunk_; }
+    size_t tile_cache() const { return tile_cache_; }
     bool grad() const { return grad_; }
     bool do_ms() const { return do_ms_; }
     bool do_xms() const { return do_xms_; }
@@ -192,5 +198,8 @@ extern template class SMITH_Info<std::complex<double>>;
 #include <src/util/archive.h>
 BOOST_CLASS_EXPORT_KEY(bagel::SMITH_Info<double>)
 BOOST_CLASS_EXPORT_KEY(bagel::SMITH_Info<std::complex<double>>)
+#include <boost/serialization/version.hpp>
+BOOST_CLASS_VERSION(bagel::SMITH_Info<double>, 1)
+BOOST_CLASS_VERSION(bagel::SMITH_Info<std::complex<double>>, 1)
 
 #endif
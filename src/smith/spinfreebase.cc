@@ -41,6 +41,7 @@ SpinFreeMethod<DataType>::SpinFreeMethod(shared_ptr<const SMITH_Info<DataType>>
                 "illegal DataType for SpinFreeMethod");
 
   Timer timer;
+  TileCache::set_budget(info_->tile_cache());
   const int max = info_->maxtile();
   if (info_->ncore() > info_->nclosed())
     throw runtime_error("frozen core has been specified but there are not enough closed orbitals");
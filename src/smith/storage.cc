@@ -38,9 +38,42 @@
 using namespace bagel::SMITH;
 using namespace std;
 
+bool TileCache::active_ = false;
+size_t TileCache::budget_ = 256lu << 20;
+size_t TileCache::used_ = 0lu;
+set<TileCache*> TileCache::registry_;
+TileCache::LRUList TileCache::lru_;
+
+
+void TileCache::reserve(const size_t bytes) {
+  while (!lru_.empty() && used_ + bytes > budget_)
+    lru_.back().first->evict(lru_.back().second);
+  // pending updates cannot be evicted; they are sent instead
+  if (used_ + bytes > budget_)
+    for (auto& i : registry_)
+      i->flush();
+}
+
+
+void TileCache::set_budget(const size_t bytes) {
+  budget_ = bytes;
+  reserve(0lu);
+}
+
+
+void TileCache::end_phase() {
+  for (auto& i : registry_)
+    i->flush();
+  while (!lru_.empty())
+    lru_.back().first->evict(lru_.back().second);
+  assert(used_ == 0lu);
+  active_ = false;
+}
+
+
 // size contains hashkey and length (in this order)
 template<typename DataType>
-StorageIncore<DataType>::StorageIncore(const map<size_t, size_t>& size, bool init) : RMAWindow<DataType>() {
+StorageIncore<DataType>::StorageIncore(const map<size_t, size_t>& size, bool init) : RMAWindow<DataType>(), pending_size_(0lu) {
   static_assert(is_same<DataType, double>::value or is_same<DataType, complex<double>>::value, "illegal Type in StorageIncore");
 
   // first prepare some variables
@@ -78,163 +111,306 @@ StorageIncore<DataType>::StorageIncore(const map<size_t, size_t>& size, bool ini
 }
 
 
+template<typename DataType>
+StorageIncore<DataType>::~StorageIncore() {
+  if (!pending_.empty())
+    flush();
+  while (!cache_.empty())
+    evict(cache_.begin()->first);
+}
+
+
+template<typename DataType>
+StorageIncore<DataType>& StorageIncore<DataType>::operator=(const StorageIncore<DataType>& o) {
+  // cached tiles and pending updates are not copied
+  if (!pending_.empty())
+    flush();
+  while (!cache_.empty())
+    evict(cache_.begin()->first);
+  totalsize_ = o.totalsize_;
+  hashtable_ = o.hashtable_;
+  blocks_ = o.blocks_;
+  local_lo_ = o.local_lo_;
+  local_hi_ = o.local_hi_;
+  RMAWindow<DataType>::operator=(o);
+  return *this;
+}
+
+
+template<typename DataType>
+void StorageIncore<DataType>::evict(const size_t key) {
+  auto iter = cache_.find(key);
+  assert(iter != cache_.end());
+  used_ -= get<2>(locate(key)) * sizeof(DataType);
+  lru_.erase(iter->second.second);
+  cache_.erase(iter);
+}
+
+
+template<typename DataType>
+void StorageIncore<DataType>::flush() {
+  for (auto& i : pending_) {
+    // issue all the updates to this process, then wait until they are completed on the target
+    vector<shared_ptr<RMATask<DataType>>> requests;
+    for (auto& j : i.second) {
+      size_t rank, off, size;
+      tie(rank, off, size) = locate(j.first);
+      requests.push_back(this->rma_radd(j.second.get(), rank, off, size));
+      // a cached copy would no longer see this update
+      if (cache_.count(j.first))
+        evict(j.first);
+    }
+    for (auto& j : requests)
+      if (j) j->wait();
+    this->fence(i.first);
+  }
+  pending_.clear();
+  used_ -= pending_size_;
+  pending_size_ = 0lu;
+}
+
+
+template<typename DataType>
+unique_ptr<DataType[]> StorageIncore<DataType>::get_tile(const size_t key) const {
+  size_t rank, off, size;
+  tie(rank, off, size) = locate(key);
+  if (!active_ || rank == static_cast<size_t>(mpi__->rank()) || budget_ == 0lu)
+    return rma_get(rank, off, size);
+
+  unique_ptr<DataType[]> out(new DataType[size]);
+  auto iter = cache_.find(key);
+  if (iter != cache_.end()) {
+    lru_.splice(lru_.begin(), lru_, iter->second.second);
+    copy_n(iter->second.first.get(), size, out.get());
+  } else {
+    // room is made before reading, as this may send pending updates to this tile
+    const size_t bytes = size * sizeof(DataType);
+    if (bytes <= budget_)
+      reserve(bytes);
+    rma_get(out.get(), rank, off, size);
+    if (bytes <= budget_) {
+      unique_ptr<DataType[]> tile(new DataType[size]);
+      copy_n(out.get(), size, tile.get());
+      lru_.emplace_front(const_cast<StorageIncore<DataType>*>(this), key);
+      cache_.emplace(key, make_pair(move(tile), lru_.begin()));
+      used_ += bytes;
+    }
+  }
+
+  // updates from this process that have not been sent yet
+  auto p = pending_.find(rank);
+  if (p != pending_.end()) {
+    auto q = p->second.find(key);
+    if (q != p->second.end())
+      blas::ax_plus_y_n(DataType(1.0), q->second.get(), size, out.get());
+  }
+  return out;
+}
+
+
+template<typename DataType>
+void StorageIncore<DataType>::put_tile(const unique_ptr<DataType[]>& dat, const size_t key) {
+  size_t rank, off, size;
+  tie(rank, off, size) = locate(key);
+  if (active_ && rank != static_cast<size_t>(mpi__->rank())) {
+    if (cache_.count(key))
+      evict(key);
+    auto p = pending_.find(rank);
+    if (p != pending_.end() && p->second.erase(key)) {
+      pending_size_ -= size * sizeof(DataType);
+      used_ -= size * sizeof(DataType);
+    }
+  }
+  rma_put(dat.get(), rank, off, size);
+}
+
+
+template<typename DataType>
+void StorageIncore<DataType>::add_tile(const unique_ptr<DataType[]>& dat, const size_t key) {
+  size_t rank, off, size;
+  tie(rank, off, size) = locate(key);
+  const size_t bytes = size * sizeof(DataType);
+  if (!active_ || rank == static_cast<size_t>(mpi__->rank()) || bytes > budget_) {
+    rma_add(dat.get(), rank, off, size);
+    return;
+  }
+
+  auto p = pending_.find(rank);
+  if (p != pending_.end()) {
+    auto iter = p->second.find(key);
+    if (iter != p->second.end()) {
+      blas::ax_plus_y_n(DataType(1.0), dat.get(), size, iter->second.get());
+      return;
+    }
+  }
+
+  // pending updates share the budget with the cached tiles (reserve may send all the pending updates)
+  reserve(bytes);
+  unique_ptr<DataType[]> buf(new DataType[size]);
+  copy_n(dat.get(), size, buf.get());
+  pending_[rank].emplace(key, move(buf));
+  pending_size_ += bytes;
+  used_ += bytes;
+}
+
+
 template<typename DataType>
 unique_ptr<DataType[]> StorageIncore<DataType>::get_block() const {
-  return rma_get(generate_hash_key());
+  return get_tile(generate_hash_key());
 }
 
 template<typename DataType>
 unique_ptr<DataType[]> StorageIncore<DataType>::get_block(const Index& i0) const {
-  return rma_get(generate_hash_key(i0));
+  return get_tile(generate_hash_key(i0));
 }
 
 template<typename DataType>
 unique_ptr<DataType[]> StorageIncore<DataType>::get_block(const Index& i0, const Index& i1) const {
-  return rma_get(generate_hash_key(i0, i1));
+  return get_tile(generate_hash_key(i0, i1));
 }
 
 template<typename DataType>
 unique_ptr<DataType[]> StorageIncore<DataType>::get_block(const Index& i0, const Index& i1, const Index& i2) const {
-  return rma_get(generate_hash_key(i0, i1, i2));
+  return get_tile(generate_hash_key(i0, i1, i2));
 }
 
 template<typename DataType>
 unique_ptr<DataType[]> StorageIncore<DataType>::get_block(const Index& i0, const Index& i1, const Index& i2, const Index& i3) const {
-  return rma_get(generate_hash_key(i0, i1, i2, i3));
+  return get_tile(generate_hash_key(i0, i1, i2, i3));
 }
 
 template<typename DataType>
 unique_ptr<DataType[]> StorageIncore<DataType>::get_block(const Index& i0, const Index& i1, const Index& i2, const Index& i3,
                                                           const Index& i4) const {
-  return rma_get(generate_hash_key(i0, i1, i2, i3, i4));
+  return get_tile(generate_hash_key(i0, i1, i2, i3, i4));
 }
 
 template<typename DataType>
 unique_ptr<DataType[]> StorageIncore<DataType>::get_block(const Index& i0, const Index& i1, const Index& i2, const Index& i3,
                                                           const Index& i4, const Index& i5) const {
-  return rma_get(generate_hash_key(i0, i1, i2, i3, i4, i5));
+  return get_tile(generate_hash_key(i0, i1, i2, i3, i4, i5));
 }
 
 template<typename DataType>
 unique_ptr<DataType[]> StorageIncore<DataType>::get_block(const Index& i0, const Index& i1, const Index& i2, const Index& i3,
                                                           const Index& i4, const Index& i5, const Index& i6) const {
-  return rma_get(generate_hash_key(i0, i1, i2, i3, i4, i5, i6));
+  return get_tile(generate_hash_key(i0, i1, i2, i3, i4, i5, i6));
 }
 
 template<typename DataType>
 unique_ptr<DataType[]> StorageIncore<DataType>::get_block(const Index& i0, const Index& i1, const Index& i2, const Index& i3,
                                                           const Index& i4, const Index& i5, const Index& i6, const Index& i7) const {
-  return rma_get(generate_hash_key(i0, i1, i2, i3, i4, i5, i6, i7));
+  return get_tile(generate_hash_key(i0, i1, i2, i3, i4, i5, i6, i7));
 }
 
 template<typename DataType>
 unique_ptr<DataType[]> StorageIncore<DataType>::get_block(vector<Index> i) const {
-  return rma_get(generate_hash_key(i));
+  return get_tile(generate_hash_key(i));
 }
 
 
 template<typename DataType>
 void StorageIncore<DataType>::put_block(const unique_ptr<DataType[]>& dat) {
-  rma_put(dat, generate_hash_key());
+  put_tile(dat, generate_hash_key());
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::put_block(const unique_ptr<DataType[]>& dat, const Index& i0) {
-  rma_put(dat, generate_hash_key(i0));
+  put_tile(dat, generate_hash_key(i0));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::put_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1) {
-  rma_put(dat, generate_hash_key(i0, i1));
+  put_tile(dat, generate_hash_key(i0, i1));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::put_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1, const Index& i2) {
-  rma_put(dat, generate_hash_key(i0, i1, i2));
+  put_tile(dat, generate_hash_key(i0, i1, i2));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::put_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1, const Index& i2, const Index& i3) {
-  rma_put(dat, generate_hash_key(i0, i1, i2, i3));
+  put_tile(dat, generate_hash_key(i0, i1, i2, i3));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::put_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1, const Index& i2, const Index& i3,
                                                                            const Index& i4) {
-  rma_put(dat, generate_hash_key(i0, i1, i2, i3, i4));
+  put_tile(dat, generate_hash_key(i0, i1, i2, i3, i4));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::put_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1, const Index& i2, const Index& i3,
                                                                            const Index& i4, const Index& i5) {
-  rma_put(dat, generate_hash_key(i0, i1, i2, i3, i4, i5));
+  put_tile(dat, generate_hash_key(i0, i1, i2, i3, i4, i5));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::put_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1, const Index& i2, const Index& i3,
                                                                            const Index& i4, const Index& i5, const Index& i6) {
-  rma_put(dat, generate_hash_key(i0, i1, i2, i3, i4, i5, i6));
+  put_tile(dat, generate_hash_key(i0, i1, i2, i3, i4, i5, i6));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::put_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1, const Index& i2, const Index& i3,
                                                                            const Index& i4, const Index& i5, const Index& i6, const Index& i7) {
-  rma_put(dat, generate_hash_key(i0, i1, i2, i3, i4, i5, i6, i7));
+  put_tile(dat, generate_hash_key(i0, i1, i2, i3, i4, i5, i6, i7));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::put_block(const unique_ptr<DataType[]>& dat, vector<Index> i) {
-  rma_put(dat, generate_hash_key(i));
+  put_tile(dat, generate_hash_key(i));
 }
 
 
 template<typename DataType>
 void StorageIncore<DataType>::add_block(const unique_ptr<DataType[]>& dat) {
-  rma_add(dat, generate_hash_key());
+  add_tile(dat, generate_hash_key());
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::add_block(const unique_ptr<DataType[]>& dat, const Index& i0) {
-  rma_add(dat, generate_hash_key(i0));
+  add_tile(dat, generate_hash_key(i0));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::add_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1) {
-  rma_add(dat, generate_hash_key(i0, i1));
+  add_tile(dat, generate_hash_key(i0, i1));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::add_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1, const Index& i2) {
-  rma_add(dat, generate_hash_key(i0, i1, i2));
+  add_tile(dat, generate_hash_key(i0, i1, i2));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::add_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1, const Index& i2, const Index& i3) {
-  rma_add(dat, generate_hash_key(i0, i1, i2, i3));
+  add_tile(dat, generate_hash_key(i0, i1, i2, i3));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::add_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1, const Index& i2, const Index& i3,
                                                                            const Index& i4) {
-  rma_add(dat, generate_hash_key(i0, i1, i2, i3, i4));
+  add_tile(dat, generate_hash_key(i0, i1, i2, i3, i4));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::add_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1, const Index& i2, const Index& i3,
                                                                            const Index& i4, const Index& i5) {
-  rma_add(dat, generate_hash_key(i0, i1, i2, i3, i4, i5));
+  add_tile(dat, generate_hash_key(i0, i1, i2, i3, i4, i5));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::add_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1, const Index& i2, const Index& i3,
                                                                            const Index& i4, const Index& i5, const Index& i6) {
-  rma_add(dat, generate_hash_key(i0, i1, i2, i3, i4, i5, i6));
+  add_tile(dat, generate_hash_key(i0, i1, i2, i3, i4, i5, i6));
 }
 
 template<typename DataType>
 void StorageIncore<DataType>::add_block(const unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1, const Index& i2, const Index& i3,
                                                                            const Index& i4, const Index& i5, const Index& i6, const Index& i7) {
-  rma_add(dat, generate_hash_key(i0, i1, i2, i3, i4, i5, i6, i7));
+  add_tile(dat, generate_hash_key(i0, i1, i2, i3, i4, i5, i6, i7));
 }
 
 
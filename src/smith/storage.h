@@ -31,6 +31,7 @@
 #define __SRC_SMITH_STORAGE_H
 
 #include <map>
+#include <set>
 #include <unordered_map>
 #include <list>
 #include <cassert>
@@ -39,6 +40,7 @@
 #include <src/smith/indexrange.h>
 #include <src/util/parallel/mpi_interface.h>
 #include <src/util/parallel/rmawindow.h>
+#include <src/util/io/binarchive.h>
 
 namespace bagel {
 namespace SMITH {
@@ -83,8 +85,47 @@ namespace {
 }
 
 
+// Remote tiles read during a wave of the task queue (see queue.h) are cached on each process up to a memory budget,
+// evicting the least recently used tiles first. Remote add_block calls are accumulated locally and sent per target process;
+// they count towards the same budget and are sent early when it would be exceeded. Both are flushed at the end of the wave;
+// tensors that are read in a wave are not modified by other tasks in the same wave.
+// Outside of waves tiles are read and written directly.
+class TileCache {
+  protected:
+    using LRUList = std::list<std::pair<TileCache*, size_t>>;
+
+    static bool active_;
+    // budget and current usage in bytes
+    static size_t budget_;
+    static size_t used_;
+    static std::set<TileCache*> registry_;
+    // (storage, key) of the cached tiles; most recently used first
+    static LRUList lru_;
+
+    // makes room for a tile of the given size by evicting cached tiles and, if that is not enough, sending pending updates
+    static void reserve(const size_t bytes);
+
+    // removes a tile from the cache
+    virtual void evict(const size_t key) = 0;
+    // sends pending updates to other processes
+    virtual void flush() = 0;
+
+  public:
+    TileCache() { registry_.insert(this); }
+    virtual ~TileCache() { registry_.erase(this); }
+
+    static bool active() { return active_; }
+    static size_t budget() { return budget_; }
+    static void set_budget(const size_t bytes);
+
+    static void begin_phase() { active_ = true; }
+    // flushes pending updates and invalidates all cached tiles. Should be followed by a barrier
+    static void end_phase();
+};
+
+
 template<typename DataType>
-class StorageIncore : public RMAWindow<DataType> {
+class StorageIncore : public RMAWindow<DataType>, public TileCache {
   public:
     using RMAWindow<DataType>::initialize;
     using RMAWindow<DataType>::initialized;
@@ -104,6 +145,20 @@ class StorageIncore : public RMAWindow<DataType> {
     size_t local_lo_;
     size_t local_hi_;
 
+    // cached remote tiles
+    mutable std::unordered_map<size_t, std::pair<std::unique_ptr<DataType[]>, LRUList::iterator>> cache_;
+    // pending remote updates (process -> key -> data)
+    std::map<size_t, std::unordered_map<size_t, std::unique_ptr<DataType[]>>> pending_;
+    size_t pending_size_;
+
+    void evict(const size_t key) override;
+    void flush() override;
+
+    // all the block access goes through these functions
+    std::unique_ptr<DataType[]> get_tile(const size_t key) const;
+    void put_tile(const std::unique_ptr<DataType[]>& dat, const size_t key);
+    void add_tile(const std::unique_ptr<DataType[]>& dat, const size_t key);
+
   private:
     // serialization
     friend class boost::serialization::access;
@@ -119,6 +174,13 @@ class StorageIncore : public RMAWindow<DataType> {
         hashtable_ordered.emplace(i);
       ar << RMAWindow<DataType>::initialized_ << totalsize_ << hashtable_ordered;
 
+      // Each process writes its local data into the binary container. Tiles are stored in the global order
+      if (BinaryOArchive* binary = BinaryOArchive::attached(ar)) {
+        const bool init = initialized();
+        binary->put_distributed(init ? this->local_data() : nullptr, init ? localsize() : 0lu);
+        return;
+      }
+
       // Process 0 collects and saves tensor's contents, tile by tile
       // Other processes do nothing; this requires them to be writing to a different file from Process 0
       if (mpi__->rank() == 0) {
@@ -165,6 +227,18 @@ class StorageIncore : public RMAWindow<DataType> {
       if (init)
         initialize();
 
+      // Each process reads its own part, which need not be the same as the one written by this process
+      if (BinaryIArchive* binary = BinaryIArchive::attached(ar)) {
+        auto in = binary->get<DataType>();
+        if (init && localsize()) {
+          assert(in.second == totalsize_);
+          std::copy_n(in.first + local_lo_, localsize(), this->win_base_);
+          this->fence_local();
+        }
+        mpi__->barrier();
+        return;
+      }
+
       // All processes read the whole archive, and save the data that belong to them
       for (auto& i : hashtable_ordered) {
         size_t rank, off, size;
@@ -178,8 +252,11 @@ class StorageIncore : public RMAWindow<DataType> {
     }
 
   public:
-    StorageIncore() { }
+    StorageIncore() : pending_size_(0lu) { }
     StorageIncore(const std::map<size_t, size_t>& size, bool init);
+    ~StorageIncore();
+
+    StorageIncore<DataType>& operator=(const StorageIncore<DataType>& o);
 
     // required functions by RMAWindow
     bool is_local(const size_t key) const override;
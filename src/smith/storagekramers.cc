@@ -33,7 +33,7 @@ using namespace std;
 
 template<typename DataType>
 unique_ptr<DataType[]> StorageKramers<DataType>::get_block() const {
-  return RMAWindow<DataType>::rma_get(generate_hash_key());
+  return this->get_tile(generate_hash_key());
 }
 
 template<typename DataType>
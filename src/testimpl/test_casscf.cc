@@ -63,6 +63,8 @@ BOOST_AUTO_TEST_SUITE(TEST_CASSCF)
 
 BOOST_AUTO_TEST_CASE(DF_CASSCF) {
     BOOST_CHECK(compare(cas_energy("h2o_svp_cas"),          -76.00368392));
+    BOOST_CHECK(compare(cas_energy("h2o_svp_cas_disk"),     -76.00368392));
+    BOOST_CHECK(compare(cas_energy("h2o_svp_cas_sym"),      -76.00368392));
     BOOST_CHECK(compare(cas_energy("lif_svp_cas22"),        -106.70563743));
     BOOST_CHECK(compare(cas_energy("li2_tzvpp_cas43"),      -14.87300366));
     BOOST_CHECK(compare(cas_energy("lih_tzvpp_cas22"),      -7.98191070));
@@ -108,6 +108,7 @@ BOOST_AUTO_TEST_CASE(KNOWLES_HANDY) {
 //  BOOST_CHECK(compare(fci_energy("hf_sto3g_fci_restart"), reference_fci_energy()));
 #endif
     BOOST_CHECK(compare(fci_energy("hhe_svp_fci_kh_trip"), reference_fci_energy2()));
+    BOOST_CHECK(compare(fci_energy("hf_sto3g_fci_kh_sym")[0], reference_fci_energy()[0]));
 }
 
 BOOST_AUTO_TEST_CASE(HARRISON_ZARRABIAN) {
@@ -110,6 +110,7 @@ BOOST_AUTO_TEST_CASE(Deriv_Coup) {
 
 BOOST_AUTO_TEST_CASE(Finite_Grad) {
     BOOST_CHECK(compare(run_force("hf_mix_dfhf_finite"),     reference_scf_finite_mix(), 1.0e-5));
+    BOOST_CHECK(compare(run_force("hf_mix_dfhf_finite4"),    reference_scf_finite_mix(), 1.0e-5));
     BOOST_CHECK(compare(run_force("hf_svp_mp2_aux_finite"),  reference_svp_mp2_aux_finite(), 1.0e-5));
 #ifdef COMPILE_SMITH
     BOOST_CHECK(compare(run_force("lif_svp_xmscaspt2_finite"), reference_xms_finite(), 1.0e-5));
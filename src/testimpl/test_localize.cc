@@ -23,8 +23,10 @@
 //
 
 #include <sstream>
+#include <algorithm>
 #include <src/wfn/reference.h>
 #include <src/wfn/localization.h>
+#include <src/util/math/jacobi.h>
 
 using namespace bagel;
 
@@ -60,6 +62,8 @@ double localization(std::string filename) {
       }
       else if (localizemethod == "pm" || localizemethod == "pipek" || localizemethod == "mezey" || localizemethod == "pipek-mezey")
         localization = std::make_shared<PMLocalization>(itree, ref);
+      else if (localizemethod == "boys" || localizemethod == "foster-boys")
+        localization = std::make_shared<BoysLocalization>(itree, ref);
       else throw std::runtime_error("Unrecognized orbital localization method");
 
       localization->localize();
@@ -83,4 +87,48 @@ BOOST_AUTO_TEST_CASE(REGION) {
     BOOST_CHECK(compare(localization("watertrimer_sto3g_rl"), 0.0));
 }
 
+BOOST_AUTO_TEST_CASE(BFGS) {
+    BOOST_CHECK(compare(localization("benzene_sto3g_pml_bfgs"), localization("benzene_sto3g_pml_jacobi"), 0.000001));
+    BOOST_CHECK(compare(localization("h2o_sto3g_boys_bfgs"), localization("h2o_sto3g_boys_jacobi"), 0.000001));
+}
+
+BOOST_AUTO_TEST_CASE(JACOBI) {
+    const int n = 12;
+    auto a = std::make_shared<Matrix>(n, n);
+    for (int i = 0; i != n; ++i)
+      for (int j = 0; j <= i; ++j)
+        a->element(i, j) = a->element(j, i) = std::cos(1.0 + i*j + i + 2.0*j);
+
+    // consecutive pairs share orbitals, so the batched rotations have to keep the order
+    std::vector<std::pair<int,int>> pairs;
+    for (int k = 0; k != n; ++k)
+      for (int l = k+1; l != n; ++l)
+        pairs.emplace_back(k, l);
+
+    auto input = std::make_shared<const PTree>();
+    auto a0 = a->copy();
+    auto q0 = std::make_shared<Matrix>(n, n);
+    q0->unit();
+    auto a1 = a->copy();
+    auto q1 = q0->copy();
+    JacobiDiag sequential(input, a0, q0);
+    JacobiDiag batched(input, a1, q1);
+    for (int sweep = 0; sweep != 10; ++sweep) {
+      for (auto& p : pairs)
+        sequential.rotate(p.first, p.second);
+      batched.rotate(pairs);
+    }
+    BOOST_CHECK(compare((*a0 - *a1).rms(), 0.0, 1.0e-10));
+    BOOST_CHECK(compare((*q0 - *q1).rms(), 0.0, 1.0e-10));
+
+    // the sweeps diagonalize the matrix
+    VectorB eig(n);
+    a->diagonalize(eig);
+    std::vector<double> diag(n);
+    for (int i = 0; i != n; ++i)
+      diag[i] = a0->element(i, i);
+    std::sort(diag.begin(), diag.end());
+    BOOST_CHECK(compare(diag, std::vector<double>(eig.begin(), eig.end()), 1.0e-10));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -60,6 +60,7 @@ BOOST_AUTO_TEST_SUITE(TEST_MP2)
 BOOST_AUTO_TEST_CASE(MP2) {
     BOOST_CHECK(compare(mp2_energy("benzene_svp_mp2"),      -231.31440958));
     BOOST_CHECK(compare(mp2_energy("benzene_svp_mp2_aux"),  -231.31450878));
+    BOOST_CHECK(compare(mp2_energy("benzene_svp_mp2_sos_laplace"), mp2_energy("benzene_svp_mp2_sos"), 1.0e-6));
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -71,4 +71,14 @@ BOOST_AUTO_TEST_CASE(DIRAC_FOCK) {
     BOOST_CHECK(compare(rel_energy("hf_svp_breit"),          -99.92755305));
 }
 
+BOOST_AUTO_TEST_CASE(DIRAC_FOCK_INCREMENTAL) {
+    BOOST_CHECK(compare(rel_energy("hf_svp_gaunt_incremental"), -99.92699858));
+    BOOST_CHECK(compare(rel_energy("hf_svp_breit_incremental"), -99.92755305));
+}
+
+BOOST_AUTO_TEST_CASE(DIRAC_FOCK_KRAMERS) {
+    BOOST_CHECK(compare(rel_energy("hf_svp_coulomb_kramers"),   -99.93791152));
+    BOOST_CHECK(compare(rel_energy("hf_svp_gaunt_kramers"),     -99.92699858));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
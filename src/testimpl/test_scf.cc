@@ -81,11 +81,36 @@ double scf_energy(std::string filename, std::string extension = ".json") {
   return ref->energy(0);
 }
 
+// number of doubly occupied orbitals in each irrep from symmetry-blocked RHF
+std::vector<int> rhf_nocc_irrep(std::string filename) {
+  auto ofs = std::make_shared<std::ofstream>(filename + ".testout", std::ios::trunc);
+  std::streambuf* backup_stream = std::cout.rdbuf(ofs->rdbuf());
+
+  auto idata = std::make_shared<const PTree>(location__ + filename + ".json");
+  auto keys = idata->get_child("bagel");
+  std::shared_ptr<Geometry> geom;
+  std::vector<int> out;
+  for (auto& itree : *keys) {
+    const std::string method = to_lower(itree->get<std::string>("title", ""));
+    if (method == "molecule") {
+      geom = std::make_shared<Geometry>(itree);
+    } else if (method == "hf") {
+      auto scf = std::make_shared<RHF>(itree, geom);
+      scf->compute();
+      out = scf->nocc_irrep();
+    }
+  }
+  std::cout.rdbuf(backup_stream);
+  return out;
+}
+
 BOOST_AUTO_TEST_SUITE(TEST_SCF)
 
 BOOST_AUTO_TEST_CASE(DF_HF) {
     BOOST_CHECK(compare(scf_energy("hf_svp_hf"),          -99.84779026));
+    BOOST_CHECK(compare(scf_energy("hf_svp_hf_rebuild"),  -99.84779026));
     BOOST_CHECK(compare(scf_energy("hf_svp_dfhf"),        -99.84772354));
+    BOOST_CHECK(compare(scf_energy("hf_svp_dfhf_disk"),   -99.84772354));
 #ifndef DISABLE_SERIALIZATION
     BOOST_CHECK(compare(scf_energy("hf_svp_dfhf_restart"),-99.84772354));
 #endif
@@ -100,11 +125,55 @@ BOOST_AUTO_TEST_CASE(DF_HF) {
     BOOST_CHECK(compare(scf_energy("hf_new_dfhf"),        -99.97989929));
     BOOST_CHECK(compare(scf_energy("hcl_svp_dfhf"),      -459.93784632));
     BOOST_CHECK(compare(scf_energy("cuh2_ecp_hf"),       -196.12254012));
+    BOOST_CHECK(compare(scf_energy("cuh2_ecp_hf_rot"),   -196.12254012));
     BOOST_CHECK(compare(scf_energy("hbr_ecp_sohf"),       -13.68431370));
     BOOST_CHECK(compare(scf_energy("h2o_svp_fmm"),        -151.91459783));
+    BOOST_CHECK(compare(scf_energy("h2o_svp_fmm_nocache"),-151.91459783));
 #ifndef DISABLE_SERIALIZATION
     BOOST_CHECK(compare(scf_energy("h2o_svp_fmm_restart"),-151.91459783));
 #endif
 }
 
+// C2v and D2h: symmetry-unique DF integrals and symmetry-blocked RHF against the calculation without symmetry
+BOOST_AUTO_TEST_CASE(SYMMETRY) {
+    BOOST_CHECK(compare(scf_energy("h2o_svp_dfhf_sym"), scf_energy("h2o_svp_dfhf_nosym")));
+    BOOST_CHECK(compare(scf_energy("n2_svp_dfhf_sym"),  scf_energy("n2_svp_dfhf_nosym")));
+    // irreps are ordered as a1 b1 b2 a2 and ag b3u b2u b1g b1u b2g b3g au
+    BOOST_CHECK(rhf_nocc_irrep("h2o_svp_dfhf_sym") == std::vector<int>({3, 1, 1, 0}));
+    BOOST_CHECK(rhf_nocc_irrep("n2_svp_dfhf_sym")  == std::vector<int>({3, 1, 1, 0, 2, 0, 0, 0}));
+}
+
+#ifndef DISABLE_SERIALIZATION
+// large matrices go into the binary container of the archive they are written to, and only that one
+BOOST_AUTO_TEST_CASE(BINARY_ARCHIVE) {
+    auto large = std::make_shared<Matrix>(100, 60);
+    auto small = std::make_shared<Matrix>(5, 4);
+    for (size_t j = 0; j != large->mdim(); ++j)
+      for (size_t i = 0; i != large->ndim(); ++i)
+        large->element(i, j) = std::sin(i*large->mdim() + j);
+    for (size_t j = 0; j != small->mdim(); ++j)
+      for (size_t i = 0; i != small->ndim(); ++i)
+        small->element(i, j) = std::cos(i*small->mdim() + j);
+
+    {
+      OArchive with("binary_archive_test", "binary_archive_test");
+      // opened while the other archive has a container attached
+      OArchive without("plain_archive_test");
+      with << large << small;
+      without << large << small;
+    }
+    std::shared_ptr<Matrix> large_with, small_with, large_without, small_without;
+    {
+      IArchive with("binary_archive_test");
+      IArchive without("plain_archive_test");
+      with >> large_with >> small_with;
+      without >> large_without >> small_without;
+    }
+    BOOST_CHECK(compare((*large_with - *large).norm(), 0.0));
+    BOOST_CHECK(compare((*small_with - *small).norm(), 0.0));
+    BOOST_CHECK(compare((*large_without - *large).norm(), 0.0));
+    BOOST_CHECK(compare((*small_without - *small).norm(), 0.0));
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
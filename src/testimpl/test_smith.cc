@@ -23,6 +23,7 @@
 //
 
 #include <src/wfn/reference.h>
+#include <src/smith/queue.h>
 
 std::vector<double> reference_noshift() {
   std::vector<double> out(6);
@@ -56,10 +57,44 @@ std::vector<double> reference_xms_imag() {
 }
 
 #ifdef COMPILE_SMITH
+// records the order in which the tasks are computed
+class OrderTask : public SMITH::Task {
+  protected:
+    int id_;
+    std::shared_ptr<std::vector<int>> order_;
+    void compute_() override { order_->push_back(id_); }
+  public:
+    OrderTask(const int id, std::shared_ptr<std::vector<int>> order) : id_(id), order_(order) { }
+};
+
+// diamond 0 -> (1, 2) -> 3 and an independent task 4; computed in the waves {0, 4}, {1, 2}, {3}
+std::vector<int> run_queue() {
+  auto order = std::make_shared<std::vector<int>>();
+  std::vector<std::shared_ptr<SMITH::Task>> task;
+  for (int i = 0; i != 5; ++i)
+    task.push_back(std::make_shared<OrderTask>(i, order));
+  task[1]->add_dep(task[0]);
+  task[2]->add_dep(task[0]);
+  task[3]->add_dep(task[1]);
+  task[3]->add_dep(task[2]);
+
+  SMITH::Queue queue;
+  for (auto& i : task)
+    queue.add_task(i);
+  while (!queue.done())
+    queue.next_compute();
+  return *order;
+}
+
 BOOST_AUTO_TEST_SUITE(TEST_SMITH)
 
+BOOST_AUTO_TEST_CASE(QUEUE) {
+    BOOST_CHECK(run_queue() == std::vector<int>({0, 4, 1, 2, 3}));
+}
+
 BOOST_AUTO_TEST_CASE(CASPT2_Opt) {
     BOOST_CHECK(compare(run_force("li2_svp_caspt2_grad"),    reference_noshift(),  1.0e-5));
+    BOOST_CHECK(compare(run_force("li2_svp_caspt2_tile_cache"), reference_noshift(),  1.0e-5));
     BOOST_CHECK(compare(run_force("li2_svp_caspt2_shift"),   reference_shift(),  1.0e-5));
     BOOST_CHECK(compare(run_force("lif_svp_mscaspt2_grad"),  reference_ms(),  1.0e-5));
     BOOST_CHECK(compare(run_force("lif_svp_xmscaspt2_grad"), reference_xms(), 1.0e-5));
@@ -27,10 +27,12 @@
 #define __SRC_UTIL_ARCHIVE_H
 
 #include <string>
+#include <cstdio>
 #include <fstream>
 #include <boost/archive/binary_oarchive.hpp>
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/export.hpp>
+#include <src/util/io/binarchive.h>
 
 namespace bagel {
 
@@ -42,11 +44,23 @@ class OArchive {
     using Ostream = boost::archive::binary_oarchive;
     std::shared_ptr<Ostream> archive_;
 
+    // large arrays are written into this container if present
+    std::shared_ptr<BinaryOArchive> binary_;
+
   public:
-    OArchive(std::string name) : filename_(name+".archive"), os_(filename_) {
+    // If binary is given, large arrays are written into binary.bin, in which each process writes its own data.
+    // This has to be called collectively in that case.
+    OArchive(std::string name, std::string binary = "") : filename_(name+".archive"), os_(filename_) {
       if (!os_.is_open())
         throw std::runtime_error("Error trying to create the file " + filename_ + ".  Possibly the target directory is not accessible.");
       archive_ = std::make_shared<Ostream>(os_);
+      if (!binary.empty()) {
+        binary_ = std::make_shared<BinaryOArchive>(binary);
+        BinaryOArchive::attach(*archive_, binary_.get());
+      } else {
+        // a stale container would otherwise be picked up by IArchive
+        std::remove((name+".bin").c_str());
+      }
     }
 
     template<typename T>
@@ -68,11 +82,18 @@ class IArchive {
     using Istream = boost::archive::binary_iarchive;
     std::shared_ptr<Istream> archive_;
 
+    std::shared_ptr<BinaryIArchive> binary_;
+
   public:
+    // large arrays are read from name.bin if it exists
     IArchive(std::string name) : filename_(name+".archive"), is_(filename_) {
       if (!is_.is_open())
         throw std::runtime_error("File not found: " + filename_);
       archive_ = std::make_shared<Istream>(is_);
+      if (BinaryIArchive::exists(name)) {
+        binary_ = std::make_shared<BinaryIArchive>(name);
+        BinaryIArchive::attach(*archive_, binary_.get());
+      }
     }
 
     template<typename T>
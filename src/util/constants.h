@@ -29,6 +29,7 @@
 #include <cmath>
 #include <chrono>
 #include <stddef.h>
+#include <bagel_config.h>
 
 namespace bagel {
 
@@ -72,7 +73,14 @@ static const double au2wavenumber__ = 1.0 / (2.0 * pi__ * c__ * au2meter__ * 100
 *  Numerical constants                                      *
 ************************************************************/
 static constexpr double numerical_zero__ = 1.0e-15;
+// number of bits in CI strings (i.e., maximum number of active orbitals). Set by --with-nbit at configure time
+#ifdef BAGEL_NBIT
+static constexpr unsigned int nbit__ = BAGEL_NBIT;
+#else
 static constexpr unsigned int nbit__ = 64;
+#endif
+static_assert(nbit__ % 64 == 0, "nbit__ should be a multiple of 64");
+static constexpr unsigned int nword__ = nbit__ / 64;
 
 }
 
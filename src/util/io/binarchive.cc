@@ -0,0 +1,161 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: binarchive.cc
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <src/util/io/binarchive.h>
+#include <src/util/parallel/mpi_interface.h>
+
+using namespace std;
+using namespace bagel;
+
+namespace {
+  const char magic[8] = {'B', 'A', 'G', 'E', 'L', 'B', 'I', 'N'};
+  const size_t version = 1lu;
+  // magic number, version, number of chunks, and offset of the index
+  const size_t header_size = 32lu;
+
+  size_t align(const size_t offset, const size_t bytes) {
+    const size_t unit = bytes >= (1lu << 20) ? 4096lu : 64lu;
+    return (offset + unit - 1) / unit * unit;
+  }
+}
+
+
+BinaryOArchive::BinaryOArchive(const string name) : filename_(name + ".bin"), fd_(-1), end_(header_size) {
+  // process 0 creates the file, the others open it after that
+  if (mpi__->rank() == 0)
+    fd_ = ::open(filename_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  mpi__->barrier();
+  if (mpi__->rank() != 0)
+    fd_ = ::open(filename_.c_str(), O_WRONLY);
+  if (fd_ < 0)
+    throw runtime_error("Error trying to create the file " + filename_ + ".  Possibly the target directory is not accessible.");
+}
+
+
+BinaryOArchive::~BinaryOArchive() {
+  if (mpi__->rank() == 0) {
+    const size_t nchunk = index_.size();
+    const size_t index_offset = align(end_, 0lu);
+    vector<size_t> index(nchunk*2);
+    for (size_t i = 0; i != nchunk; ++i)
+      tie(index[2*i], index[2*i+1]) = index_[i];
+    if (nchunk)
+      write(index.data(), index.size()*sizeof(size_t), index_offset);
+
+    char header[header_size];
+    memcpy(header, magic, 8);
+    memcpy(header+8, &version, sizeof(size_t));
+    memcpy(header+16, &nchunk, sizeof(size_t));
+    memcpy(header+24, &index_offset, sizeof(size_t));
+    write(header, header_size, 0lu);
+  }
+  ::close(fd_);
+  mpi__->barrier();
+}
+
+
+size_t BinaryOArchive::append(const size_t bytes) {
+  const size_t out = align(end_, bytes);
+  index_.emplace_back(out, bytes);
+  end_ = out + bytes;
+  return out;
+}
+
+
+void BinaryOArchive::write(const void* data, const size_t bytes, const size_t offset) {
+  const char* buf = static_cast<const char*>(data);
+  size_t done = 0;
+  while (done < bytes) {
+    const ssize_t n = ::pwrite(fd_, buf + done, bytes - done, offset + done);
+    if (n < 0)
+      throw runtime_error("Error writing to " + filename_);
+    done += n;
+  }
+}
+
+
+void BinaryOArchive::put_(const void* data, const size_t bytes) {
+  const size_t offset = append(bytes);
+  if (mpi__->rank() == 0)
+    write(data, bytes, offset);
+}
+
+
+void BinaryOArchive::put_distributed_(const void* data, const size_t bytes) {
+  vector<size_t> sizes(mpi__->size());
+  mpi__->allgather(&bytes, 1, sizes.data(), 1);
+  size_t total = 0lu, mine = 0lu;
+  for (int i = 0; i != mpi__->size(); ++i) {
+    if (i == mpi__->rank())
+      mine = total;
+    total += sizes[i];
+  }
+  const size_t offset = append(total);
+  write(data, bytes, offset + mine);
+}
+
+
+BinaryIArchive::BinaryIArchive(const string name) : filename_(name + ".bin"), next_(0lu) {
+  const int fd = ::open(filename_.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw runtime_error("File not found: " + filename_);
+  struct stat st;
+  fstat(fd, &st);
+  filesize_ = st.st_size;
+  if (filesize_ < header_size)
+    throw runtime_error(filename_ + " is not a valid binary archive");
+  void* map = mmap(nullptr, filesize_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (map == MAP_FAILED)
+    throw runtime_error("Error mapping the file " + filename_);
+  map_ = static_cast<char*>(map);
+
+  size_t ver, nchunk, index_offset;
+  memcpy(&ver, map_+8, sizeof(size_t));
+  memcpy(&nchunk, map_+16, sizeof(size_t));
+  memcpy(&index_offset, map_+24, sizeof(size_t));
+  if (memcmp(map_, magic, 8) != 0 || ver != version || (nchunk && index_offset + nchunk*2*sizeof(size_t) > filesize_))
+    throw runtime_error(filename_ + " is not a valid binary archive.  This error may occur when reading files generated with a different version of BAGEL.");
+
+  const size_t* index = reinterpret_cast<const size_t*>(map_ + index_offset);
+  index_.resize(nchunk);
+  for (size_t i = 0; i != nchunk; ++i)
+    index_[i] = make_pair(index[2*i], index[2*i+1]);
+}
+
+
+BinaryIArchive::~BinaryIArchive() {
+  munmap(map_, filesize_);
+}
+
+
+bool BinaryIArchive::exists(const string name) {
+  struct stat st;
+  return stat((name + ".bin").c_str(), &st) == 0;
+}
@@ -0,0 +1,117 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: binarchive.h
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Binary container for large arrays, written next to a Boost archive (see archive.h).
+// The file consists of a header (magic number, version, number of chunks, and the position of the index), the chunks,
+// and the index (offset and length of each chunk). Chunks are aligned so that the file can be memory-mapped, and are
+// identified by the order in which they are written, which is the order in which Boost visits the objects.
+// Writing and reading are collective: every process writes its own part of distributed arrays directly.
+// A container is attached to one Boost archive object through the archive's helper collection, so that
+// other archives (written or read at the same time) are not affected.
+
+#ifndef __SRC_UTIL_IO_BINARCHIVE_H
+#define __SRC_UTIL_IO_BINARCHIVE_H
+
+#include <string>
+#include <vector>
+#include <cassert>
+#include <stdexcept>
+
+namespace bagel {
+
+class BinaryOArchive {
+  protected:
+    std::string filename_;
+    int fd_;
+    // end of the file
+    size_t end_;
+    // offset and length (in bytes) of each chunk
+    std::vector<std::pair<size_t, size_t>> index_;
+
+    // returns the offset of a new chunk
+    size_t append(const size_t bytes);
+    void write(const void* data, const size_t bytes, const size_t offset);
+    void put_(const void* data, const size_t bytes);
+    void put_distributed_(const void* data, const size_t bytes);
+
+  public:
+    BinaryOArchive(const std::string name);
+    ~BinaryOArchive();
+
+    // arrays replicated on all processes (written by process 0)
+    template<typename T>
+    void put(const T* data, const size_t n) { put_(data, n*sizeof(T)); }
+    // each process writes its part; the parts are stored contiguously in the order of processes
+    template<typename T>
+    void put_distributed(const T* data, const size_t n) { put_distributed_(data, n*sizeof(T)); }
+
+    // container attached to the Boost archive ar (nullptr if none)
+    template<class Archive>
+    static BinaryOArchive* attached(Archive& ar) { return ar.template get_helper<Helper>().binary; }
+    template<class Archive>
+    static void attach(Archive& ar, BinaryOArchive* a) { ar.template get_helper<Helper>().binary = a; }
+
+    // arrays smaller than this (in elements) are written into the Boost archive
+    static const size_t min_size = 4096lu;
+
+    struct Helper { BinaryOArchive* binary = nullptr; };
+};
+
+
+class BinaryIArchive {
+  protected:
+    std::string filename_;
+    size_t filesize_;
+    // the whole file is mapped; pages are read from the disk when they are touched
+    char* map_;
+    std::vector<std::pair<size_t, size_t>> index_;
+    size_t next_;
+
+  public:
+    BinaryIArchive(const std::string name);
+    ~BinaryIArchive();
+
+    static bool exists(const std::string name);
+
+    // returns the next chunk and its length in elements
+    template<typename T>
+    std::pair<const T*, size_t> get() {
+      if (next_ >= index_.size())
+        throw std::runtime_error("Binary archive " + filename_ + " has fewer records than expected");
+      const std::pair<size_t, size_t>& chunk = index_[next_++];
+      assert(chunk.second % sizeof(T) == 0);
+      return std::make_pair(reinterpret_cast<const T*>(map_ + chunk.first), chunk.second / sizeof(T));
+    }
+
+    template<class Archive>
+    static BinaryIArchive* attached(Archive& ar) { return ar.template get_helper<Helper>().binary; }
+    template<class Archive>
+    static void attach(Archive& ar, BinaryIArchive* a) { ar.template get_helper<Helper>().binary = a; }
+
+    struct Helper { BinaryIArchive* binary = nullptr; };
+};
+
+}
+
+#endif
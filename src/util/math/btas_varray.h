@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <memory>
 #include <btas/serialization.h>
 #include <boost/serialization/split_free.hpp>
 #include <boost/serialization/array.hpp>
@@ -99,6 +100,9 @@ private:
    };
    _M_impl data_;
    size_type capacity_;
+   // set when the elements live in memory owned by another object (e.g., memory shared by the processes on a node);
+   // such memory is kept alive by this handle and never deallocated by varray
+   std::shared_ptr<void> external_;
 
    allocator_type& alloc() { return static_cast<allocator_type&>(*this); }
    const allocator_type& alloc() const { return static_cast<const allocator_type&>(*this); }
@@ -166,10 +170,14 @@ public:
    }
 
    varray (varray&& x)
-   : allocator_type(std::move(static_cast<allocator_type&&>(x))), data_(std::move(x.data_)), capacity_(x.capacity_)
+   : allocator_type(std::move(static_cast<allocator_type&&>(x))), data_(std::move(x.data_)), capacity_(x.capacity_), external_(std::move(x.external_))
    {
    }
 
+   /// wraps n elements at ptr that are owned by mem. The elements are not initialized
+   varray (std::shared_ptr<void> mem, pointer ptr, size_type n) : allocator_type(), data_(ptr, ptr+n), capacity_(n), external_(mem)
+   { }
+
    template <typename U, class = typename std::enable_if< std::is_convertible<U, value_type>::value >::type >
    varray (std::initializer_list<U> il) : capacity_(0)
    {
@@ -328,7 +336,14 @@ public:
    { return data_.data(); }
 
    void swap (varray& x)
-   { data_.swap(x.data_); }
+   {
+     data_.swap(x.data_);
+     std::swap(capacity_, x.capacity_);
+     external_.swap(x.external_);
+   }
+
+   const std::shared_ptr<void>& external () const noexcept
+   { return external_; }
 
    void clear ()
    {
@@ -347,7 +362,9 @@ public:
    }
 
    void deallocate() {
-     if (!data_.empty())
+     if (external_)
+       external_.reset();
+     else if (!data_.empty())
        allocator_traits::deallocate(alloc(), data_._M_start, capacity_);
      data_._M_start = data_._M_finish = nullptr;
      capacity_ = 0;
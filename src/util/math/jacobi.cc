@@ -45,23 +45,102 @@ void Jacobi_base::sweep() {
   }
 }
 
+bool JacobiDiag::parameters(const int k, const int l, double& t, double& c, double& s, double& rho) const {
+  const double kl = A_->element(k,l);
+  if (fabs(kl) < numerical_zero__) return false;
+
+  const double kk = A_->element(k,k);
+  const double ll = A_->element(l,l);
+
+  const double beta = 0.5*(ll - kk)/kl;
+  t = copysign(1.0,beta)/(fabs(beta) + sqrt(beta*beta + 1.0));
+  c = 1.0/(sqrt(t*t + 1.0));
+  s = c*t;
+  rho = (1.0 - c)/s;
+  return true;
+}
+
+
+void JacobiDiag::rotate(const vector<pair<int,int>>& pairs) {
+  JacobiOrdered ordered(pairs);
+  for (auto& isubsweep : ordered)
+    subsweep(isubsweep);
+}
+
+
 void JacobiDiag::subsweep(vector<pair<int,int>>& pairlist) {
-  for (auto& ipair : pairlist) rotate(ipair.first, ipair.second);
+  // Parameters of a rotation only depend on the kk, ll, and kl elements, which are not modified by rotations of the other pairs
+  vector<tuple<int, int, double, double, double, double>> params;
+  for (auto& ipair : pairlist) {
+    double t, c, s, rho;
+    if (parameters(ipair.first, ipair.second, t, c, s, rho))
+      params.emplace_back(ipair.first, ipair.second, t, c, s, rho);
+  }
+  const size_t npairs = params.size();
+  if (npairs == 0) return;
+
+  auto run = [&npairs](function<void(const size_t)> func) {
+    if (npairs > 6*resources__->max_num_threads()) {
+      TaskQueue<function<void(void)>> tq(npairs);
+      for (size_t ip = 0; ip != npairs; ++ip)
+        tq.emplace_back([&func, ip] { func(ip); });
+      tq.compute();
+    } else {
+      for (size_t ip = 0; ip != npairs; ++ip)
+        func(ip);
+    }
+  };
+
+  // A <- J^T A J, applied to the columns first and then to the rows (the 2x2 blocks are set explicitly)
+  vector<double> kl(npairs);
+  for (size_t ip = 0; ip != npairs; ++ip)
+    kl[ip] = A_->element(get<0>(params[ip]), get<1>(params[ip]));
+
+  run([&](const size_t ip) {
+    int k, l; double t, c, s, rho;
+    tie(k, l, t, c, s, rho) = params[ip];
+    double* k_column = A_->element_ptr(0,k);
+    double* l_column = A_->element_ptr(0,l);
+    for (int i = 0; i < nbasis_; ++i) {
+      if (i == k || i == l) continue;
+      const double ik = k_column[i];
+      const double il = l_column[i];
+      k_column[i] = ik - s * (il + rho * ik);
+      l_column[i] = il + s * (ik - rho * il);
+    }
+  });
+
+  run([&](const size_t ip) {
+    int k, l; double t, c, s, rho;
+    tie(k, l, t, c, s, rho) = params[ip];
+    for (int i = 0; i < nbasis_; ++i) {
+      if (i == k || i == l) continue;
+      const double ki = A_->element(k,i);
+      const double li = A_->element(l,i);
+      A_->element(k,i) = ki - s * (li + rho * ki);
+      A_->element(l,i) = li + s * (ki - rho * li);
+    }
+    A_->element(k,k) -= t * kl[ip];
+    A_->element(l,l) += t * kl[ip];
+    A_->element(k,l) = 0.0;
+    A_->element(l,k) = 0.0;
+  });
+
+  vector<tuple<int, int, double>> rotations;
+  for (auto& i : params)
+    rotations.emplace_back(get<0>(i), get<1>(i), acos(get<3>(i)));
+  Q_->rotate(rotations);
 }
 
+
 void JacobiDiag::rotate(const int k, const int l) {
-  const double kl = A_->element(k,l);
-  if (fabs(k) < numerical_zero__) return;
+  double t, c, s, rho;
+  if (!parameters(k, l, t, c, s, rho)) return;
 
+  const double kl = A_->element(k,l);
   const double kk = A_->element(k,k);
   const double ll = A_->element(l,l);
 
-  const double beta = 0.5*(ll - kk)/kl;
-  const double t = copysign(1.0,beta)/(fabs(beta) + sqrt(beta*beta + 1.0));
-  const double c = 1.0/(sqrt(t*t + 1.0));
-  const double s = c*t;
-  const double rho = (1.0 - c)/s;
-
   A_->element(k,k) = kk - t * kl;
   A_->element(l,l) = ll + t * kl;
 
@@ -101,43 +180,36 @@ void JacobiPM::subsweep(vector<pair<int,int>>& pairlist) {
   tie(pstart, pend) = dist.range(mpi__->rank());
   const size_t psize = pend - pstart;
 
-  auto right = make_shared<Matrix>(nbasis_, 2*psize, true);
-  for (size_t ip = 0; ip < psize; ++ip) {
-    copy_n(SQ_->element_ptr(0, pairlist[ip + pstart].first), nbasis_, right->element_ptr(0, 2*ip));
-    copy_n(SQ_->element_ptr(0, pairlist[ip + pstart].second), nbasis_, right->element_ptr(0, 2*ip+1));
-  }
-
-  shared_ptr<Matrix> left = ( lowdin_ ? right : make_shared<Matrix>(nbasis_, 2*psize, true) );
-  if (!lowdin_) {
-    for (size_t ip = 0; ip < psize; ++ip) {
-      copy_n(Q_->element_ptr(0, pairlist[ip + pstart].first), nbasis_, left->element_ptr(0, 2*ip));
-      copy_n(Q_->element_ptr(0, pairlist[ip + pstart].second), nbasis_, left->element_ptr(0, 2*ip+1));
-    }
-  }
-
-  Matrix P_A(2*psize, 2*psize, true);
-
   vector<double> AA(npairs, 0.0);
   vector<double> BB(npairs, 0.0);
 
-  for (auto& ibounds : atom_bounds_) {
-    const int natombasis = ibounds.second - ibounds.first;
-    const int boundstart = ibounds.first;
-
-    for (int ip = 0; ip < psize; ++ip) {
-      dgemm_("T", "N", 2, 2, natombasis, 1.0, left->element_ptr(boundstart, 2*ip), left->ndim(),
-          right->element_ptr(boundstart, 2*ip), right->ndim(), 0.0, P_A.element_ptr(2*ip,2*ip), P_A.ndim());
-
-      const int kk = 2*ip;
-      const int ll = 2*ip+1;
-
-      const double Qkl_A = 0.5 * (P_A(kk,ll) + P_A(ll,kk));
-      const double Qkminusl_A = P_A(kk,kk) - P_A(ll,ll);
-
-      AA[ip + pstart] += Qkl_A*Qkl_A - 0.25*Qkminusl_A*Qkminusl_A;
-      BB[ip + pstart] += Qkl_A*Qkminusl_A;
-    }
+  // the columns of Q_ and SQ_ are not modified until all the pairs are processed; each thread takes care of one pair
+  TaskQueue<function<void(void)>> tq(psize);
+  for (size_t ip = 0; ip < psize; ++ip) {
+    tq.emplace_back([this, ip, pstart, &pairlist, &AA, &BB] {
+      const int k = pairlist[ip + pstart].first;
+      const int l = pairlist[ip + pstart].second;
+      const Matrix& left = lowdin_ ? *SQ_ : *Q_;
+
+      for (auto& ibounds : atom_bounds_) {
+        const int natombasis = ibounds.second - ibounds.first;
+        const int boundstart = ibounds.first;
+
+        // (k,l) block of the population matrix of this atom
+        const double P_kk = ddot_(natombasis, left.element_ptr(boundstart, k), 1, SQ_->element_ptr(boundstart, k), 1);
+        const double P_lk = ddot_(natombasis, left.element_ptr(boundstart, l), 1, SQ_->element_ptr(boundstart, k), 1);
+        const double P_kl = ddot_(natombasis, left.element_ptr(boundstart, k), 1, SQ_->element_ptr(boundstart, l), 1);
+        const double P_ll = ddot_(natombasis, left.element_ptr(boundstart, l), 1, SQ_->element_ptr(boundstart, l), 1);
+
+        const double Qkl_A = 0.5 * (P_kl + P_lk);
+        const double Qkminusl_A = P_kk - P_ll;
+
+        AA[ip + pstart] += Qkl_A*Qkl_A - 0.25*Qkminusl_A*Qkminusl_A;
+        BB[ip + pstart] += Qkl_A*Qkminusl_A;
+      }
+    });
   }
+  tq.compute();
 
   mpi__->allreduce(AA.data(), AA.size());
   mpi__->allreduce(BB.data(), BB.size());
@@ -160,3 +232,35 @@ void JacobiPM::subsweep(vector<pair<int,int>>& pairlist) {
   Q_->rotate(rotations);
   SQ_->rotate(rotations);
 }
+
+void JacobiBoys::subsweep(vector<pair<int,int>>& pairlist) {
+  // same functional form as Pipek-Mezey, with the x, y, and z components in place of the atoms
+  vector<tuple<int, int, double>> rotations;
+  for (auto& ipair : pairlist) {
+    const int kk = ipair.first;
+    const int ll = ipair.second;
+
+    double Akl = 0.0;
+    double Bkl = 0.0;
+    for (auto& d : dipole_) {
+      const double Qkl = d->element(kk, ll);
+      const double Qkminusl = d->element(kk, kk) - d->element(ll, ll);
+      Akl += Qkl*Qkl - 0.25*Qkminusl*Qkminusl;
+      Bkl += Qkl*Qkminusl;
+    }
+
+    if( fabs(Bkl) < numerical_zero__ && Akl > 0.0 ) continue;
+
+    double gamma = copysign(0.25, Bkl) * acos( -Akl/hypot(Akl,Bkl) );
+
+    rotations.emplace_back(kk, ll, gamma);
+  }
+
+  Q_->rotate(rotations);
+  // the pairs are disjoint, so D <- J^T D J is applied to the columns and then to the rows
+  for (auto& d : dipole_) {
+    d->rotate(rotations);
+    d = d->transpose();
+    d->rotate(rotations);
+  }
+}
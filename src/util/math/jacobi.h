@@ -27,6 +27,7 @@
 #define __BAGEL_UTIL_JACOBI_H
 
 #include <cassert>
+#include <array>
 #include <string>
 #include <algorithm>
 #include <memory>
@@ -76,12 +77,17 @@ class JacobiDiag : public Jacobi_base {
   protected:
     std::shared_ptr<Matrix> A_; // The matrix to be diagonalized
 
+    // returns false if no rotation is needed
+    bool parameters(const int k, const int l, double& t, double& c, double& s, double& rho) const;
+    // pairs in pairlist should not share orbitals; they are rotated simultaneously
     void subsweep(std::vector<std::pair<int,int>>& pairlist) override;
 
   public:
     JacobiDiag(std::shared_ptr<const PTree> input, std::shared_ptr<Matrix> A, std::shared_ptr<Matrix> Q) : Jacobi_base(input, Q), A_(A) {};
 
     void rotate(const int k, const int l);
+    // rotates the pairs in the given order (the result is the same as calling rotate(k, l) for each pair), using threads
+    void rotate(const std::vector<std::pair<int,int>>& pairs);
 };
 
 class JacobiPM : public Jacobi_base {
@@ -101,6 +107,21 @@ class JacobiPM : public Jacobi_base {
       }
 };
 
+// Foster-Boys: maximizes sum_i |<i|r|i>|^2. The dipole integrals are kept in the MO basis and rotated with the orbitals
+class JacobiBoys : public Jacobi_base {
+  protected:
+    std::array<std::shared_ptr<Matrix>, 3> dipole_;
+
+    void subsweep(std::vector<std::pair<int,int>>& pairlist) override;
+
+  public:
+    JacobiBoys(std::shared_ptr<const PTree> input, std::shared_ptr<Matrix> coeff, const int nstart, const int norb,
+               const std::array<std::shared_ptr<const Matrix>, 3>& dipole) : Jacobi_base(input, coeff, nstart, norb) {
+      for (int i = 0; i != 3; ++i)
+        dipole_[i] = std::make_shared<Matrix>(*coeff % *dipole[i] * *coeff);
+    }
+};
+
 }
 
 #endif
@@ -28,6 +28,7 @@
 
 #include <string>
 #include <algorithm>
+#include <map>
 #include <vector>
 
 namespace bagel {
@@ -138,6 +139,25 @@ class JacobiRing : public JacobiPairs {
     }
 };
 
+// Groups a given sequence of rotations into sets of disjoint pairs, without changing the result.
+// Rotations of disjoint pairs commute, so a rotation can be moved ahead of all the rotations that do not share an orbital with it.
+class JacobiOrdered : public JacobiPairs {
+  public:
+    JacobiOrdered(const std::vector<std::pair<int, int>>& pairs) {
+      // set (subsweep) in which each orbital was last rotated
+      std::map<int, int> last;
+      for (auto& p : pairs) {
+        auto i = last.find(p.first);
+        auto j = last.find(p.second);
+        const int isub = std::max(i == last.end() ? -1 : i->second, j == last.end() ? -1 : j->second) + 1;
+        if (isub == static_cast<int>(fullsweep_.size()))
+          fullsweep_.emplace_back();
+        fullsweep_[isub].push_back(p);
+        last[p.first] = last[p.second] = isub;
+      }
+    }
+};
+
 }
 
 #endif
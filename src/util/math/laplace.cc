@@ -0,0 +1,104 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: laplace.cc
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#include <cmath>
+#include <cassert>
+#include <stdexcept>
+#include <src/util/math/laplace.h>
+#include <src/util/math/matrix.h>
+
+using namespace std;
+using namespace bagel;
+
+LaplaceQuadrature::LaplaceQuadrature(const double xmin, const double xmax, const double thresh, const int maxpoints) : error_(1.0) {
+  if (xmin <= 0.0 || xmax < xmin)
+    throw runtime_error("LaplaceQuadrature requires 0 < xmin <= xmax");
+
+  // in terms of y = x/xmin
+  const double range = max(xmax/xmin, 1.0+1.0e-8);
+  const int nlo = 8;
+  const int nhi = 10;
+
+  for (int n = 1; n <= maxpoints && error_ > thresh; ++n) {
+    vector<double> t, w;
+    for (int ilo = 0; ilo != nlo; ++ilo) {
+      for (int ihi = 0; ihi != nhi; ++ihi) {
+        // the smallest exponent is O(1/range), the largest O(n)
+        const double lo = log(0.2/range) + ilo*log(10.0)/(nlo-1);
+        const double hi = log(0.4) + ihi*log(5.0*n)/(nhi-1);
+        const double error = fit(n, range, lo, hi, t, w);
+        if (error < error_) {
+          error_ = error;
+          t_ = t;
+          w_ = w;
+        }
+      }
+    }
+  }
+
+  for (auto& i : t_) i /= xmin;
+  for (auto& i : w_) i /= xmin;
+}
+
+
+double LaplaceQuadrature::fit(const int n, const double range, const double lo, const double hi, vector<double>& t, vector<double>& w) const {
+  const int nsample = 120;
+  t.resize(n);
+  w.resize(n);
+  for (int k = 0; k != n; ++k)
+    t[k] = exp(n == 1 ? 0.5*(lo+hi) : lo + (hi-lo)*k/(n-1));
+
+  // least-squares fit of y sum_k w_k exp(-t_k y) = 1 on a logarithmic grid
+  Matrix a(nsample, n, true);
+  for (int k = 0; k != n; ++k)
+    for (int s = 0; s != nsample; ++s) {
+      const double y = pow(range, static_cast<double>(s)/(nsample-1));
+      a(s, k) = y * exp(-t[k]*y);
+    }
+  VectorB sing(n);
+  shared_ptr<Matrix> u, vt;
+  tie(u, vt) = a.svd(sing.data());
+
+  fill(w.begin(), w.end(), 0.0);
+  for (int k = 0; k != n; ++k) {
+    if (sing(k) < 1.0e-13*sing(0)) break;
+    double ub = 0.0;
+    for (int s = 0; s != nsample; ++s)
+      ub += u->element(s, k);
+    for (int l = 0; l != n; ++l)
+      w[l] += vt->element(k, l) * ub / sing(k);
+  }
+
+  // error on a finer grid
+  double error = 0.0;
+  for (int s = 0; s != 4*nsample; ++s) {
+    const double y = pow(range, static_cast<double>(s)/(4*nsample-1));
+    double sum = 0.0;
+    for (int k = 0; k != n; ++k)
+      sum += w[k] * exp(-t[k]*y);
+    error = max(error, fabs(y*sum - 1.0));
+  }
+  return error;
+}
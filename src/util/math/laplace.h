@@ -0,0 +1,57 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: laplace.h
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#ifndef __SRC_UTIL_MATH_LAPLACE_H
+#define __SRC_UTIL_MATH_LAPLACE_H
+
+#include <vector>
+
+namespace bagel {
+
+// Quadrature for the Laplace transform of orbital-energy denominators, 1/x = sum_k w_k exp(-t_k x) for x in [xmin, xmax].
+// The exponents are geometrically spaced; their range is optimized on a grid and the weights are obtained by least squares.
+// The number of points is increased until the maximum relative error falls below the threshold.
+class LaplaceQuadrature {
+  protected:
+    std::vector<double> t_;
+    std::vector<double> w_;
+    // maximum relative error of 1/x on [xmin, xmax]
+    double error_;
+
+    // fits 1/y on [1, range] with n points whose exponents are between exp(lo) and exp(hi); returns the maximum relative error
+    double fit(const int n, const double range, const double lo, const double hi, std::vector<double>& t, std::vector<double>& w) const;
+
+  public:
+    LaplaceQuadrature(const double xmin, const double xmax, const double thresh, const int maxpoints = 24);
+
+    int size() const { return t_.size(); }
+    double t(const int i) const { return t_[i]; }
+    double w(const int i) const { return w_[i]; }
+    double error() const { return error_; }
+};
+
+}
+
+#endif
@@ -57,6 +57,23 @@ Matrix::Matrix(Matrix&& o) : Matrix_base<double>(move(o)), std::enable_shared_fr
 }
 
 
+Matrix::Matrix(const int n, const int m, shared_ptr<SharedMemory> mem, const size_t offset, const bool loc)
+ : Matrix_base<double>(n, m, mem, offset, loc), std::enable_shared_from_this<Matrix>() {
+}
+
+
+shared_ptr<const Matrix> Matrix::node_copy() const {
+  if (mpi__->node_size() == 1)
+    return make_shared<Matrix>(*this);
+  auto mem = make_shared<SharedMemory>(size()*sizeof(double));
+  auto out = make_shared<Matrix>(ndim(), mdim(), mem, 0lu, localized_);
+  if (mem->writer())
+    copy_n(data(), size(), out->data());
+  mem->fence();
+  return out;
+}
+
+
 #ifdef HAVE_SCALAPACK
 Matrix::Matrix(const DistMatrix& o) : Matrix_base<double>(o.ndim(), o.mdim()), std::enable_shared_from_this<Matrix>() {
   setlocal_(o.local());
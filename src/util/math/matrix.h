@@ -59,9 +59,13 @@ class Matrix : public Matrix_base<double>, public std::enable_shared_from_this<M
     Matrix(const Matrix&);
     Matrix(const MatView&);
     Matrix(Matrix&&);
+    Matrix(const int n, const int m, std::shared_ptr<SharedMemory> mem, const size_t offset = 0, const bool localized = true);
     Matrix() { }
     virtual ~Matrix() { }
 
+    // read-only copy that is stored once per node and read by all the processes on it (collective)
+    std::shared_ptr<const Matrix> node_copy() const;
+
     std::shared_ptr<Matrix> cut(const int nstart, const int nend) const { return get_submatrix(nstart, 0, nend-nstart, mdim()); }
     std::shared_ptr<Matrix> slice_copy(const int mstart, const int mend) const { return get_submatrix(0, mstart, ndim(), mend-mstart); }
     std::shared_ptr<Matrix> resize(const int n, const int m) const { return this->resize_impl<Matrix>(n, m); }
@@ -75,6 +75,22 @@ Matrix_base<DataType>::Matrix_base(Matrix_base&& o) : btas::Tensor2<DataType>(fo
 }
 
 
+template<typename DataType>
+Matrix_base<DataType>::Matrix_base(const size_t n, const size_t m, shared_ptr<SharedMemory> mem, const size_t offset, const bool local) : localized_(local) {
+  assert(offset + n*m*sizeof(DataType) <= mem->size());
+  varray<DataType> storage(mem, reinterpret_cast<DataType*>(mem->data() + offset), n*m);
+  this->storage().swap(storage);
+  // the storage has the right size, so nothing is allocated here
+  this->resize(btas::CRange<2>(n, m));
+#ifdef HAVE_SCALAPACK
+  if (!localized_) {
+    desc_ = mpi__->descinit(ndim(), mdim());
+    localsize_ = mpi__->numroc(ndim(), mdim());
+  }
+#endif
+}
+
+
 template<typename DataType>
 Matrix_base<DataType>& Matrix_base<DataType>::operator=(const Matrix_base<DataType>& o) {
   btas::Tensor2<DataType>::operator=(o);
@@ -33,7 +33,9 @@
 #include <src/util/math/vectorb.h>
 #include <src/util/parallel/scalapack.h>
 #include <src/util/parallel/mpi_interface.h>
+#include <src/util/parallel/sharedmem.h>
 #include <src/util/serialization.h>
+#include <src/util/io/binarchive.h>
 
 #define MATRIX_BASE
 #include <src/util/math/matview.h>
@@ -71,9 +73,23 @@ class Matrix_base : public btas::Tensor2<DataType> {
       boost::serialization::split_member(ar, *this, file_version);
     }
 
+    // large matrices go into the binary container attached to the archive, if any
     template<class Archive>
     void load(Archive& ar, const unsigned int) {
-      ar >> boost::serialization::base_object<btas::Tensor2<DataType>>(*this) >> localized_;
+      if (BinaryIArchive* binary = BinaryIArchive::attached(ar)) {
+        size_t n, m;
+        ar >> n >> m >> localized_;
+        static_cast<btas::Tensor2<DataType>&>(*this) = btas::Tensor2<DataType>(n, m);
+        if (n*m >= BinaryOArchive::min_size) {
+          auto in = binary->get<DataType>();
+          assert(in.second == n*m);
+          std::copy_n(in.first, n*m, data());
+        } else {
+          ar >> boost::serialization::make_array(data(), n*m);
+        }
+      } else {
+        ar >> boost::serialization::base_object<btas::Tensor2<DataType>>(*this) >> localized_;
+      }
 #ifdef HAVE_SCALAPACK
       if (!localized_) {
         desc_ = mpi__->descinit(ndim(), mdim());
@@ -84,7 +100,17 @@ class Matrix_base : public btas::Tensor2<DataType> {
 
     template<class Archive>
     void save(Archive& ar, const unsigned int) const {
-      ar << boost::serialization::base_object<btas::Tensor2<DataType>>(*this) << localized_;
+      if (BinaryOArchive* binary = BinaryOArchive::attached(ar)) {
+        const size_t n = ndim();
+        const size_t m = mdim();
+        ar << n << m << localized_;
+        if (n*m >= BinaryOArchive::min_size)
+          binary->put(data(), n*m);
+        else
+          ar << boost::serialization::make_array(data(), n*m);
+      } else {
+        ar << boost::serialization::base_object<btas::Tensor2<DataType>>(*this) << localized_;
+      }
     }
 
   public:
@@ -92,6 +118,8 @@ class Matrix_base : public btas::Tensor2<DataType> {
     Matrix_base(const Matrix_base& o);
     Matrix_base(const MatView_<DataType>& o);
     Matrix_base(Matrix_base&& o);
+    // elements are placed in node-shared memory at offset (in bytes); they are not initialized
+    Matrix_base(const size_t n, const size_t m, std::shared_ptr<SharedMemory> mem, const size_t offset, const bool local);
     Matrix_base() : localized_(true) { }
 
     virtual ~Matrix_base() { }
@@ -153,9 +181,18 @@ class Matrix_base : public btas::Tensor2<DataType> {
 
     void scale(const DataType& a) { blas::scale_n(a, data(), size()); }
 
-    void allreduce() { mpi__->allreduce(data(), size()); }
+    // node-shared matrices cannot hold contributions from each process
+    void allreduce() { assert(!node_shared()); mpi__->allreduce(data(), size()); }
     void synchronize() { broadcast(); }
-    void broadcast(const int root = 0) { mpi__->broadcast(data(), size(), root); }
+    void broadcast(const int root = 0) {
+      if (node_shared())
+        std::static_pointer_cast<const SharedMemory>(this->storage().external())->broadcast(data(), size()*sizeof(DataType), root);
+      else
+        mpi__->broadcast(data(), size(), root);
+    }
+
+    // if the elements are in memory shared by the processes on this node (see src/util/parallel/sharedmem.h)
+    bool node_shared() const { return static_cast<bool>(this->storage().external()); }
 
     virtual void print(const std::string tag = "", const int size = 10) const { btas::print(*this, tag, size); }
 
@@ -38,7 +38,7 @@ using namespace std;
 using namespace bagel;
 
 MPI_Interface::MPI_Interface()
- : depth_(0), cnt_(0), nprow_(0), npcol_(0), context_(0), myprow_(0), mypcol_(0), mpimutex_() {
+ : depth_(0), cnt_(0), shared_memory_(true), nprow_(0), npcol_(0), context_(0), myprow_(0), mypcol_(0), mpimutex_() {
 
 #ifdef HAVE_MPI_H
   int provided;
@@ -92,11 +92,15 @@ MPI_Interface::MPI_Interface()
   rank_ = world_rank_;
   size_ = world_size_;
 #endif
+  init_node();
+  if (rank() == 0 && node_size_ > 1)
+    cout << "  * replicated data are shared by " << node_size_ << " processes on a node" << endl << endl;
 }
 
 
 MPI_Interface::~MPI_Interface() {
 #ifdef HAVE_MPI_H
+  free_node();
 #ifndef HAVE_SCALAPACK
   MPI_Finalize();
 #else
@@ -394,6 +398,7 @@ void MPI_Interface::split(const int n) {
     allreduce(pmap_.data(), size_);
   }
 #endif
+  free_node();
   MPI_Comm new_comm;
   const int icomm = rank_ % n;
   mpi_comm_old_.push_back(pair<MPI_Comm,array<int,5>>(mpi_comm_, {context_, nprow_, npcol_, myprow_, mypcol_}));
@@ -404,6 +409,7 @@ void MPI_Interface::split(const int n) {
   mpi_comm_ = new_comm;
   MPI_Comm_rank(mpi_comm_, &rank_);
   MPI_Comm_size(mpi_comm_, &size_);
+  init_node();
 #ifdef HAVE_SCALAPACK
   tie(nprow_, npcol_) = numgrid(size_);
   vector<int> imap(size_, 0);
@@ -419,6 +425,7 @@ void MPI_Interface::split(const int n) {
 
 void MPI_Interface::merge() {
 #ifdef HAVE_MPI_H
+  free_node();
   MPI_Comm_free(&mpi_comm_);
 
   --depth_;
@@ -429,6 +436,7 @@ void MPI_Interface::merge() {
 #endif
   MPI_Comm_rank(mpi_comm_, &rank_);
   MPI_Comm_size(mpi_comm_, &size_);
+  init_node();
 
   mpi_comm_old_.pop_back();
 #ifdef HAVE_SCALAPACK
@@ -443,6 +451,58 @@ void MPI_Interface::merge() {
 }
 
 
+void MPI_Interface::init_node() {
+#ifdef HAVE_MPI_H
+  MPI_Comm node_comm, leader_comm;
+  if (!shared_memory_)
+    MPI_Comm_split(mpi_comm_, rank_, 0, &node_comm);
+  else
+    MPI_Comm_split_type(mpi_comm_, MPI_COMM_TYPE_SHARED, rank_, MPI_INFO_NULL, &node_comm);
+  MPI_Comm_rank(node_comm, &node_rank_);
+  MPI_Comm_size(node_comm, &node_size_);
+  MPI_Comm_split(mpi_comm_, node_rank_ == 0 ? 0 : MPI_UNDEFINED, rank_, &leader_comm);
+
+  // node-shared memory keeps the communicators alive after split(), merge() or set_shared_memory()
+  auto free_comm = [](MPI_Comm* comm) {
+    if (*comm != MPI_COMM_NULL)
+      MPI_Comm_free(comm);
+    delete comm;
+  };
+  node_comm_ = shared_ptr<const MPI_Comm>(new MPI_Comm(node_comm), free_comm);
+  leader_comm_ = shared_ptr<const MPI_Comm>(new MPI_Comm(leader_comm), free_comm);
+
+  // nodes are numbered by the rank of their first process in leader_comm_
+  int node = 0;
+  if (leader_comm != MPI_COMM_NULL)
+    MPI_Comm_rank(leader_comm, &node);
+  MPI_Bcast(static_cast<void*>(&node), 1, MPI_INT, 0, node_comm);
+  node_of_.resize(size_);
+  MPI_Allgather(static_cast<void*>(&node), 1, MPI_INT, static_cast<void*>(node_of_.data()), 1, MPI_INT, mpi_comm_);
+#else
+  node_rank_ = 0;
+  node_size_ = 1;
+  node_of_ = {0};
+#endif
+}
+
+
+void MPI_Interface::free_node() {
+#ifdef HAVE_MPI_H
+  node_comm_.reset();
+  leader_comm_.reset();
+#endif
+}
+
+
+void MPI_Interface::set_shared_memory(const bool shared) {
+  if (shared == shared_memory_)
+    return;
+  shared_memory_ = shared;
+  free_node();
+  init_node();
+}
+
+
 // ScaLapack interfaces
 
 pair<int,int> MPI_Interface::numroc(const int ndim, const int ncol) const {
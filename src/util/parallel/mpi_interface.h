@@ -47,9 +47,21 @@ class MPI_Interface {
     int depth_;
 
     int cnt_;
+
+    // processes that share memory with this process (within the current communicator) and the node of each process
+    int node_rank_;
+    int node_size_;
+    std::vector<int> node_of_;
+    // if false, every process is a node of its own (set by "shared_memory" in the molecule block)
+    bool shared_memory_;
+
     // request handles
 #ifdef HAVE_MPI_H
     MPI_Comm mpi_comm_;
+    // communicator among the processes on this node, and among the first processes on the nodes (MPI_COMM_NULL on the
+    // others). They are freed when neither this object nor node-shared memory allocated with them uses them any more.
+    std::shared_ptr<const MPI_Comm> node_comm_;
+    std::shared_ptr<const MPI_Comm> leader_comm_;
     std::map<int, std::vector<MPI_Request>> request_;
     std::vector<std::pair<MPI_Comm,std::array<int,5>>> mpi_comm_old_;
 #endif
@@ -71,6 +83,10 @@ class MPI_Interface {
     // MPI's internal variables
     int tag_ub_;
 
+    // sets up (and frees) the node communicators for the current communicator
+    void init_node();
+    void free_node();
+
   public:
     MPI_Interface();
     ~MPI_Interface();
@@ -82,6 +98,14 @@ class MPI_Interface {
     int depth() const { return depth_; }
     bool last() const { return rank() == size()-1; }
 
+    // processes on the same node (see src/util/parallel/sharedmem.h)
+    int node_rank() const { return node_rank_; }
+    int node_size() const { return node_size_; }
+    int node_of(const int rank) const { return node_of_[rank]; }
+    bool shared_memory() const { return shared_memory_; }
+    // turns node-shared memory on or off (collective)
+    void set_shared_memory(const bool shared);
+
     // collective functions
     // barrier
     void barrier() const;
@@ -119,6 +143,10 @@ class MPI_Interface {
 #ifdef HAVE_MPI_H
     // communicators. n is the number of processes per communicator.
     const MPI_Comm& mpi_comm() const { return mpi_comm_; }
+    const MPI_Comm& node_comm() const { return *node_comm_; }
+    const MPI_Comm& leader_comm() const { return *leader_comm_; }
+    std::shared_ptr<const MPI_Comm> node_comm_ptr() const { return node_comm_; }
+    std::shared_ptr<const MPI_Comm> leader_comm_ptr() const { return leader_comm_; }
 #endif
     void split(const int n);
     void merge();
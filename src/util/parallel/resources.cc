@@ -22,12 +22,13 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <unistd.h>
 #include <src/util/parallel/resources.h>
 
 using namespace std;
 using namespace bagel;
 
-StackMem::StackMem() : pointer_(0LU), total_(20000000LU) { // TODO this should not be hardwired
+StackMem::StackMem() : pointer_(0LU), total_(20000000LU), peak_(0LU) { // TODO this should not be hardwired
   stack_area_ = unique_ptr<double[]>(new double[total_]);
 
   // in case we use Libint for ERI
@@ -42,7 +43,7 @@ StackMem::StackMem() : pointer_(0LU), total_(20000000LU) { // TODO this should n
 }
 
 
-Resources::Resources(const int max) : proc_(make_shared<Process>()), max_num_threads_(max) {
+Resources::Resources(const int max) : proc_(make_shared<Process>()), max_num_threads_(max), pool_(new ThreadPool()) {
 #ifdef LIBINT_INTERFACE
   LIBINT2_PREFIXED_NAME(libint2_static_init)();
 #endif
@@ -62,6 +63,25 @@ shared_ptr<StackMem> Resources::get() {
 }
 
 
+size_t Resources::stackmem_peak() const {
+  size_t out = 0LU;
+  for (auto& i : stackmem_)
+    out = max(out, i.first->peak());
+  return out;
+}
+
+
+size_t Resources::available_memory() const {
+#ifdef _SC_AVPHYS_PAGES
+  const long pages = sysconf(_SC_AVPHYS_PAGES);
+  const long pagesize = sysconf(_SC_PAGESIZE);
+  if (pages > 0 && pagesize > 0)
+    return static_cast<size_t>(pages) * static_cast<size_t>(pagesize);
+#endif
+  return 0LU;
+}
+
+
 void Resources::release(shared_ptr<StackMem> o) {
   o->clear();
   auto iter = stackmem_.find(o);
@@ -35,10 +35,12 @@
 #include <stdexcept>
 #include <complex>
 #include <map>
+#include <algorithm>
 #ifdef LIBINT_INTERFACE
   #include <libint2.h>
 #endif
 #include <src/util/parallel/process.h>
+#include <src/util/parallel/threadpool.h>
 #include <src/util/constants.h>
 
 namespace bagel {
@@ -48,6 +50,8 @@ class StackMem {
     std::unique_ptr<double[]> stack_area_;
     size_t pointer_;
     const size_t total_;
+    // high-water mark of pointer_
+    size_t peak_;
 
 #ifdef LIBINT_INTERFACE
     std::unique_ptr<Libint_t[]> libint_t_;
@@ -62,6 +66,7 @@ class StackMem {
       assert(size * sizeof(DataType) % sizeof(double) == 0);
       DataType* out = reinterpret_cast<DataType*> (stack_area_.get() + pointer_);
       pointer_ += (size * sizeof(DataType) / sizeof(double));
+      peak_ = std::max(peak_, pointer_);
       return out;
     }
 
@@ -74,6 +79,7 @@ class StackMem {
 
     void clear() { pointer_ = 0LU; }
     size_t pointer() const { return pointer_; }
+    size_t peak() const { return peak_; }
 
 #ifdef LIBINT_INTERFACE
     Libint_t* libint_t_ptr(const int i) { return &libint_t_[i]; }
@@ -87,6 +93,8 @@ class Resources {
     std::shared_ptr<Process> proc_;
     std::map<std::shared_ptr<StackMem>, std::atomic_flag> stackmem_;
     size_t max_num_threads_;
+    // worker threads are created on first use
+    std::unique_ptr<ThreadPool> pool_;
 
   public:
     Resources(const int max);
@@ -95,7 +103,12 @@ class Resources {
     void release(std::shared_ptr<StackMem> o);
 
     size_t max_num_threads() const { return max_num_threads_; }
+    // largest high-water mark among StackMem objects (in units of double)
+    size_t stackmem_peak() const;
+    // physical memory (in bytes) that is currently available on this node; 0 if it cannot be determined
+    size_t available_memory() const;
     std::shared_ptr<Process> proc() { return proc_; }
+    ThreadPool& pool() { return *pool_; }
 };
 
 extern Resources* resources__;
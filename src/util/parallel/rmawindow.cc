@@ -134,6 +134,15 @@ void RMAWindow<DataType>::fence() const {
 }
 
 
+template<typename DataType>
+void RMAWindow<DataType>::fence(const size_t rank) const {
+#ifdef HAVE_MPI_H
+  assert(initialized_);
+  MPI_Win_flush(rank, win_);
+#endif
+}
+
+
 template<typename DataType>
 void RMAWindow<DataType>::fence_local() const {
 #ifdef HAVE_MPI_H
@@ -77,6 +77,8 @@ class RMAWindow {
 
     void fence() const;
     void fence_local() const;
+    // completes the operations issued from this process to the target process
+    void fence(const size_t rank) const;
 
     void ax_plus_y(const DataType& a, const RMAWindow<DataType>& o);
     void ax_plus_y(const DataType& a, std::shared_ptr<const RMAWindow<DataType>> o) { ax_plus_y(a, *o); }
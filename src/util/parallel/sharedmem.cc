@@ -0,0 +1,102 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: sharedmem.cc
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <cassert>
+#include <iostream>
+#include <src/util/parallel/sharedmem.h>
+#include <src/util/parallel/mpi_interface.h>
+
+using namespace std;
+using namespace bagel;
+
+SharedMemory::SharedMemory(const size_t bytes) : size_(bytes), data_(nullptr), shared_(false), node_rank_(mpi__->node_rank()), node_size_(mpi__->node_size()), id_(0) {
+  node_of_.resize(mpi__->size());
+  for (int i = 0; i != mpi__->size(); ++i)
+    node_of_[i] = mpi__->node_of(i);
+#ifdef HAVE_MPI_H
+  node_comm_ = mpi__->node_comm_ptr();
+  leader_comm_ = mpi__->leader_comm_ptr();
+  if (node_size_ > 1) {
+    // processes on the node may have allocated different numbers of windows in other communicators
+    static long next_id = 0;
+    id_ = next_id;
+    MPI_Allreduce(MPI_IN_PLACE, static_cast<void*>(&id_), 1, MPI_LONG, MPI_MAX, *node_comm_);
+    next_id = id_ + 1;
+
+    // the first process on the node allocates all the memory, and the others obtain its address
+    void* base;
+    MPI_Win_allocate_shared(node_rank_ == 0 ? bytes : 0, 1, MPI_INFO_NULL, *node_comm_, &base, &win_);
+    MPI_Aint size;
+    int disp;
+    MPI_Win_shared_query(win_, 0, &size, &disp, &base);
+    assert(static_cast<size_t>(size) == bytes);
+    data_ = static_cast<char*>(base);
+    shared_ = true;
+    MPI_Win_fence(0, win_);
+    return;
+  }
+#endif
+  local_ = unique_ptr<char[]>(new char[bytes]);
+  data_ = local_.get();
+}
+
+
+SharedMemory::~SharedMemory() {
+#ifdef HAVE_MPI_H
+  if (shared_) {
+    // MPI_Win_free is collective over the node. If the processes release different windows here, they would deadlock;
+    // the mismatch is detected with the node communicator, which all the windows allocated in this context share.
+    long range[2] = {id_, -id_};
+    MPI_Allreduce(MPI_IN_PLACE, static_cast<void*>(range), 2, MPI_LONG, MPI_MAX, *node_comm_);
+    if (range[0] != -range[1]) {
+      cerr << "  node-shared memory has been released in different orders on the processes of a node" << endl;
+      MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+    MPI_Win_free(&win_);
+  }
+#endif
+}
+
+
+void SharedMemory::fence() const {
+#ifdef HAVE_MPI_H
+  if (shared_)
+    MPI_Win_fence(0, win_);
+#endif
+}
+
+
+void SharedMemory::broadcast(void* ptr, const size_t bytes, const int root) const {
+  assert(static_cast<char*>(ptr) >= data_ && static_cast<char*>(ptr) + bytes <= data_ + size_);
+#ifdef HAVE_MPI_H
+  fence();
+  if (*leader_comm_ != MPI_COMM_NULL) {
+    constexpr size_t bsize = 100000000LU;
+    char* buf = static_cast<char*>(ptr);
+    for (size_t done = 0; done < bytes; done += bsize)
+      MPI_Bcast(static_cast<void*>(buf+done), min(bsize, bytes-done), MPI_BYTE, node_of_[root], *leader_comm_);
+  }
+  fence();
+#endif
+}
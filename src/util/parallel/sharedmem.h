@@ -0,0 +1,95 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: sharedmem.h
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Memory that is allocated once per node in an MPI-3 shared-memory window (MPI_Win_allocate_shared) and is read directly
+// by all the processes on the node. It is used for data that are otherwise replicated on every process (e.g., 2-index
+// DF metric, MO integrals in FCI, basis functions on DFT grids). Allocation is collective over the current communicator;
+// the node and leader communicators at that point are kept and used for all later operations, so that the object stays
+// valid after MPI_Interface::split() or merge(). Deallocation is collective over the node: the owners have to be
+// destroyed in the same order on all the processes of the node (which is checked in the destructor).
+// The memory is filled by one process per node (or in parts by the processes on the node) and is read-only afterwards;
+// fence() has to be called in between.
+// Without MPI or with one process per node, the memory is simply allocated on this process.
+
+#ifndef __SRC_PARALLEL_SHAREDMEM_H
+#define __SRC_PARALLEL_SHAREDMEM_H
+
+#include <bagel_config.h>
+#include <memory>
+#include <vector>
+#ifdef HAVE_MPI_H
+ #include <mpi.h>
+#endif
+
+namespace bagel {
+
+class SharedMemory {
+  protected:
+#ifndef HAVE_MPI_H
+    using MPI_Win = int; // just to compile
+#endif
+    size_t size_;
+    char* data_;
+    // used when no other process shares the node
+    std::unique_ptr<char[]> local_;
+    MPI_Win win_;
+    bool shared_;
+
+#ifdef HAVE_MPI_H
+    std::shared_ptr<const MPI_Comm> node_comm_;
+    std::shared_ptr<const MPI_Comm> leader_comm_;
+#endif
+    // rank and size within the node, and the node of each process of the communicator at the time of allocation
+    int node_rank_;
+    int node_size_;
+    std::vector<int> node_of_;
+    // serial number of the allocation (the same on all the processes of the node)
+    long id_;
+
+  public:
+    SharedMemory(const size_t bytes);
+    ~SharedMemory();
+
+    SharedMemory(const SharedMemory&) = delete;
+    SharedMemory& operator=(const SharedMemory&) = delete;
+
+    char* data() { return data_; }
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool shared() const { return shared_; }
+    int node_rank() const { return node_rank_; }
+    int node_size() const { return node_size_; }
+
+    // true on the process that fills in the memory (one per node)
+    bool writer() const { return node_rank_ == 0; }
+    // completes the writes by the processes on this node
+    void fence() const;
+    // copies a part of the memory from the node of root (a rank at the time of allocation) to the other nodes.
+    // Only one process per node communicates
+    void broadcast(void* ptr, const size_t bytes, const int root) const;
+};
+
+}
+
+#endif
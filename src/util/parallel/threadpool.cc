@@ -0,0 +1,133 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: threadpool.cc
+// Copyright (C) 2016 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <list>
+#include <cassert>
+#include <exception>
+#include <src/util/parallel/threadpool.h>
+
+using namespace std;
+using namespace bagel;
+
+namespace {
+  // true on threads that are executing a job of a pool (including the calling thread)
+  thread_local bool inside_pool = false;
+
+  struct InsidePool {
+    const bool previous;
+    InsidePool() : previous(inside_pool) { inside_pool = true; }
+    ~InsidePool() { inside_pool = previous; }
+  };
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    lock_guard<mutex> lock(mutex_);
+    stop_ = true;
+  }
+  start_.notify_all();
+  for (auto& i : workers_)
+    i.join();
+}
+
+
+void ThreadPool::spawn(const int n) {
+  // called while holding busy_, hence no worker is running a job
+  for (int i = workers_.size()+1; i < n; ++i)
+    workers_.emplace_back(&ThreadPool::loop, this, i);
+}
+
+
+void ThreadPool::loop(const int id) {
+  size_t seen = 0;
+  while (true) {
+    function<void(const int)>* func;
+    {
+      unique_lock<mutex> lock(mutex_);
+      start_.wait(lock, [this, &seen]() { return stop_ || generation_ != seen; });
+      if (stop_) return;
+      seen = generation_;
+      if (id >= nthreads_) continue;
+      func = &func_;
+    }
+    {
+      InsidePool inside;
+      (*func)(id);
+    }
+    {
+      lock_guard<mutex> lock(mutex_);
+      if (--remaining_ == 0)
+        done_.notify_one();
+    }
+  }
+}
+
+
+void ThreadPool::run(const int n, function<void(const int)> func) {
+  assert(n > 0);
+  // nested calls (a task itself using TaskQueue) are run serially by the calling thread; all the threads are busy already
+  if (n == 1 || inside_pool) {
+    for (int i = 0; i != n; ++i)
+      func(i);
+    return;
+  }
+
+  // the pool is used by another thread; use temporary threads. Calls nested in them are serial as well.
+  unique_lock<mutex> busy(busy_, try_to_lock);
+  if (!busy.owns_lock()) {
+    InsidePool inside;
+    list<thread> threads;
+    for (int i = 1; i != n; ++i)
+      threads.emplace_back([&func, i] { InsidePool inside; func(i); });
+    func(0);
+    for (auto& i : threads)
+      i.join();
+    return;
+  }
+
+  spawn(n);
+  {
+    lock_guard<mutex> lock(mutex_);
+    func_ = func;
+    nthreads_ = n;
+    remaining_ = n-1;
+    ++generation_;
+  }
+  start_.notify_all();
+
+  // workers refer to func_ until they are done, so we wait for them even when thread 0 throws
+  exception_ptr error;
+  try {
+    InsidePool inside;
+    func(0);
+  } catch (...) {
+    error = current_exception();
+  }
+
+  unique_lock<mutex> lock(mutex_);
+  done_.wait(lock, [this]() { return remaining_ == 0; });
+  func_ = nullptr;
+  if (error)
+    rethrow_exception(error);
+}
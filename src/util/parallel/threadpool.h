@@ -0,0 +1,71 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: threadpool.h
+// Copyright (C) 2016 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef __SRC_PARALLEL_THREADPOOL_H
+#define __SRC_PARALLEL_THREADPOOL_H
+
+#include <stddef.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+namespace bagel {
+
+// Persistent pool of worker threads used by TaskQueue, so that threads are not spawned and joined on every call.
+// The calling thread always participates as thread 0. Nested calls are run serially by the calling thread;
+// concurrent calls from other threads fall back to temporary threads.
+class ThreadPool {
+  protected:
+    std::vector<std::thread> workers_;
+
+    std::mutex busy_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+
+    // current job
+    std::function<void(const int)> func_;
+    int nthreads_;
+    size_t generation_;
+    int remaining_;
+    bool stop_;
+
+    void loop(const int id);
+    void spawn(const int n);
+
+  public:
+    ThreadPool() : nthreads_(0), generation_(0), remaining_(0), stop_(false) { }
+    ~ThreadPool();
+
+    // calls func(i) for i = 0, ..., n-1 concurrently and returns when all of them are done
+    void run(const int n, std::function<void(const int)> func);
+
+    size_t size() const { return workers_.size()+1; }
+};
+
+}
+
+#endif
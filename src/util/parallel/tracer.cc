@@ -0,0 +1,166 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: tracer.cc
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#include <map>
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <unordered_map>
+#include <src/util/parallel/tracer.h>
+#include <src/util/parallel/resources.h>
+#include <src/util/parallel/mpi_interface.h>
+
+using namespace std;
+using namespace bagel;
+
+namespace {
+
+// number of events kept per thread (older events are overwritten; totals are not affected)
+constexpr size_t ring_size = 1LU << 16;
+
+struct Event {
+  string name;
+  Tracer::Clock::time_point start;
+  Tracer::Clock::time_point end;
+};
+
+struct ThreadBuffer {
+  const int tid;
+  vector<Event> ring;
+  size_t count;
+  unordered_map<string, pair<size_t, double>> totals;
+  ThreadBuffer(const int t) : tid(t), ring(ring_size), count(0) { }
+};
+
+mutex& buffer_mutex() {
+  static mutex mut;
+  return mut;
+}
+
+// buffers are owned here so that they outlive the threads that fill them
+vector<unique_ptr<ThreadBuffer>>& buffers() {
+  static vector<unique_ptr<ThreadBuffer>> buf;
+  return buf;
+}
+
+// time stamps are relative to the static initialization of this file (i.e., program start)
+const Tracer::Clock::time_point origin_ = Tracer::Clock::now();
+const Tracer::Clock::time_point& origin() { return origin_; }
+
+ThreadBuffer& this_thread_buffer() {
+  thread_local ThreadBuffer* buf = nullptr;
+  if (!buf) {
+    lock_guard<mutex> lock(buffer_mutex());
+    buffers().emplace_back(new ThreadBuffer(buffers().size()));
+    buf = buffers().back().get();
+  }
+  return *buf;
+}
+
+double microseconds(const Tracer::Clock::duration& d) {
+  return chrono::duration_cast<chrono::nanoseconds>(d).count()*1.0e-3;
+}
+
+string escape(const string& in) {
+  string out;
+  for (auto& c : in) {
+    if (c == '"' || c == '\\') out += '\\';
+    out += c;
+  }
+  return out;
+}
+
+}
+
+
+void Tracer::record_impl(const string& name, const Clock::time_point& start, const Clock::time_point& end) {
+  ThreadBuffer& buf = this_thread_buffer();
+  Event& e = buf.ring[buf.count++ % ring_size];
+  e.name = name;
+  e.start = start;
+  e.end = end;
+  auto& total = buf.totals[name];
+  ++total.first;
+  total.second += microseconds(end - start)*1.0e-6;
+}
+
+
+void Tracer::finalize() {
+  if (!enabled()) return;
+  lock_guard<mutex> lock(buffer_mutex());
+  const int rank = mpi__ ? mpi__->rank() : 0;
+
+  // per-rank aggregation over threads: name -> (#calls, total time, max time over threads)
+  map<string, tuple<size_t, double, double>> summary;
+  for (auto& buf : buffers())
+    for (auto& i : buf->totals) {
+      auto& s = summary[i.first];
+      get<0>(s) += i.second.first;
+      get<1>(s) += i.second.second;
+      get<2>(s) = max(get<2>(s), i.second.second);
+    }
+
+  size_t stack_peak = 0;
+  if (resources__)
+    stack_peak = resources__->stackmem_peak();
+
+  const string filename = string(getenv("BAGEL_TRACE")) + "." + to_string(rank) + ".json";
+  ofstream fs(filename);
+  fs << "{\"traceEvents\":[" << endl;
+  fs << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"args\":{\"name\":\"rank " << rank << "\"}}";
+  for (auto& buf : buffers()) {
+    const size_t n = min(buf->count, ring_size);
+    for (size_t j = buf->count - n; j != buf->count; ++j) {
+      const Event& e = buf->ring[j % ring_size];
+      fs << "," << endl << "{\"name\":\"" << escape(e.name) << "\",\"ph\":\"X\",\"pid\":" << rank << ",\"tid\":" << buf->tid << fixed << setprecision(3)
+         << ",\"ts\":" << microseconds(e.start - origin()) << ",\"dur\":" << microseconds(e.end - e.start) << "}";
+    }
+  }
+  fs << "," << endl << "{\"name\":\"StackMem high-water mark (MB)\",\"ph\":\"C\",\"pid\":" << rank << ",\"ts\":0,\"args\":{\"value\":"
+     << stack_peak*sizeof(double)*1.0e-6 << "}}";
+  fs << endl << "]}" << endl;
+
+  if (rank == 0) {
+    vector<pair<string, tuple<size_t, double, double>>> sorted(summary.begin(), summary.end());
+    sort(sorted.begin(), sorted.end(), [](const pair<string, tuple<size_t, double, double>>& a, const pair<string, tuple<size_t, double, double>>& b)
+                                          { return get<1>(a.second) > get<1>(b.second); });
+    cout << endl << "  * Trace summary (rank 0, " << buffers().size() << " threads) written to " << filename << endl;
+    cout << "      " << left << setw(40) << "region" << right << setw(10) << "calls" << setw(12) << "total" << setw(12) << "max/thread" << endl;
+    for (auto& i : sorted)
+      cout << "      " << left << setw(40) << i.first.substr(0, 39) << right << setw(10) << get<0>(i.second) << fixed << setprecision(2)
+           << setw(12) << get<1>(i.second) << setw(12) << get<2>(i.second) << endl;
+    cout << "      StackMem high-water mark: " << setprecision(1) << stack_peak*sizeof(double)*1.0e-6 << " MB" << endl << endl;
+  }
+
+  // so that a second call does not write the same events again
+  for (auto& buf : buffers()) {
+    buf->count = 0;
+    buf->totals.clear();
+  }
+}
@@ -0,0 +1,73 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: tracer.h
+// Copyright (C) 2018 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#ifndef __SRC_PARALLEL_TRACER_H
+#define __SRC_PARALLEL_TRACER_H
+
+#include <chrono>
+#include <string>
+#include <cstdlib>
+
+namespace bagel {
+
+// Lightweight tracing of named regions. It is switched on by setting $BAGEL_TRACE to a file prefix;
+// otherwise every call below returns after checking a flag. Events are kept in per-thread ring buffers
+// together with per-thread totals, which are aggregated per MPI rank by finalize(). Each rank then writes
+// <prefix>.<rank>.json in the Chrome trace format (chrome://tracing or ui.perfetto.dev).
+class Tracer {
+  public:
+    using Clock = std::chrono::high_resolution_clock;
+
+    static bool enabled() {
+      static const bool out = std::getenv("BAGEL_TRACE") != nullptr;
+      return out;
+    }
+
+    // records a region that started at start and ends now
+    static void record(const std::string& name, const Clock::time_point& start, const Clock::time_point& end = Clock::now()) {
+      if (enabled())
+        record_impl(name, start, end);
+    }
+
+    // aggregates the events on this process and writes out the trace. Safe to call more than once.
+    static void finalize();
+
+    // scoped region
+    class Region {
+      protected:
+        const char* name_;
+        Clock::time_point start_;
+      public:
+        Region(const char* name) : name_(name) { if (enabled()) start_ = Clock::now(); }
+        ~Region() { if (enabled()) record_impl(name_, start_, Clock::now()); }
+    };
+
+  private:
+    static void record_impl(const std::string& name, const Clock::time_point& start, const Clock::time_point& end);
+};
+
+}
+
+#endif
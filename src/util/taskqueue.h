@@ -27,23 +27,33 @@
 #define __SRC_UTIL_TASKQUEUE_H
 
 #include <stddef.h>
-#include <list>
 #include <atomic>
 #include <memory>
 #include <stdexcept>
 #include <utility>
 #include <thread>
 #include <algorithm>
+#include <cassert>
+#include <cstdint>
 
 #include <vector>
 #include <bagel_config.h>
 #ifdef HAVE_MKL_H
   #include "mkl_service.h"
 #endif
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
 #include <src/util/parallel/resources.h>
+#include <src/util/parallel/tracer.h>
 
 namespace bagel {
 
+// Tasks are distributed to per-thread deques; a thread that runs out of work steals chunks from the back of others.
+// If the task class has a member function cost() (e.g., DFIntTask), tasks are sorted by the estimated cost
+// and dealt out round-robin so that expensive tasks are processed first and cheap ones fill in the tail.
+// If the task class has compute(const int) (e.g., GradTask), it is called with the index of the worker thread
+// (0 <= index < num_threads) so that tasks can accumulate into per-thread storage without locks.
 template<typename T>
 class TaskQueue {
 
@@ -62,14 +72,109 @@ class TaskQueue {
     struct call<U, true> { static void compute(U& task) { task.compute(); } };
     template<typename U>
     struct call<U, false>{ static void compute(U& task) { task(); } };
-    template<typename U> void call_compute(U& task)                  { call<U, has_compute<U>::value>::compute(task); }
-    template<typename U> void call_compute(std::shared_ptr<U>& task) { call<U, has_compute<U>::value>::compute(*task); }
+    template <class U>
+    struct has_compute_thread {
+      protected:
+        template<class V> static auto __compute(V* p) -> decltype(p->compute(0), std::true_type());
+        template<class  > static std::false_type __compute(...);
+      public:
+        static constexpr const bool value = std::is_same<std::true_type, decltype(__compute<U>(0))>::value;
+    };
+    template<typename U, bool>
+    struct call_thread       { static void compute(U& task, const int) { call<U, has_compute<U>::value>::compute(task); } };
+    template<typename U>
+    struct call_thread<U, true> { static void compute(U& task, const int id) { task.compute(id); } };
+    template<typename U> void call_compute(U& task, const int id)                  { call_thread<U, has_compute_thread<U>::value>::compute(task, id); }
+    template<typename U> void call_compute(std::shared_ptr<U>& task, const int id) { call_thread<U, has_compute_thread<U>::value>::compute(*task, id); }
+
+    template <class U>
+    struct has_cost {
+      protected:
+        template<class V> static auto __cost(V* p) -> decltype(p->cost(), std::true_type());
+        template<class  > static std::false_type __cost(...);
+      public:
+        static constexpr const bool value = std::is_same<std::true_type, decltype(__cost<U>(0))>::value;
+    };
+    template<typename U, bool>
+    struct estimate       { static double cost(const U& task) { return 1.0; } };
+    template<typename U>
+    struct estimate<U, true> { static double cost(const U& task) { return task.cost(); } };
+    template<typename U> static constexpr bool with_cost(const U*)                     { return has_cost<U>::value; }
+    template<typename U> static constexpr bool with_cost(const std::shared_ptr<U>*)    { return has_cost<U>::value; }
+    template<typename U> static double call_cost(const U& task)                     { return estimate<U, has_cost<U>::value>::cost(task); }
+    template<typename U> static double call_cost(const std::shared_ptr<U>& task)    { return estimate<U, has_cost<U>::value>::cost(*task); }
+
+    // deque of chunks owned by one thread. The head (lower 32 bits) is advanced by the owner, the tail (upper 32 bits)
+    // is decremented by thieves. Both are updated with a single CAS, so no locks are needed.
+    struct alignas(64) Deque {
+      std::atomic<uint64_t> range;
+      static uint64_t pack(const uint64_t head, const uint64_t tail) { return head | (tail << 32); }
+      void set(const size_t head, const size_t tail) { range.store(pack(head, tail)); }
+      bool pop_front(size_t& out) {
+        uint64_t old = range.load();
+        while (true) {
+          const uint64_t head = old & 0xffffffffLU, tail = old >> 32;
+          if (head >= tail) return false;
+          if (range.compare_exchange_weak(old, pack(head+1, tail))) { out = head; return true; }
+        }
+      }
+      bool pop_back(size_t& out) {
+        uint64_t old = range.load();
+        while (true) {
+          const uint64_t head = old & 0xffffffffLU, tail = old >> 32;
+          if (head >= tail) return false;
+          if (range.compare_exchange_weak(old, pack(head, tail-1))) { out = tail-1; return true; }
+        }
+      }
+    };
 
   protected:
     std::vector<T> task_;
-    std::list<std::atomic_flag> flag_;
     static const int chunck_ = 12;
 
+    // order in which tasks are processed, chunk size, and per-thread deques of chunks
+    std::vector<size_t> order_;
+    size_t chunk_size_;
+    std::unique_ptr<Deque[]> deque_;
+
+    void setup(const int num_threads) {
+      const size_t n = task_.size();
+      order_.resize(n);
+      if (!with_cost(task_.data())) {
+        // contiguous blocks of chunks per thread (keeps the locality of the original ordering)
+        for (size_t i = 0; i != n; ++i) order_[i] = i;
+        chunk_size_ = chunck_;
+        const size_t nchunk = (n-1)/chunk_size_+1;
+        for (int t = 0; t != num_threads; ++t)
+          deque_[t].set(nchunk*t/num_threads, nchunk*(t+1)/num_threads);
+      } else {
+        // sort by the cost in descending order and deal out round-robin; each thread's deque is then concatenated
+        std::vector<std::pair<double,size_t>> cost(n);
+        for (size_t i = 0; i != n; ++i) cost[i] = std::make_pair(-call_cost(task_[i]), i);
+        std::sort(cost.begin(), cost.end());
+        chunk_size_ = 1;
+#ifdef _OPENMP
+        // the OpenMP loop hands out chunks in this order, so the most expensive tasks have to come first
+        for (size_t i = 0; i != n; ++i) order_[i] = cost[i].second;
+        return;
+#endif
+        size_t j = 0;
+        for (int t = 0; t != num_threads; ++t) {
+          const size_t head = j;
+          for (size_t i = t; i < n; i += num_threads)
+            order_[j++] = cost[i].second;
+          deque_[t].set(head, j);
+        }
+      }
+    }
+
+    void run_chunk(const size_t chunk, const int id) {
+      Tracer::Region region("TaskQueue chunk");
+      const size_t end = std::min((chunk+1)*chunk_size_, task_.size());
+      for (size_t i = chunk*chunk_size_; i < end; ++i)
+        call_compute(task_[order_[i]], id);
+    }
+
   public:
     TaskQueue(size_t expected = 0) { task_.reserve(expected); }
     TaskQueue(std::vector<T>&& t) : task_(std::move(t)) { }
@@ -83,32 +188,32 @@ class TaskQueue {
       const int mkl_num = mkl_get_max_threads();
       mkl_set_num_threads(1);
 #endif
+      deque_ = std::unique_ptr<Deque[]>(new Deque[num_threads]);
+      setup(num_threads);
 #ifndef _OPENMP
-      flag_.resize((task_.size()-1)/chunck_+1);
-      std::for_each(flag_.begin(), flag_.end(), [](std::atomic_flag& i){ i.clear(); });
-      std::list<std::thread> threads;
-      for (int i = 0; i != num_threads; ++i)
-        threads.emplace_back(&TaskQueue<T>::compute_one_thread, this);
-      std::for_each(threads.begin(), threads.end(), [](std::thread& i){ i.join(); });
+      resources__->pool().run(num_threads, [this, num_threads](const int i) { compute_one_thread(i, num_threads); });
 #else
-      const size_t n = task_.size();
-      #pragma omp parallel for schedule(dynamic,chunck_)
+      const size_t n = (task_.size()-1)/chunk_size_+1;
+      #pragma omp parallel for schedule(dynamic,1) num_threads(num_threads)
       for (size_t i = 0; i < n; ++i)
-        call_compute(task_[i]);
+        run_chunk(i, omp_get_thread_num());
 #endif
+      deque_.reset();
 #ifdef HAVE_MKL_H
       mkl_set_num_threads(mkl_num);
 #endif
     }
 
-    void compute_one_thread() {
-      int j = 0;
-      for (auto i = flag_.begin(); i != flag_.end(); ++i, j += chunck_)
-        if (!i->test_and_set()) {
-          call_compute(task_[j]);
-          for (int k = 1; k < chunck_; ++k)
-            if (j+k < task_.size()) call_compute(task_[j+k]);
-        }
+    void compute_one_thread(const int id, const int num_threads) {
+      size_t chunk;
+      while (deque_[id].pop_front(chunk))
+        run_chunk(chunk, id);
+      // steal from the others
+      for (int i = 1; i < num_threads; ++i) {
+        Deque& victim = deque_[(id+i)%num_threads];
+        while (victim.pop_back(chunk))
+          run_chunk(chunk, id);
+      }
     }
 };
 
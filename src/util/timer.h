@@ -31,6 +31,7 @@
 #include <string>
 #include <algorithm>
 #include <src/util/string_util.h>
+#include <src/util/parallel/tracer.h>
 #include <bagel_config.h>
 
 namespace bagel {
@@ -51,19 +52,25 @@ class Timer {
       return out;
     }
 
-    // print out timing
+    // print out timing. The region [tp_, now] is also recorded by the tracer (including level 3, which is not printed).
+    // The start point is reset whether or not the level is printed, so that traced regions do not accumulate.
     void tick_print(std::string title) {
+      const auto now = std::chrono::high_resolution_clock::now();
+      const double time = std::chrono::duration_cast<std::chrono::nanoseconds>(now - tp_).count()*1.0e-9;
+      if (Tracer::enabled())
+        Tracer::record(title, tp_, now);
+      tp_ = now;
       if (level_ == 0) {
         // top level printout
-        std::cout << "       - " << std::left << std::setw(36) << title << std::right << std::setw(10) << std::fixed << std::setprecision(2) << tick() << std::endl;
+        std::cout << "       - " << std::left << std::setw(36) << title << std::right << std::setw(10) << std::fixed << std::setprecision(2) << time << std::endl;
       } else if (level_ == -1) {
         title = to_upper(title);
-        std::cout << "    * " << std::left << std::setw(39) << title << std::right << std::setw(10) << std::fixed << std::setprecision(2) << tick() << std::endl;
+        std::cout << "    * " << std::left << std::setw(39) << title << std::right << std::setw(10) << std::fixed << std::setprecision(2) << time << std::endl;
 #ifdef HAVE_MPI_H
       } else if (level_ >= 1 && level_ < 3) { // TODO for the time being suppressing the level 3 output
         const std::string indent(13+2*level_, ' ');
         const std::string mark = (level_ == 1 ? "o" : (level_ == 2 ? "*" : "-"));
-        std::cout << indent << std::left << mark << " " << std::setw(35) << title << std::right << std::setw(13) << std::fixed << std::setprecision(2) << tick() << std::endl;
+        std::cout << indent << std::left << mark << " " << std::setw(35) << title << std::right << std::setw(13) << std::fixed << std::setprecision(2) << time << std::endl;
 #endif
       }
     }
@@ -49,6 +49,9 @@ Geometry::Geometry(shared_ptr<const PTree> geominfo) : magnetism_(false), do_per
 
   schwarz_thresh_ = geominfo->get<double>("schwarz_thresh", 1.0e-12);
   overlap_thresh_ = geominfo->get<double>("thresh_overlap", 1.0e-8);
+  symmetry_ = geominfo->get<bool>("symmetry", false);
+  df_disk_ = geominfo->get<string>("df_disk", "");
+  df_disk_memory_ = geominfo->get<double>("df_disk_memory", 1024);
 
   // skip self interaction between the charges.
   skip_self_interaction_ = geominfo->get<bool>("skip_self_interaction", true);
@@ -156,6 +159,10 @@ void Geometry::common_init2(const bool print, const double thresh, const bool no
 
   if (london_ || nonzero_magnetic_field()) init_magnetism();
 
+  plist_.reset();
+  if (print && plist()->nirrep() > 1)
+    cout << "  Abelian point group: " << plist()->sym() << " (" << plist()->nirrep() << " irreps)" << endl << endl;
+
   if (!auxfile_.empty() && !nodf && !do_periodic_df_ && !fmm_) {
     if (print) cout << "  Number of auxiliary basis functions: " << setw(8) << naux() << endl << endl;
     cout << "  Since a DF basis is specified, we compute 2- and 3-index integrals:" << endl;
@@ -180,7 +187,7 @@ void Geometry::common_init2(const bool print, const double thresh, const bool no
 
 // suitable for geometry updates in optimization
 Geometry::Geometry(const Geometry& o, shared_ptr<const Matrix> displ, shared_ptr<const PTree> geominfo, const bool rotate, const bool nodf)
-  : Molecule(o, displ, rotate), schwarz_thresh_(o.schwarz_thresh_), magnetism_(false), london_(o.london_), use_finite_(o.use_finite_), do_periodic_df_(o.do_periodic_df_), hcoreinfo_(o.hcoreinfo_), fmm_(o.fmm_) {
+  : Molecule(o, displ, rotate), schwarz_thresh_(o.schwarz_thresh_), symmetry_(o.symmetry_), df_disk_(o.df_disk_), df_disk_memory_(o.df_disk_memory_), magnetism_(false), london_(o.london_), use_finite_(o.use_finite_), do_periodic_df_(o.do_periodic_df_), hcoreinfo_(o.hcoreinfo_), fmm_(o.fmm_) {
 
   overlap_thresh_ = geominfo->get<double>("thresh_overlap", 1.0e-8);
   set_london(geominfo);
@@ -191,7 +198,7 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const Matrix> displ, shared_ptr
 
 
 Geometry::Geometry(const Geometry& o, const array<double,3> displ)
-  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_),  magnetism_(false),
+  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), symmetry_(o.symmetry_), df_disk_(o.df_disk_), df_disk_memory_(o.df_disk_memory_), magnetism_(false),
     london_(o.london_), use_finite_(o.use_finite_), do_periodic_df_(o.do_periodic_df_), hcoreinfo_(o.hcoreinfo_), fmm_(o.fmm_) {
 
   // members of Molecule
@@ -222,7 +229,7 @@ Geometry::Geometry(const Geometry& o, const array<double,3> displ)
 
 // used when a new Geometry block is provided in input
 Geometry::Geometry(const Geometry& o, shared_ptr<const PTree> geominfo, const bool discard)
-  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), magnetism_(false),
+  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), symmetry_(o.symmetry_), df_disk_(o.df_disk_), df_disk_memory_(o.df_disk_memory_), magnetism_(false),
     london_(o.london_), use_finite_(o.use_finite_), do_periodic_df_(o.do_periodic_df_), hcoreinfo_(o.hcoreinfo_), fmm_(o.fmm_) {
 
   // members of Molecule
@@ -239,6 +246,9 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const PTree> geominfo, const bo
   // check all the options
   schwarz_thresh_ = geominfo->get<double>("schwarz_thresh", schwarz_thresh_);
   overlap_thresh_ = geominfo->get<double>("thresh_overlap", overlap_thresh_);
+  symmetry_ = geominfo->get<bool>("symmetry", symmetry_);
+  df_disk_ = geominfo->get<string>("df_disk", df_disk_);
+  df_disk_memory_ = geominfo->get<double>("df_disk_memory", df_disk_memory_);
 
   spherical_ = !geominfo->get<bool>("cartesian", !spherical_);
 
@@ -317,7 +327,7 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const PTree> geominfo, const bo
 *  supergeometry                                            *
 ************************************************************/
 Geometry::Geometry(vector<shared_ptr<const Geometry>> nmer, const bool nodf) :
-  schwarz_thresh_(nmer.front()->schwarz_thresh_), overlap_thresh_(nmer.front()->overlap_thresh_), magnetism_(false), london_(nmer.front()->london_),
+  schwarz_thresh_(nmer.front()->schwarz_thresh_), overlap_thresh_(nmer.front()->overlap_thresh_), symmetry_(nmer.front()->symmetry_), df_disk_(nmer.front()->df_disk_), df_disk_memory_(nmer.front()->df_disk_memory_), magnetism_(false), london_(nmer.front()->london_),
   use_finite_(nmer.front()->use_finite_), do_periodic_df_(false), hcoreinfo_(nmer.front()->hcoreinfo()), fmm_(nmer.front()->fmm()) {
 
   // A member of Molecule
@@ -394,6 +404,9 @@ Geometry::Geometry(const vector<shared_ptr<const Atom>> atoms, shared_ptr<const
 
   schwarz_thresh_ = geominfo->get<double>("schwarz_thresh", 1.0e-12);
   overlap_thresh_ = geominfo->get<double>("thresh_overlap", 1.0e-8);
+  symmetry_ = geominfo->get<bool>("symmetry", false);
+  df_disk_ = geominfo->get<string>("df_disk", "");
+  df_disk_memory_ = geominfo->get<double>("df_disk_memory", 1024);
   skip_self_interaction_ = geominfo->get<bool>("skip_self_interaction", true);
 
   // cartesian or not. Look in the atoms info to find out
@@ -607,10 +620,25 @@ void Geometry::compute_integrals(const double thresh) const {
     df_ = form_fit<DFDist_ints<Libint>>(thresh, true); // true means we construct J^-1/2
 #else
   if (!magnetism_)
-    df_ = form_fit<DFDist_ints<ERIBatch>>(thresh, true); // true means we construct J^-1/2
+    df_ = make_shared<DFDist_ints<ERIBatch>>(nbasis(), naux(), atoms(), aux_atoms(), thresh, true, 0.0, false, nullptr, false, plist()); // J^-1/2 is constructed
 #endif
   else
     df_ = form_fit<ComplexDFDist_ints<ComplexERIBatch>>(thresh, true); // true means we construct J^-1/2
+
+  // optionally keep the 3-index integrals on disk
+  if (!df_disk_.empty())
+    df_->offload_3index(df_disk_, df_disk_memory_);
+}
+
+
+shared_ptr<const Petite> Geometry::plist() const {
+  if (!plist_) {
+    vector<vector<double>> symop{{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0}};
+    if (symmetry_ && !magnetism_ && !do_periodic_df_)
+      symop = Petite::find_symop({atoms_, aux_atoms_});
+    plist_ = make_shared<const Petite>(atoms_, symop);
+  }
+  return plist_;
 }
 
 
@@ -639,7 +667,7 @@ void Geometry::init_magnetism() {
 
 
 Geometry::Geometry(const Geometry& o, const string type)
-  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), magnetism_(false),
+  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), symmetry_(o.symmetry_), df_disk_(o.df_disk_), df_disk_memory_(o.df_disk_memory_), magnetism_(false),
     london_(o.london_), use_finite_(o.use_finite_), do_periodic_df_(o.do_periodic_df_), hcoreinfo_(o.hcoreinfo_) {
 
   if (!o.fmm_)
@@ -47,6 +47,14 @@ class Geometry : public Molecule {
     // small-large component
     mutable std::shared_ptr<DFDist> dfsl_;
 
+    // abelian point-group symmetry of the nuclear framework and basis sets (used if symmetry_ is true)
+    bool symmetry_;
+    mutable std::shared_ptr<const Petite> plist_;
+
+    // scratch directory and slab memory (in MB) when the 3-index integrals are kept on disk (empty: in memory)
+    std::string df_disk_;
+    double df_disk_memory_;
+
     // Constructor helpers
     void common_init2(const bool print, const double thresh, const bool nodf = false);
     void compute_integrals(const double thresh) const;
@@ -76,7 +84,7 @@ class Geometry : public Molecule {
     template<class Archive>
     void save(Archive& ar, const unsigned int) const {
       ar << boost::serialization::base_object<Molecule>(*this);
-      ar << schwarz_thresh_ << overlap_thresh_ << magnetism_ << london_ << use_finite_ << do_periodic_df_ << hcoreinfo_ << fmm_;
+      ar << schwarz_thresh_ << overlap_thresh_ << symmetry_ << df_disk_ << df_disk_memory_ << magnetism_ << london_ << use_finite_ << do_periodic_df_ << hcoreinfo_ << fmm_;
       const size_t dfindex = !df_ ? 0 : std::hash<DFDist*>()(df_.get());
       ar << dfindex;
       const bool do_rel   = !!dfs_;
@@ -85,9 +93,13 @@ class Geometry : public Molecule {
     }
 
     template<class Archive>
-    void load(Archive& ar, const unsigned int) {
+    void load(Archive& ar, const unsigned int version) {
       ar >> boost::serialization::base_object<Molecule>(*this);
-      ar >> schwarz_thresh_ >> overlap_thresh_ >> magnetism_ >> london_ >> use_finite_ >> do_periodic_df_ >> hcoreinfo_ >> fmm_;
+      ar >> schwarz_thresh_ >> overlap_thresh_;
+      // archives written before version 1 do not store the symmetry flag and the DF disk settings
+      if (version > 0)
+        ar >> symmetry_ >> df_disk_ >> df_disk_memory_;
+      ar >> magnetism_ >> london_ >> use_finite_ >> do_periodic_df_ >> hcoreinfo_ >> fmm_;
       size_t dfindex;
       ar >> dfindex;
       static std::map<size_t, std::weak_ptr<DFDist>> dfmap;
@@ -112,7 +124,7 @@ class Geometry : public Molecule {
     }
 
   public:
-    Geometry() { }
+    Geometry() : symmetry_(false), df_disk_memory_(1024) { }
     Geometry(std::shared_ptr<const PTree> idata);
     Geometry(const std::vector<std::shared_ptr<const Atom>> atoms, std::shared_ptr<const PTree> o);
     Geometry(const Geometry& o, std::shared_ptr<const PTree> idata, const bool discard_prev_df = true);
@@ -128,6 +140,8 @@ class Geometry : public Molecule {
     double schwarz_thresh() const { return schwarz_thresh_; }
     double overlap_thresh() const { return overlap_thresh_; }
     bool london() const { return london_; }
+    // symmetry operations (D2h subgroup) that map the molecule onto itself; c1 if symmetry is turned off
+    std::shared_ptr<const Petite> plist() const;
     bool magnetism() const { return magnetism_; }
 
     // returns schwarz screening TODO not working for DF yet
@@ -168,6 +182,8 @@ class Geometry : public Molecule {
 }
 
 #include <src/util/archive.h>
+#include <boost/serialization/version.hpp>
 BOOST_CLASS_EXPORT_KEY(bagel::Geometry)
+BOOST_CLASS_VERSION(bagel::Geometry, 1)
 
 #endif
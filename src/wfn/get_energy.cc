@@ -99,9 +99,13 @@ get_energy(const string title, shared_ptr<const PTree> itree, shared_ptr<const G
     }
     else if (title == "fci") {
       const string algorithm = itree->get<string>("algorithm", "");
-      const bool dokh = (algorithm == "" || algorithm == "auto") && geom->nele() > geom->nbasis();
+      // the determinant space split by irreps is only implemented in the Knowles-Handy algorithm
+      const bool symmetry = itree->get<bool>("symmetry", false);
+      const bool dokh = (algorithm == "" || algorithm == "auto") && (geom->nele() > geom->nbasis() || symmetry);
       if (dokh || algorithm == "kh" || algorithm == "knowles" || algorithm == "handy") {
         auto m = make_shared<KnowlesHandy>(itree, geom, ref);        m->compute();   out = m->energy(target);   ref = m->conv_to_ref();
+      } else if (symmetry) {
+        throw runtime_error("\"symmetry\" in FCI is only available with the Knowles-Handy algorithm");
       } else if (algorithm == "hz" || algorithm == "harrison" || algorithm == "zarrabian" || algorithm == "") {
         auto m = make_shared<HarrisonZarrabian>(itree, geom, ref);   m->compute();   out = m->energy(target);   ref = m->conv_to_ref();
 #ifdef HAVE_MPI_H
@@ -24,7 +24,10 @@
 
 #include <algorithm>
 #include <src/mat1e/overlap.h>
+#include <src/mat1e/dipolematrix.h>
+#include <src/util/math/bfgs.h>
 #include <src/util/math/jacobi.h>
+#include <src/util/parallel/staticdist.h>
 #include <src/wfn/localization.h>
 
 using namespace bagel;
@@ -103,6 +106,117 @@ shared_ptr<Matrix> OrbitalLocalization::localize() {
   return out;
 }
 
+shared_ptr<Matrix> OrbitalLocalization::localize_bfgs(shared_ptr<const Matrix> coeff, const int max_iter, const double thresh) const {
+  Timer bfgstime;
+  auto out = make_shared<Matrix>(*coeff);
+  const int norb = out->mdim();
+  // maximum element of the rotation generator in one step; reduced when a step decreases the functional
+  const double max_step_limit = 0.5;
+  double max_step = max_step_limit;
+
+  // accumulated rotation, whose logarithm is the displacement used in BFGS. The logarithm is a truncated series around
+  // the identity, so BFGS is restarted from the current orbitals once the rotation is no longer small
+  const double max_rotation_limit = 0.5;
+  auto x = make_shared<Matrix>(norb, norb);
+  x->unit();
+  shared_ptr<BFGS<Matrix>> bfgs;
+  shared_ptr<const Matrix> previous_coeff;
+
+  cout << setw(6) << "iter" << setw(20) << "functional" << setw(27) << "delta" << setw(22) << "gradient" << setw(22) << "time" << endl;
+  cout << "--------------------------------------------------------------------------------------------------------------------" << endl;
+
+  double previous = 0.0;
+  for (int iter = 0; iter < max_iter; ++iter) {
+    // lower triangles are filled by functional
+    auto grad = make_shared<Matrix>(norb, norb);
+    auto hdiag = make_shared<Matrix>(norb, norb);
+    double value = functional(out, *grad, *hdiag);
+
+    // the functional is not concave; a step that decreases it is undone and BFGS is restarted with a shorter step
+    if (previous_coeff && value < previous) {
+      cout << "      step rejected; the maximum step size is reduced" << endl;
+      *out = *previous_coeff;
+      x->unit();
+      bfgs.reset();
+      max_step *= 0.5;
+      grad->zero();
+      hdiag->zero();
+      value = functional(out, *grad, *hdiag);
+    } else if (previous_coeff) {
+      max_step = min(max_step_limit, max_step*2.0);
+    }
+    for (int k = 0; k != norb; ++k)
+      for (int l = 0; l != k; ++l) {
+        grad->element(l, k) = -grad->element(k, l);
+        hdiag->element(l, k) = hdiag->element(k, l);
+      }
+    const double delta = value - previous;
+    const bool accepted = previous_coeff && bfgs;
+    previous = value;
+
+    // the functional is maximized; BFGS minimizes its negative
+    grad->scale(-1.0);
+    const double gradient = grad->rms();
+    cout << setw(5) << iter << fixed << setw(24) << setprecision(10) << value
+                            << fixed << setw(24) << setprecision(10) << (previous_coeff ? delta : 0.0)
+                            << scientific << setw(22) << setprecision(2) << gradient
+                            << fixed << setw(22) << setprecision(6) << bfgstime.tick() << endl;
+    if (gradient < thresh || (accepted && fabs(delta) < thresh)) {
+      cout << "Converged!" << endl;
+      break;
+    }
+
+    if (!bfgs) {
+      // absolute values of the diagonal Hessian, so that the steps are always uphill
+      for (auto& i : *hdiag)
+        i = max(fabs(i), 1.0e-1);
+      for (int i = 0; i != norb; ++i)
+        hdiag->element(i, i) = 1.0;
+      bfgs = make_shared<BFGS<Matrix>>(hdiag);
+    }
+
+    shared_ptr<Matrix> a = bfgs->extrapolate(grad, x->log(8));
+    a->scale(-1.0);
+    const double max_rotation = a->size() ? fabs(*max_element(a->begin(), a->end(), [](double p, double q) { return fabs(p) < fabs(q); })) : 0.0;
+    if (max_rotation > max_step)
+      a->scale(max_step/max_rotation);
+
+    shared_ptr<Matrix> expa = a->exp(100);
+    expa->purify_unitary();
+    previous_coeff = out->copy();
+    *out *= *expa;
+    *x *= *expa;
+    mpi__->broadcast(out->data(), out->size(), 0);
+
+    Matrix displacement = *x;
+    for (int i = 0; i != norb; ++i)
+      displacement.element(i, i) -= 1.0;
+    if (displacement.norm() > max_rotation_limit) {
+      x->unit();
+      bfgs.reset();
+    }
+  }
+  cout << endl;
+  return out;
+}
+
+
+double OrbitalLocalization::accumulate_derivatives(const Matrix& Q, Matrix& grad, Matrix& hdiag) {
+  const int norb = Q.ndim();
+  double out = 0.0;
+  for (int k = 0; k != norb; ++k) {
+    out += Q(k, k) * Q(k, k);
+    for (int l = 0; l != k; ++l) {
+      // derivatives of sum_i Q_ii^2 with respect to kappa_kl, where the orbitals are rotated by exp(kappa)
+      const double Qkminusl = Q(k, k) - Q(l, l);
+      grad(k, l) -= 4.0 * Q(k, l) * Qkminusl;
+      hdiag(k, l) += 16.0 * Q(k, l) * Q(k, l) - 4.0 * Qkminusl * Qkminusl;
+    }
+  }
+  return out;
+}
+
+
 /************************************************************************************
 * Orthogonalize based on regions - follows the implementation in                    *
 *   de Silva, Giebultowski, Korchowiec, PCCP 2011, 14, 546–552                      *
@@ -186,21 +300,25 @@ shared_ptr<Matrix> RegionLocalization::localize_space(shared_ptr<const Matrix> c
   {
     auto jacobi = make_shared<JacobiDiag>(make_shared<PTree>(), ortho_density, U);
 
+    // rotations are collected in order; JacobiDiag applies independent pairs simultaneously
+    vector<pair<int,int>> pairs;
     for(int& iocc : occupied) {
-      for(int& imixed : mixed) jacobi->rotate(iocc, imixed);
-      for(int& ivirt : virt) jacobi->rotate(iocc, ivirt);
+      for(int& imixed : mixed) pairs.emplace_back(iocc, imixed);
+      for(int& ivirt : virt) pairs.emplace_back(iocc, ivirt);
     }
 
     for(int& imixed : mixed) {
-      for(int& ivirt : virt) jacobi->rotate(imixed, ivirt);
+      for(int& ivirt : virt) pairs.emplace_back(imixed, ivirt);
     }
 
     if ( !mixed.empty() )
       cout << "WARNING! Localization between bound regions not well tested." << endl;
     for (auto i = mixed.begin(); i != mixed.end(); ++i) {
       for (auto j = mixed.begin(); j != i; ++j)
-        jacobi->rotate(*j,*i);
+        pairs.emplace_back(*j,*i);
     }
+
+    jacobi->rotate(pairs);
   }
 
   // Reorder so that the occupied orbitals come first, separated by fragment
@@ -246,6 +364,9 @@ void PMLocalization::common_init(vector<int> sizes) {
   max_iter_ = input_->get<int>("max_iter", 50);
   thresh_ = input_->get<double>("thresh", 1.0e-6);
   lowdin_ = input_->get<bool>("lowdin", true);
+  optimizer_ = input_->get<string>("optimizer", "jacobi");
+  if (optimizer_ != "jacobi" && optimizer_ != "bfgs")
+    throw runtime_error("Unrecognized optimizer for PM localization: " + optimizer_);
 
   cout << endl << "  Localization threshold: " << setprecision(2) << setw(6) << scientific << thresh_ << endl << endl;
 
@@ -291,6 +412,9 @@ void PMLocalization::common_init(vector<int> sizes) {
 }
 
 shared_ptr<Matrix> PMLocalization::localize_space(shared_ptr<const Matrix> coeff) {
+  if (optimizer_ == "bfgs")
+    return localize_bfgs(coeff, max_iter_, thresh_);
+
   Timer pmtime;
   auto out = make_shared<Matrix>(*coeff);
   const int norb = out->mdim();
@@ -351,6 +475,118 @@ double PMLocalization::calc_P(shared_ptr<const Matrix> coeff, const int nstart,
   return std::sqrt(out/static_cast<double>(norb));
 }
 
+double PMLocalization::functional(shared_ptr<const Matrix> coeff, Matrix& grad, Matrix& hdiag) const {
+  const int nbasis = coeff->ndim();
+  const int norb = coeff->mdim();
+  const Matrix mos = *S_ * *coeff;
+
+  // atoms are distributed over the nodes
+  StaticDist dist(region_bounds_.size(), mpi__->size());
+  size_t astart, aend;
+  tie(astart, aend) = dist.range(mpi__->rank());
+
+  double out = 0.0;
+  Matrix P_A(norb, norb, true);
+  for (size_t iatom = astart; iatom != aend; ++iatom) {
+    const int boundstart = region_bounds_[iatom].first;
+    const int natombasis = region_bounds_[iatom].second - boundstart;
+
+    dgemm_("T", "N", norb, norb, natombasis, 1.0, mos.element_ptr(boundstart, 0), nbasis,
+           (lowdin_ ? mos : *coeff).element_ptr(boundstart, 0), nbasis, 0.0, P_A.data(), norb);
+    if (!lowdin_)
+      P_A.symmetrize();
+
+    out += accumulate_derivatives(P_A, grad, hdiag);
+  }
+
+  mpi__->allreduce(&out, 1);
+  mpi__->allreduce(grad.data(), grad.size());
+  mpi__->allreduce(hdiag.data(), hdiag.size());
+  return out;
+}
+
 double PMLocalization::metric() const {
   return calc_P(coeff_, 0, geom_->nele()/2);
 }
+
+/************************************************************************************
+* Foster-Boys Localization                                                          *
+************************************************************************************/
+BoysLocalization::BoysLocalization(shared_ptr<const PTree> input, shared_ptr<const Geometry> geom, shared_ptr<const Matrix> coeff,
+  vector<pair<int, int>> subspaces) : OrbitalLocalization(input, geom, coeff, subspaces)
+{
+  common_init();
+}
+
+BoysLocalization::BoysLocalization(shared_ptr<const PTree> input, shared_ptr<const Reference> ref)
+  : OrbitalLocalization(input, ref)
+{
+  common_init();
+}
+
+void BoysLocalization::common_init() {
+  cout << " ======    Foster-Boys Localization    ======" << endl;
+
+  max_iter_ = input_->get<int>("max_iter", 100);
+  thresh_ = input_->get<double>("thresh", 1.0e-6);
+  optimizer_ = input_->get<string>("optimizer", "bfgs");
+  if (optimizer_ != "jacobi" && optimizer_ != "bfgs")
+    throw runtime_error("Unrecognized optimizer for Foster-Boys localization: " + optimizer_);
+
+  cout << endl << "  Localization threshold: " << setprecision(2) << setw(6) << scientific << thresh_ << endl << endl;
+
+  auto dipole = make_shared<DipoleMatrix>(geom_);
+  for (int i = 0; i != 3; ++i)
+    dipole_[i] = dipole->data(i);
+}
+
+shared_ptr<Matrix> BoysLocalization::localize_space(shared_ptr<const Matrix> coeff) {
+  if (optimizer_ == "bfgs")
+    return localize_bfgs(coeff, max_iter_, thresh_);
+
+  Timer boystime;
+  auto out = make_shared<Matrix>(*coeff);
+  const int norb = out->mdim();
+
+  auto jacobi = make_shared<JacobiBoys>(input_, out, 0, norb, dipole_);
+
+  cout << setw(6) << "iter" << setw(20) << "functional" << setw(27) << "delta" << setw(22) << "time" << endl;
+  cout << "----------------------------------------------------------------------------------------------" << endl;
+
+  Matrix grad(norb, norb), hdiag(norb, norb);
+  double value = functional(out, grad, hdiag);
+
+  cout << setw(5) << 0 << fixed << setw(24) << setprecision(10) << value << endl;
+
+  for (int i = 0; i < max_iter_; ++i) {
+    jacobi->sweep();
+
+    const double tmp = functional(out, grad, hdiag);
+    const double delta = tmp - value;
+    cout << setw(5) << i+1 << fixed << setw(24) << setprecision(10) << tmp
+                           << fixed << setw(24) << setprecision(10) << delta
+                           << fixed << setw(24) << setprecision(6)  << boystime.tick() << endl;
+    value = tmp;
+    if (fabs(delta) < thresh_) {
+      cout << "Converged!" << endl;
+      break;
+    }
+  }
+  cout << endl;
+
+  return out;
+}
+
+double BoysLocalization::functional(shared_ptr<const Matrix> coeff, Matrix& grad, Matrix& hdiag) const {
+  // sum_i |<i|r|i>|^2, which is maximized when the spread of the orbitals is minimized
+  double out = 0.0;
+  for (auto& d : dipole_)
+    out += accumulate_derivatives(*coeff % *d * *coeff, grad, hdiag);
+  return out;
+}
+
+double BoysLocalization::metric() const {
+  const int norb = geom_->nele()/2;
+  Matrix grad(norb, norb), hdiag(norb, norb);
+  return std::sqrt(functional(coeff_->slice_copy(0, norb), grad, hdiag)/static_cast<double>(norb));
+}
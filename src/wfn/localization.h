@@ -26,6 +26,7 @@
 #ifndef __BAGEL_WFN_LOCALIZE_H
 #define __BAGEL_WFN_LOCALIZE_H
 
+#include <array>
 #include <vector>
 
 #include <src/wfn/reference.h>
@@ -47,6 +48,15 @@ class OrbitalLocalization {
 
     virtual std::shared_ptr<Matrix> localize_space(std::shared_ptr<const Matrix> coeff) = 0;
 
+    // Gradient-based (BFGS) optimizer which maximizes functional(). Used for large orbital sets instead of Jacobi sweeps
+    std::shared_ptr<Matrix> localize_bfgs(std::shared_ptr<const Matrix> coeff, const int max_iter, const double thresh) const;
+    // Returns the functional and fills the lower triangles of its gradient and diagonal Hessian with respect to orbital rotations
+    virtual double functional(std::shared_ptr<const Matrix> coeff, Matrix& grad, Matrix& hdiag) const {
+      throw std::logic_error("This localization scheme does not support gradient-based optimization");
+    }
+    // Adds the contributions of sum_i Q_ii^2 for a symmetric one-electron operator Q in the MO basis
+    static double accumulate_derivatives(const Matrix& Q, Matrix& grad, Matrix& hdiag);
+
   public:
     OrbitalLocalization(std::shared_ptr<const PTree> input, std::shared_ptr<const Geometry> geom, std::shared_ptr<const Matrix> coeff,
       std::vector<std::pair<int, int>> subspaces);
@@ -87,8 +97,11 @@ class PMLocalization : public OrbitalLocalization {
     int max_iter_;
     double thresh_;
     bool lowdin_;
+    // "jacobi" or "bfgs"
+    std::string optimizer_;
 
     std::shared_ptr<Matrix> localize_space(std::shared_ptr<const Matrix> coeff) override;
+    double functional(std::shared_ptr<const Matrix> coeff, Matrix& grad, Matrix& hdiag) const override;
 
   public:
     PMLocalization(std::shared_ptr<const PTree> input, std::shared_ptr<const Geometry> geom, std::shared_ptr<const Matrix> coeff,
@@ -102,6 +115,30 @@ class PMLocalization : public OrbitalLocalization {
     void common_init(std::vector<int> sizes);
 };
 
+// Foster-Boys
+class BoysLocalization : public OrbitalLocalization {
+  protected:
+    std::array<std::shared_ptr<const Matrix>, 3> dipole_;
+
+    int max_iter_;
+    double thresh_;
+    // "jacobi" or "bfgs"
+    std::string optimizer_;
+
+    std::shared_ptr<Matrix> localize_space(std::shared_ptr<const Matrix> coeff) override;
+    double functional(std::shared_ptr<const Matrix> coeff, Matrix& grad, Matrix& hdiag) const override;
+
+  public:
+    BoysLocalization(std::shared_ptr<const PTree> input, std::shared_ptr<const Geometry> geom, std::shared_ptr<const Matrix> coeff,
+      std::vector<std::pair<int, int>> subspaces);
+    BoysLocalization(std::shared_ptr<const PTree> input, std::shared_ptr<const Reference> ref);
+
+    double metric() const override;
+
+  private:
+    void common_init();
+};
+
 }
 
 #endif